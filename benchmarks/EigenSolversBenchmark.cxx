@@ -0,0 +1,136 @@
+/*!
+ * \file   benchmarks/EigenSolversBenchmark.cxx
+ * \brief  Benchmarks of the eigen solvers of symmetric tensors
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorBatchedEigenSolver.hxx"
+#include "Benchmark.hxx"
+
+template <unsigned short N,
+          tfel::math::stensor_common::EigenSolver es>
+static void benchmark(tfel::benchmarks::BenchmarkSuite& suite,
+                      const std::string& n) {
+  using namespace tfel::math;
+  using tfel::benchmarks::clobber;
+  auto g = tfel::benchmarks::RandomNumberGenerator{};
+  auto s = stensor<N, double>{};
+  for (auto& v : s) {
+    v = g(-1, 1);
+  }
+  const auto d = std::to_string(N) + "D";
+  suite.run("stensor<" + d + ">::computeEigenValues<" + n + ">", [&s] {
+    clobber(s);
+    return s.template computeEigenValues<es>();
+  });
+  suite.run("stensor<" + d + ">::computeEigenVectors<" + n + ">", [&s] {
+    clobber(s);
+    return s.template computeEigenVectors<es>();
+  });
+}  // end of benchmark
+
+template <unsigned short N>
+static void benchmark(tfel::benchmarks::BenchmarkSuite& suite) {
+  using tfel::math::stensor_common;
+  benchmark<N, stensor_common::TFELEIGENSOLVER>(suite, "TFELEIGENSOLVER");
+  benchmark<N, stensor_common::FSESANALYTICALEIGENSOLVER>(
+      suite, "FSESANALYTICALEIGENSOLVER");
+  benchmark<N, stensor_common::FSESJACOBIEIGENSOLVER>(
+      suite, "FSESJACOBIEIGENSOLVER");
+  benchmark<N, stensor_common::FSESQLEIGENSOLVER>(suite,
+                                                  "FSESQLEIGENSOLVER");
+  benchmark<N, stensor_common::FSESCUPPENEIGENSOLVER>(
+      suite, "FSESCUPPENEIGENSOLVER");
+  benchmark<N, stensor_common::FSESHYBRIDEIGENSOLVER>(
+      suite, "FSESHYBRIDEIGENSOLVER");
+  benchmark<N, stensor_common::GTESYMMETRICQREIGENSOLVER>(
+      suite, "GTESYMMETRICQREIGENSOLVER");
+  benchmark<N, stensor_common::HARARIEIGENSOLVER>(suite,
+                                                  "HARARIEIGENSOLVER");
+}  // end of benchmark
+
+/*!
+ * \brief compare the batched eigen solver to the scalar ones on the same
+ * set of tensors
+ */
+template <unsigned short N>
+static void benchmarkBatchedEigenSolver(
+    tfel::benchmarks::BenchmarkSuite& suite) {
+  using namespace tfel::math;
+  using Solver = StensorBatchedEigenSolver<N, double>;
+  constexpr auto ssize = StensorDimeToSize<N>::value;
+  constexpr std::size_t n = 1024;
+  auto g = tfel::benchmarks::RandomNumberGenerator{};
+  auto tensors = std::vector<stensor<N, double>>(n);
+  auto s = std::vector<double>(ssize * n);
+  for (std::size_t i = 0; i != n; ++i) {
+    for (unsigned short c = 0; c != ssize; ++c) {
+      tensors[i][c] = s[c * n + i] = g(-1, 1);
+    }
+  }
+  auto vp = std::vector<double>(3 * n);
+  auto m = std::vector<double>(9 * n);
+  const auto d = std::to_string(N) + "D";
+  const auto ns = " [" + std::to_string(n) + " tensors]";
+  suite.run("StensorBatchedEigenSolver<" + d + ">::computeEigenValues" + ns,
+            [&vp, &s] {
+              Solver::computeEigenValues(vp, s);
+              return vp[0];
+            });
+  suite.run("StensorBatchedEigenSolver<" + d + ">::computeEigenVectors" + ns,
+            [&vp, &m, &s] {
+              Solver::computeEigenVectors(vp, m, s);
+              return m[0];
+            });
+  // the results are stored as by the batched solver
+  auto run_scalar = [&suite, &tensors, &vp, &m, &d,
+                     &ns]<stensor_common::EigenSolver es>(
+                        const std::string& name) {
+    suite.run("stensor<" + d + ">::computeEigenVectors<" + name + ">" + ns,
+              [&tensors, &vp, &m] {
+                for (std::size_t i = 0; i != n; ++i) {
+                  const auto [vp2, m2] =
+                      tensors[i].template computeEigenVectors<es>();
+                  for (unsigned short k = 0; k != 3; ++k) {
+                    vp[k * n + i] = vp2[k];
+                  }
+                  for (unsigned short k = 0; k != 9; ++k) {
+                    m[k * n + i] = m2(k / 3, k % 3);
+                  }
+                }
+                return m[0];
+              });
+  };
+  run_scalar.template operator()<stensor_common::TFELEIGENSOLVER>(
+      "TFELEIGENSOLVER");
+  run_scalar.template operator()<stensor_common::FSESJACOBIEIGENSOLVER>(
+      "FSESJACOBIEIGENSOLVER");
+  run_scalar.template operator()<stensor_common::GTESYMMETRICQREIGENSOLVER>(
+      "GTESYMMETRICQREIGENSOLVER");
+}  // end of benchmarkBatchedEigenSolver
+
+int main(const int argc, const char* const* const argv) {
+  try {
+    auto suite = tfel::benchmarks::BenchmarkSuite("EigenSolvers", argc, argv);
+    benchmark<2u>(suite);
+    benchmark<3u>(suite);
+    benchmarkBatchedEigenSolver<2u>(suite);
+    benchmarkBatchedEigenSolver<3u>(suite);
+    return suite.finalize();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+  }
+  return EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,71 @@
+/*!
+ * \file   benchmarks/EvaluatorBenchmark.cxx
+ * \brief  Benchmarks of the `Evaluator` class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Math/Evaluator.hxx"
+#include "Benchmark.hxx"
+
+static void benchmark(tfel::benchmarks::BenchmarkSuite& suite,
+                      const std::string& n,
+                      const std::string& f) {
+  using tfel::math::Evaluator;
+  using tfel::benchmarks::clobber;
+  constexpr std::size_t nvalues = 1024;
+  auto g = tfel::benchmarks::RandomNumberGenerator{};
+  const auto vnames = std::vector<std::string>{"T", "p"};
+  auto e = Evaluator(vnames, f);
+  auto T = std::vector<double>(nvalues);
+  auto p = std::vector<double>(nvalues);
+  for (std::size_t i = 0; i != nvalues; ++i) {
+    T[i] = g(293.15, 1200);
+    p[i] = g(0, 0.2);
+  }
+  auto i = std::size_t{};
+  auto getValue = [&e, &T, &p, &i] {
+    e.setVariableValue(std::size_t{0}, T[i]);
+    e.setVariableValue(std::size_t{1}, p[i]);
+    i = (i + 1) % nvalues;
+    return e.getValue();
+  };
+  suite.run("Evaluator::getValue (" + n + ")", getValue);
+  e.compile();
+  suite.run("Evaluator::getValue (" + n + ", compiled)", getValue);
+  const auto columns = std::vector<std::span<const double>>{T, p};
+  auto out = std::vector<double>(nvalues);
+  suite.run("Evaluator::evaluate (" + n + ", " + std::to_string(nvalues) +
+                " values)",
+            [&e, &columns, &out] {
+              e.evaluate(columns, out);
+              clobber(out);
+            });
+}  // end of benchmark
+
+int main(const int argc, const char* const* const argv) {
+  try {
+    auto suite = tfel::benchmarks::BenchmarkSuite("Evaluator", argc, argv);
+    benchmark(suite, "polynomial", "1.2e11 - 4.3e7 * T + 3.1e4 * T * T");
+    benchmark(suite, "Arrhenius", "1.8e-8 * exp(-2.3e5 / (8.314 * T))");
+    benchmark(suite, "porosity dependent",
+              "(1 - 2.5 * p) * (2.2e11 - 3.1e7 * (T - 273.15)) / "
+              "(1 + 0.3 * p ** 2) * (T < 1000 ? 1 : 1 - (T - 1000) / 500)");
+    return suite.finalize();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+  }
+  return EXIT_FAILURE;
+}  // end of main
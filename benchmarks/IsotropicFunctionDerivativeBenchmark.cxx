@@ -0,0 +1,82 @@
+/*!
+ * \file   benchmarks/IsotropicFunctionDerivativeBenchmark.cxx
+ * \brief  Benchmarks of the computation of the derivatives of isotropic
+ * functions of symmetric tensors
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "Benchmark.hxx"
+
+template <unsigned short N>
+static void benchmark(tfel::benchmarks::BenchmarkSuite& suite) {
+  using namespace tfel::math;
+  using tfel::benchmarks::clobber;
+  constexpr auto eps = 1e-12;
+  const auto f = [](const double x) { return std::exp(x); };
+  const auto df = [](const double x) { return std::exp(x); };
+  auto g = tfel::benchmarks::RandomNumberGenerator{};
+  auto s = stensor<N, double>{};
+  for (auto& v : s) {
+    v = g(-1, 1);
+  }
+  const auto d = std::to_string(N) + "D";
+  const auto n = "stensor<" + d + ">::";
+  suite.run(n + "computeIsotropicFunction", [&s, f] {
+    clobber(s);
+    return s.computeIsotropicFunction(f);
+  });
+  suite.run(n + "computeIsotropicFunctionDerivative", [&s, f, df] {
+    clobber(s);
+    return s.computeIsotropicFunctionDerivative(f, df, eps);
+  });
+  suite.run(n + "computeIsotropicFunctionAndDerivative", [&s, f, df] {
+    clobber(s);
+    return s.computeIsotropicFunctionAndDerivative(f, df, eps);
+  });
+  // derivative computed from the eigen values and the eigen vectors,
+  // excluding the eigen decomposition
+  auto [vp, m] = s.computeEigenVectors();
+  auto fv = tvector<3u, double>{};
+  auto dfv = tvector<3u, double>{};
+  for (unsigned short i = 0; i != 3; ++i) {
+    fv[i] = f(vp[i]);
+    dfv[i] = df(vp[i]);
+  }
+  suite.run(n + "computeIsotropicFunctionDerivative (eigen decomposition "
+                "excluded)",
+            [&fv, &dfv, &vp, &m] {
+              clobber(fv);
+              clobber(dfv);
+              return stensor<N, double>::computeIsotropicFunctionDerivative(
+                  fv, dfv, vp, m, eps);
+            });
+}  // end of benchmark
+
+int main(const int argc, const char* const* const argv) {
+  try {
+    auto suite = tfel::benchmarks::BenchmarkSuite(
+        "IsotropicFunctionDerivative", argc, argv);
+    benchmark<1u>(suite);
+    benchmark<2u>(suite);
+    benchmark<3u>(suite);
+    return suite.finalize();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+  }
+  return EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,150 @@
+/*!
+ * \file   benchmarks/KrigingBenchmark.cxx
+ * \brief  Benchmarks of the evaluation of kriging interpolations
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Math/Kriging.hxx"
+#include "TFEL/Math/LocalKriging.hxx"
+#include "Benchmark.hxx"
+
+//! \return a random point of the unit hypercube
+template <unsigned short N>
+static typename tfel::math::KrigingVariable<N, double>::type getRandomPoint(
+    tfel::benchmarks::RandomNumberGenerator& g) {
+  if constexpr (N == 1) {
+    return g(0, 1);
+  } else {
+    auto x = tfel::math::tvector<N, double>{};
+    for (auto& v : x) {
+      v = g(0, 1);
+    }
+    return x;
+  }
+}  // end of getRandomPoint
+
+//! \return the interpolated function
+template <unsigned short N>
+static double
+f(const typename tfel::math::KrigingVariable<N, double>::type& x) {
+  if constexpr (N == 1) {
+    return std::sin(3 * x);
+  } else {
+    auto r = 1.;
+    for (const auto& v : x) {
+      r *= std::sin(3 * v);
+    }
+    return r;
+  }
+}  // end of f
+
+template <unsigned short N>
+static void benchmark(tfel::benchmarks::BenchmarkSuite& suite,
+                      const std::size_t npoints) {
+  using tfel::math::Kriging;
+  constexpr std::size_t nvalues = 1024;
+  auto g = tfel::benchmarks::RandomNumberGenerator{};
+  auto k = Kriging<N, double>{};
+  for (std::size_t i = 0; i != npoints; ++i) {
+    const auto x = getRandomPoint<N>(g);
+    k.addValue(x, f<N>(x));
+  }
+  k.buildInterpolation();
+  auto points =
+      std::vector<typename tfel::math::KrigingVariable<N, double>::type>{};
+  for (std::size_t i = 0; i != nvalues; ++i) {
+    points.push_back(getRandomPoint<N>(g));
+  }
+  auto i = std::size_t{};
+  suite.run("Kriging<" + std::to_string(N) + "> (" +
+                std::to_string(npoints) + " points)",
+            [&k, &points, &i] {
+              const auto r = k(points[i]);
+              i = (i + 1) % nvalues;
+              return r;
+            });
+}  // end of benchmark
+
+template <unsigned short N>
+static void benchmarkLocalKriging(tfel::benchmarks::BenchmarkSuite& suite,
+                                  const std::size_t npoints) {
+  using Variable = typename tfel::math::KrigingVariable<N, double>::type;
+  constexpr std::size_t nvalues = 1024;
+  auto g = tfel::benchmarks::RandomNumberGenerator{};
+  auto k = tfel::math::LocalKriging<N, double>{};
+  // twice the typical size of the neighbourhood of a point
+  k.setSupportRadius(2 * std::pow(static_cast<double>(k.getNumberOfNeighbours()) /
+                                      static_cast<double>(npoints),
+                                  1. / N));
+  for (std::size_t i = 0; i != npoints; ++i) {
+    const auto x = getRandomPoint<N>(g);
+    k.addValue(x, f<N>(x));
+  }
+  k.buildInterpolation();
+  auto points = std::vector<Variable>{};
+  for (std::size_t i = 0; i != nvalues; ++i) {
+    points.push_back(getRandomPoint<N>(g));
+  }
+  const auto name = "LocalKriging<" + std::to_string(N) + "> (" +
+                    std::to_string(npoints) + " points)";
+  auto w = typename tfel::math::LocalKriging<N, double>::Workspace{};
+  auto i = std::size_t{};
+  suite.run(name, [&k, &w, &points, &i] {
+    const auto r = k.evaluate(w, points[i]);
+    i = (i + 1) % nvalues;
+    return r;
+  });
+  // batch evaluation of points sharing the same neighbours, as the
+  // integration points of an element
+  auto batch = std::vector<Variable>{};
+  for (std::size_t j = 0; j != nvalues / 8; ++j) {
+    for (std::size_t l = 0; l != 8; ++l) {
+      auto x = points[j];
+      if constexpr (N == 1) {
+        x += 1e-6 * static_cast<double>(l);
+      } else {
+        x[0] += 1e-6 * static_cast<double>(l);
+      }
+      batch.push_back(x);
+    }
+  }
+  auto r = std::vector<double>(batch.size());
+  suite.run(name + " [batch of " + std::to_string(batch.size()) + "]",
+            [&k, &batch, &r] {
+              k.evaluate(r, batch);
+              return r[0];
+            });
+}  // end of benchmarkLocalKriging
+
+int main(const int argc, const char* const* const argv) {
+  try {
+    auto suite = tfel::benchmarks::BenchmarkSuite("Kriging", argc, argv);
+    for (const auto n : {10u, 100u, 1000u}) {
+      benchmark<1u>(suite, n);
+      benchmark<2u>(suite, n);
+      benchmark<3u>(suite, n);
+    }
+    for (const auto n : {1000u, 100000u}) {
+      benchmarkLocalKriging<1u>(suite, n);
+      benchmarkLocalKriging<2u>(suite, n);
+      benchmarkLocalKriging<3u>(suite, n);
+    }
+    return suite.finalize();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+  }
+  return EXIT_FAILURE;
+}  // end of main
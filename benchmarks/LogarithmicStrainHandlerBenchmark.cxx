@@ -0,0 +1,84 @@
+/*!
+ * \file   benchmarks/LogarithmicStrainHandlerBenchmark.cxx
+ * \brief  Benchmarks of the `LogarithmicStrainHandler` class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Math/tensor.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Material/LogarithmicStrainHandler.hxx"
+#include "Benchmark.hxx"
+
+template <unsigned short N>
+static void benchmark(tfel::benchmarks::BenchmarkSuite& suite) {
+  using namespace tfel::math;
+  using tfel::benchmarks::clobber;
+  using LogarithmicStrainHandler =
+      tfel::material::LogarithmicStrainHandler<N, double>;
+  auto g = tfel::benchmarks::RandomNumberGenerator{};
+  auto F = tensor<N, double>::Id();
+  for (auto& v : F) {
+    v += g(-0.1, 0.1);
+  }
+  auto T = stensor<N, double>{};
+  for (auto& v : T) {
+    v = g(-1e8, 1e8);
+  }
+  auto K = st2tost2<N, double>{};
+  for (auto& v : K) {
+    v = g(-1e10, 1e10);
+  }
+  const auto h = LogarithmicStrainHandler(LogarithmicStrainHandler::LAGRANGIAN, F);
+  const auto d = std::to_string(N) + "D";
+  const auto n = "LogarithmicStrainHandler<" + d + ">";
+  suite.run(n + "::LogarithmicStrainHandler", [&F] {
+    clobber(F);
+    return LogarithmicStrainHandler(LogarithmicStrainHandler::LAGRANGIAN, F);
+  });
+  suite.run(n + "::getHenckyLogarithmicStrain", [&F] {
+    clobber(F);
+    const auto lh =
+        LogarithmicStrainHandler(LogarithmicStrainHandler::LAGRANGIAN, F);
+    return lh.getHenckyLogarithmicStrain();
+  });
+  suite.run(n + "::convertToSecondPiolaKirchhoffStress", [&h, &T] {
+    clobber(T);
+    return h.convertToSecondPiolaKirchhoffStress(T);
+  });
+  suite.run(n + "::convertToMaterialTangentModuli", [&h, &K, &T] {
+    clobber(K);
+    clobber(T);
+    return h.convertToMaterialTangentModuli(K, T);
+  });
+  suite.run(n + "::convertToSpatialTangentModuli", [&h, &K, &T] {
+    clobber(K);
+    clobber(T);
+    return h.convertToSpatialTangentModuli(K, T);
+  });
+}  // end of benchmark
+
+int main(const int argc, const char* const* const argv) {
+  try {
+    auto suite = tfel::benchmarks::BenchmarkSuite("LogarithmicStrainHandler",
+                                                  argc, argv);
+    benchmark<1u>(suite);
+    benchmark<2u>(suite);
+    benchmark<3u>(suite);
+    return suite.finalize();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+  }
+  return EXIT_FAILURE;
+}  // end of main
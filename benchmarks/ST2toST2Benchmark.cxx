@@ -0,0 +1,78 @@
+/*!
+ * \file   benchmarks/ST2toST2Benchmark.cxx
+ * \brief  Benchmarks of the products involving fourth order tensors
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "Benchmark.hxx"
+
+template <unsigned short N>
+static void benchmark(tfel::benchmarks::BenchmarkSuite& suite) {
+  using namespace tfel::math;
+  using tfel::benchmarks::clobber;
+  auto g = tfel::benchmarks::RandomNumberGenerator{};
+  auto A = st2tost2<N, double>{};
+  auto B = st2tost2<N, double>{};
+  auto s = stensor<N, double>{};
+  for (auto& v : A) {
+    v = g(-1, 1);
+  }
+  // makes A invertible
+  A += 10 * st2tost2<N, double>::Id();
+  for (auto& v : B) {
+    v = g(-1, 1);
+  }
+  for (auto& v : s) {
+    v = g(-1, 1);
+  }
+  const auto d = std::to_string(N) + "D";
+  suite.run("st2tost2<" + d + "> * st2tost2<" + d + ">", [&A, &B] {
+    clobber(A);
+    clobber(B);
+    return st2tost2<N, double>{A * B};
+  });
+  suite.run("st2tost2<" + d + "> * stensor<" + d + ">", [&A, &s] {
+    clobber(A);
+    clobber(s);
+    return stensor<N, double>{A * s};
+  });
+  suite.run("stensor<" + d + "> * st2tost2<" + d + ">", [&A, &s] {
+    clobber(A);
+    clobber(s);
+    return stensor<N, double>{s * A};
+  });
+  suite.run("stensor<" + d + "> ^ stensor<" + d + ">", [&s] {
+    clobber(s);
+    return st2tost2<N, double>{s ^ s};
+  });
+  suite.run("invert(st2tost2<" + d + ">)", [&A] {
+    clobber(A);
+    return invert(A);
+  });
+}  // end of benchmark
+
+int main(const int argc, const char* const* const argv) {
+  try {
+    auto suite = tfel::benchmarks::BenchmarkSuite("st2tost2", argc, argv);
+    benchmark<1u>(suite);
+    benchmark<2u>(suite);
+    benchmark<3u>(suite);
+    return suite.finalize();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+  }
+  return EXIT_FAILURE;
+}  // end of main
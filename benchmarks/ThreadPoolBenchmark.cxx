@@ -0,0 +1,158 @@
+/*!
+ * \file   benchmarks/ThreadPoolBenchmark.cxx
+ * \brief  This file compares the `ThreadPool` class with a pool based
+ * on a single queue protected by a single mutex, as the one used by
+ * previous versions of TFEL, on a fine-grained workload.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <queue>
+#include <mutex>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include <condition_variable>
+#include "TFEL/System/ThreadPool.hxx"
+#include "Benchmark.hxx"
+
+/*!
+ * \brief a pool of threads sharing a single queue of tasks. The `wait`
+ * method scans the status of all the workers.
+ */
+struct SingleQueueThreadPool {
+  SingleQueueThreadPool(const std::size_t n) : statuses(n, IDLE) {
+    for (std::size_t i = 0; i != n; ++i) {
+      this->workers.emplace_back([this, i] {
+        for (;;) {
+          std::function<void()> task;
+          {
+            std::unique_lock<std::mutex> lock(this->m);
+            this->c.wait(lock,
+                         [this] { return this->stop || !this->tasks.empty(); });
+            if (this->stop && this->tasks.empty()) {
+              return;
+            }
+            task = std::move(this->tasks.front());
+            this->tasks.pop();
+            this->statuses[i] = WORKING;
+            this->c.notify_all();
+          }
+          task();
+          {
+            std::unique_lock<std::mutex> lock(this->m);
+            this->statuses[i] = IDLE;
+            this->c.notify_all();
+          }
+        }
+      });
+    }
+  }
+  template <typename F>
+  void addTask(F&& f) {
+    auto t = std::make_shared<std::packaged_task<void()>>(std::forward<F>(f));
+    {
+      std::unique_lock<std::mutex> lock(this->m);
+      this->tasks.emplace([t] { (*t)(); });
+    }
+    this->c.notify_one();
+  }
+  void wait() {
+    std::unique_lock<std::mutex> lock(this->m);
+    this->c.wait(lock, [this] { return this->tasks.empty(); });
+    for (std::size_t i = 0; i != this->statuses.size(); ++i) {
+      this->c.wait(lock, [this, i] { return this->statuses[i] == IDLE; });
+    }
+  }
+  ~SingleQueueThreadPool() {
+    {
+      std::unique_lock<std::mutex> lock(this->m);
+      this->stop = true;
+    }
+    this->c.notify_all();
+    for (auto& w : this->workers) {
+      w.join();
+    }
+  }
+
+ private:
+  enum Status { WORKING, IDLE };
+  std::vector<Status> statuses;
+  std::vector<std::thread> workers;
+  std::queue<std::function<void()>> tasks;
+  std::mutex m;
+  std::condition_variable c;
+  bool stop = false;
+};
+
+int main(const int argc, const char* const* const argv) {
+  using size_type = tfel::system::ThreadPool::size_type;
+  using tfel::benchmarks::clobber;
+  constexpr size_type n = 100000;
+  constexpr size_type grain = 100;
+  constexpr size_type nthreads = 4;
+  try {
+    auto suite = tfel::benchmarks::BenchmarkSuite("ThreadPool", argc, argv);
+    // a cheap work item, similar to the integration of a simple
+    // behaviour at one integration point
+    auto v = std::vector<double>(n);
+    auto item = [&v](const size_type i) {
+      v[i] = std::sqrt(static_cast<double>(i)) * 1.5 + std::sin(0.001 * i);
+    };
+    auto chunk = [&item](const size_type b, const size_type e) {
+      for (auto i = b; i != e; ++i) {
+        item(i);
+      }
+    };
+    const auto suffix = " (" + std::to_string(n) + " items, chunks of " +
+                        std::to_string(grain) + " items, " +
+                        std::to_string(nthreads) + " threads)";
+    suite.run("sequential" + suffix, [&chunk, &v] {
+      chunk(0, n);
+      clobber(v);
+    });
+    {
+      SingleQueueThreadPool p(nthreads);
+      suite.run("single queue pool, one task per chunk" + suffix,
+                [&p, &chunk, &v] {
+                  for (size_type b = 0; b < n; b += grain) {
+                    p.addTask([&chunk, b, e = std::min(b + grain, n)] {
+                      chunk(b, e);
+                    });
+                  }
+                  p.wait();
+                  clobber(v);
+                });
+    }
+    tfel::system::ThreadPool p(nthreads);
+    suite.run("ThreadPool, one task per chunk" + suffix, [&p, &chunk, &v] {
+      for (size_type b = 0; b < n; b += grain) {
+        p.addTask([&chunk, b, e = std::min(b + grain, n)] { chunk(b, e); });
+      }
+      p.wait();
+      clobber(v);
+    });
+    suite.run("ThreadPool::parallel_for" + suffix, [&p, &item, &v] {
+      p.parallel_for(0, n, grain, item);
+      clobber(v);
+    });
+    return suite.finalize();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+  }
+  return EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,96 @@
+/*!
+ * \file   benchmarks/TinyMatrixSolveBenchmark.cxx
+ * \brief  Benchmarks of the `TinyMatrixSolve` class for increasing sizes
+ * of the linear system.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <memory>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/TinyMatrixSolve.hxx"
+#include "Benchmark.hxx"
+
+/*!
+ * \brief data of a linear system. The data are allocated on the heap as
+ * large systems would overflow the stack.
+ */
+template <unsigned short N>
+struct LinearSystem {
+  //! \brief matrix of the system, which is diagonally dominant
+  tfel::math::tmatrix<N, N, double> m0;
+  //! \brief right hand side
+  tfel::math::tvector<N, double> b0;
+  //! \brief copy of the matrix overwritten by the LU decomposition
+  tfel::math::tmatrix<N, N, double> m;
+  //! \brief copy of the right hand side overwritten by the solution
+  tfel::math::tvector<N, double> x;
+  //! \brief LU decomposition of the matrix
+  tfel::math::tmatrix<N, N, double> lu;
+  //! \brief permutation associated with the LU decomposition
+  tfel::math::TinyPermutation<N> p;
+};
+
+template <unsigned short N>
+static void benchmark(tfel::benchmarks::BenchmarkSuite& suite) {
+  using namespace tfel::math;
+  using tfel::benchmarks::clobber;
+  auto g = tfel::benchmarks::RandomNumberGenerator{};
+  auto s = std::make_unique<LinearSystem<N>>();
+  for (unsigned short i = 0; i != N; ++i) {
+    for (unsigned short j = 0; j != N; ++j) {
+      s->m0(i, j) = g(-1, 1);
+    }
+    s->m0(i, i) += N;
+    s->b0(i) = g(-1, 1);
+  }
+  s->lu = s->m0;
+  TinyMatrixSolve<N, double>::decomp(s->lu, s->p);
+  const auto n = "TinyMatrixSolve<" + std::to_string(N) + ">";
+  // the copy of the system is included in the measured time, since
+  // `TinyMatrixSolve` overwrites its arguments
+  suite.run(n + "::exe", [&s] {
+    clobber(*s);
+    s->m = s->m0;
+    s->x = s->b0;
+    TinyMatrixSolve<N, double>::exe(s->m, s->x);
+    return s->x(0);
+  });
+  suite.run(n + "::back_substitute", [&s] {
+    clobber(*s);
+    s->x = s->b0;
+    TinyMatrixSolve<N, double>::back_substitute(s->lu, s->p, s->x);
+    return s->x(0);
+  });
+}  // end of benchmark
+
+int main(const int argc, const char* const* const argv) {
+  try {
+    auto suite =
+        tfel::benchmarks::BenchmarkSuite("TinyMatrixSolve", argc, argv);
+    benchmark<6u>(suite);
+    benchmark<12u>(suite);
+    benchmark<24u>(suite);
+    benchmark<50u>(suite);
+    benchmark<100u>(suite);
+    benchmark<200u>(suite);
+    // the size of a `tmatrix` is stored in an unsigned short, so larger
+    // systems are not supported
+    benchmark<250u>(suite);
+    return suite.finalize();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+  }
+  return EXIT_FAILURE;
+}  // end of main
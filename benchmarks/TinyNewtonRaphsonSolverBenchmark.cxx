@@ -0,0 +1,103 @@
+/*!
+ * \file   benchmarks/TinyNewtonRaphsonSolverBenchmark.cxx
+ * \brief  Benchmarks of the `TinyNewtonRaphsonSolver` class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Math/TinyNewtonRaphsonSolver.hxx"
+#include "Benchmark.hxx"
+
+/*!
+ * \brief a system of N weakly coupled non linear equations:
+ * \f[
+ * x_{i}+x_{i}^{3}+0.1\,x_{i+1}=c_{i}
+ * \f]
+ */
+template <unsigned short N>
+struct NewtonRaphsonSolver
+    : public tfel::math::
+          TinyNewtonRaphsonSolver<N, double, NewtonRaphsonSolver<N>> {
+  NewtonRaphsonSolver(const tfel::math::tvector<N, double>& v) : c(v) {
+    this->zeros = tfel::math::tvector<N, double>(0);
+    this->epsilon = 1.e-14;
+    this->iterMax = 50;
+  }
+
+  bool solve() { return this->solveNonLinearSystem(); }
+
+  auto getNumberOfIterations() const noexcept { return this->iter; }
+
+  bool computeResidual() noexcept {
+    auto& f = this->fzeros;
+    auto& x = this->zeros;
+    auto& J = this->jacobian;
+    J = tfel::math::tmatrix<N, N, double>(0);
+    for (unsigned short i = 0; i != N; ++i) {
+      f(i) = x(i) + x(i) * x(i) * x(i) - this->c(i);
+      J(i, i) = 1 + 3 * x(i) * x(i);
+      if (i + 1 != N) {
+        f(i) += 0.1 * x(i + 1);
+        J(i, i + 1) = 0.1;
+      }
+    }
+    return true;
+  }  // end of computeResidual
+
+ private:
+  //! \brief right hand side
+  const tfel::math::tvector<N, double> c;
+};  // end of struct NewtonRaphsonSolver
+
+template <unsigned short N>
+static void benchmark(tfel::benchmarks::BenchmarkSuite& suite) {
+  using tfel::benchmarks::clobber;
+  auto g = tfel::benchmarks::RandomNumberGenerator{};
+  auto c = tfel::math::tvector<N, double>{};
+  for (auto& v : c) {
+    v = g(-10, 10);
+  }
+  auto s = NewtonRaphsonSolver<N>(c);
+  if (!s.solve()) {
+    throw std::runtime_error("TinyNewtonRaphsonSolver<" + std::to_string(N) +
+                             ">: resolution failed");
+  }
+  // the number of iterations is part of the name of the benchmark, so
+  // that a change in the convergence of the algorithm is not mistaken
+  // for a change of the performances of an iteration
+  const auto n = "TinyNewtonRaphsonSolver<" + std::to_string(N) + "> (" +
+                 std::to_string(s.getNumberOfIterations()) + " iterations)";
+  suite.run(n, [&c] {
+    clobber(c);
+    auto solver = NewtonRaphsonSolver<N>(c);
+    solver.solve();
+    return solver.getNumberOfIterations();
+  });
+}  // end of benchmark
+
+int main(const int argc, const char* const* const argv) {
+  try {
+    auto suite = tfel::benchmarks::BenchmarkSuite("TinyNewtonRaphsonSolver",
+                                                  argc, argv);
+    benchmark<1u>(suite);
+    benchmark<2u>(suite);
+    benchmark<6u>(suite);
+    benchmark<12u>(suite);
+    benchmark<24u>(suite);
+    return suite.finalize();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+  }
+  return EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,278 @@
+/*!
+ * \file   benchmarks/include/Benchmark.hxx
+ * \brief  A minimal header-only harness used by the micro-benchmarks of
+ * TFEL. Results are printed on the standard output and may be written
+ * in a `JSON` file to be compared between versions of TFEL.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_BENCHMARKS_BENCHMARK_HXX
+#define LIB_TFEL_BENCHMARKS_BENCHMARK_HXX
+
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <cstdlib>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <string_view>
+#include "TFEL/Config/GetTFELVersion.h"
+
+namespace tfel::benchmarks {
+
+  /*!
+   * \brief prevent the compiler from optimizing away the computation of
+   * the given value. The memory clobber also forces the compiler to
+   * assume that any object whose address escaped was modified, so that
+   * the inputs of the benchmarked kernel are reloaded at each call.
+   * \param[in] v: value
+   */
+  template <typename T>
+  inline void doNotOptimize(const T& v) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(v) : "memory");
+#else
+    const volatile auto* p = reinterpret_cast<const volatile char*>(&v);
+    static_cast<void>(*p);
+#endif
+  }  // end of doNotOptimize
+
+  /*!
+   * \brief make the compiler assume that the given object was modified.
+   * This prevents the compiler from hoisting computations depending on
+   * the inputs of a benchmark out of the measurement loop.
+   * \param[in] v: object
+   */
+  template <typename T>
+  inline void clobber(T& v) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : "+m"(v) : : "memory");
+#else
+    doNotOptimize(v);
+#endif
+  }  // end of clobber
+
+  /*!
+   * \brief a simple linear congruential generator returning values in
+   * \f$[a,b]\f$. Contrary to the distributions of the standard library,
+   * the sequence of values does not depend on the implementation, which
+   * makes the inputs of the benchmarks reproducible.
+   */
+  struct RandomNumberGenerator {
+    //! \return a value in [a, b]
+    double operator()(const double a, const double b) noexcept {
+      this->state = this->state * std::uint64_t{6364136223846793005u} +
+                    std::uint64_t{1442695040888963407u};
+      const auto r = static_cast<double>(this->state >> 11) /
+                     static_cast<double>(std::uint64_t{1} << 53);
+      return a + (b - a) * r;
+    }
+    //! \brief current state
+    std::uint64_t state = 20260317u;
+  };  // end of struct RandomNumberGenerator
+
+  //! \brief result of a benchmark
+  struct BenchmarkResult {
+    //! \brief name of the benchmark
+    std::string name;
+    //! \brief number of calls per repetition
+    std::size_t iterations;
+    //! \brief number of repetitions
+    std::size_t repetitions;
+    //! \brief minimal time per call, in nanoseconds
+    double min;
+    //! \brief median time per call, in nanoseconds
+    double median;
+    //! \brief mean time per call, in nanoseconds
+    double mean;
+  };  // end of struct BenchmarkResult
+
+  /*!
+   * \brief a set of benchmarks.
+   *
+   * The following command line options are supported:
+   *
+   * - `--json=<file>`: results are written in the given file.
+   * - `--filter=<string>`: only the benchmarks whose name contains the
+   *   given string are run.
+   * - `--repetitions=<n>`: number of repetitions of each benchmark.
+   * - `--min-time=<t>`: minimal duration of a repetition, in seconds.
+   *
+   * Each benchmark is first called until a repetition lasts at least
+   * `min-time` seconds, which determines the number of calls per
+   * repetition. The minimum, the median and the mean over the
+   * repetitions of the time per call are then reported. The minimum is
+   * the least sensitive to the load of the machine and shall be used to
+   * detect regressions.
+   */
+  struct BenchmarkSuite {
+    /*!
+     * \brief constructor
+     * \param[in] n: name of the suite
+     * \param[in] argc: number of command line arguments
+     * \param[in] argv: command line arguments
+     */
+    BenchmarkSuite(std::string n, const int argc, const char* const* argv)
+        : name(std::move(n)) {
+      auto starts_with = [](std::string_view a, std::string_view b) {
+        return a.substr(0, b.size()) == b;
+      };
+      for (int i = 1; i < argc; ++i) {
+        const auto a = std::string_view{argv[i]};
+        if (starts_with(a, "--json=")) {
+          this->output = std::string{a.substr(7)};
+        } else if (starts_with(a, "--filter=")) {
+          this->filter = std::string{a.substr(9)};
+        } else if (starts_with(a, "--repetitions=")) {
+          this->repetitions = std::stoul(std::string{a.substr(14)});
+          if (this->repetitions == 0) {
+            throw std::invalid_argument("invalid number of repetitions");
+          }
+        } else if (starts_with(a, "--min-time=")) {
+          this->min_time = std::stod(std::string{a.substr(11)});
+        } else {
+          throw std::invalid_argument("unsupported argument '" +
+                                      std::string{a} + "'");
+        }
+      }
+    }  // end of BenchmarkSuite
+    /*!
+     * \brief run a benchmark
+     * \param[in] n: name of the benchmark
+     * \param[in] f: function to be benchmarked. The returned value, if
+     * any, is passed to `doNotOptimize`.
+     */
+    template <typename Function>
+    void run(const std::string& n, Function&& f) {
+      using clock = std::chrono::steady_clock;
+      if ((!this->filter.empty()) &&
+          (n.find(this->filter) == std::string::npos)) {
+        return;
+      }
+      auto call = [&f] {
+        if constexpr (std::is_void_v<decltype(f())>) {
+          f();
+        } else {
+          doNotOptimize(f());
+        }
+      };
+      auto measure = [&call](const std::size_t ni) {
+        const auto start = clock::now();
+        for (std::size_t i = 0; i != ni; ++i) {
+          call();
+        }
+        const auto end = clock::now();
+        return std::chrono::duration<double>(end - start).count();
+      };
+      // calibration
+      auto ni = std::size_t{1};
+      while (true) {
+        const auto t = measure(ni);
+        if ((t >= this->min_time) || (ni >= (std::size_t{1} << 30))) {
+          break;
+        }
+        const auto r = (t > 0) ? 1.2 * this->min_time / t : 10.;
+        ni = static_cast<std::size_t>(
+            std::ceil(static_cast<double>(ni) * std::clamp(r, 1.5, 10.)));
+      }
+      // measures
+      auto times = std::vector<double>{};
+      times.reserve(this->repetitions);
+      for (std::size_t r = 0; r != this->repetitions; ++r) {
+        times.push_back(measure(ni) * 1e9 / static_cast<double>(ni));
+      }
+      std::sort(times.begin(), times.end());
+      const auto nr = times.size();
+      const auto median = (nr % 2 == 1)
+                              ? times[nr / 2]
+                              : (times[nr / 2 - 1] + times[nr / 2]) / 2;
+      const auto mean = std::accumulate(times.begin(), times.end(), 0.) /
+                        static_cast<double>(nr);
+      this->results.push_back({n, ni, nr, times.front(), median, mean});
+      std::cout << std::left << std::setw(80) << n << ' ' << std::right
+                << std::setw(14) << std::fixed << std::setprecision(1)
+                << times.front() << " ns " << std::setw(14) << median
+                << " ns " << std::setw(12) << ni << '\n';
+    }  // end of run
+    /*!
+     * \brief write the results in the `JSON` file, if requested.
+     * \return the exit status of the benchmark executable
+     */
+    int finalize() const {
+      if (this->output.empty()) {
+        return EXIT_SUCCESS;
+      }
+      std::ofstream out(this->output);
+      if (!out) {
+        std::cerr << "can't open file '" << this->output << "'\n";
+        return EXIT_FAILURE;
+      }
+      out.precision(6);
+      out << "{\n"
+          << "  \"suite\": \"" << this->name << "\",\n"
+          << "  \"context\": {\n"
+          << "    \"tfel_version\": \"" << getTFELVersion() << "\",\n"
+          << "    \"compiler\": \"" << getCompilerVersion() << "\",\n"
+          << "    \"repetitions\": " << this->repetitions << ",\n"
+          << "    \"min_time\": " << this->min_time << ",\n"
+          << "    \"time_unit\": \"ns\"\n"
+          << "  },\n"
+          << "  \"benchmarks\": [";
+      auto first = true;
+      for (const auto& r : this->results) {
+        out << (first ? "\n" : ",\n") << "    {\"name\": \"" << r.name
+            << "\", \"iterations\": " << r.iterations
+            << ", \"repetitions\": " << r.repetitions
+            << ", \"min\": " << r.min << ", \"median\": " << r.median
+            << ", \"mean\": " << r.mean << "}";
+        first = false;
+      }
+      out << "\n  ]\n}\n";
+      return out ? EXIT_SUCCESS : EXIT_FAILURE;
+    }  // end of finalize
+
+   private:
+    //! \return a description of the compiler
+    static std::string getCompilerVersion() {
+#if defined(__clang__)
+      return "clang " __clang_version__;
+#elif defined(__GNUC__)
+      return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+      return "msvc " + std::to_string(_MSC_VER);
+#else
+      return "unknown";
+#endif
+    }  // end of getCompilerVersion
+    //! \brief name of the suite
+    const std::string name;
+    //! \brief output file
+    std::string output;
+    //! \brief filter
+    std::string filter;
+    //! \brief number of repetitions
+    std::size_t repetitions = 10;
+    //! \brief minimal time of a repetition, in seconds
+    double min_time = 0.01;
+    //! \brief results
+    std::vector<BenchmarkResult> results;
+  };  // end of struct BenchmarkSuite
+
+}  // end of namespace tfel::benchmarks
+
+#endif /* LIB_TFEL_BENCHMARKS_BENCHMARK_HXX */
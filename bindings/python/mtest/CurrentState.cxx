@@ -12,6 +12,9 @@
  */
 
 #include <boost/python.hpp>
+#ifdef TFEL_NUMPY_SUPPORT
+#include <boost/python/numpy.hpp>
+#endif /* TFEL_NUMPY_SUPPORT */
 #include "TFEL/Raise.hxx"
 #include "TFEL/Material/ModellingHypothesis.hxx"
 #include "MTest/Behaviour.hxx"
@@ -38,6 +41,65 @@ TFEL_PYTHON_CURRENTSTATEGETTER(iv1)
 TFEL_PYTHON_CURRENTSTATEGETTER(esv0)
 TFEL_PYTHON_CURRENTSTATEGETTER(desv)
 
+#ifdef TFEL_NUMPY_SUPPORT
+
+tfel::math::vector<mtest::real>& getCurrentStateField(mtest::CurrentState&,
+                                                      const std::string&);
+
+boost::python::numpy::ndarray makeNumpyView(tfel::math::vector<mtest::real>&,
+                                            boost::python::object);
+
+tfel::math::vector<mtest::real>& getCurrentStateField(mtest::CurrentState& s,
+                                                      const std::string& n) {
+  if (n == "s_1") {
+    return s.s_1;
+  } else if (n == "s0") {
+    return s.s0;
+  } else if (n == "s1") {
+    return s.s1;
+  } else if (n == "e0") {
+    return s.e0;
+  } else if (n == "e1") {
+    return s.e1;
+  } else if (n == "e_th0") {
+    return s.e_th0;
+  } else if (n == "e_th1") {
+    return s.e_th1;
+  } else if (n == "mprops1") {
+    return s.mprops1;
+  } else if (n == "iv_1") {
+    return s.iv_1;
+  } else if (n == "iv0") {
+    return s.iv0;
+  } else if (n == "iv1") {
+    return s.iv1;
+  } else if (n == "esv0") {
+    return s.esv0;
+  } else if (n == "desv") {
+    return s.desv;
+  }
+  tfel::raise("getCurrentStateField: invalid field '" + n + "'");
+}  // end of getCurrentStateField
+
+boost::python::numpy::ndarray makeNumpyView(
+    tfel::math::vector<mtest::real>& v, boost::python::object owner) {
+  namespace np = boost::python::numpy;
+  const auto dt = np::dtype::get_builtin<mtest::real>();
+  if (v.empty()) {
+    return np::empty(boost::python::make_tuple(0), dt);
+  }
+  return np::from_data(v.data(), dt, boost::python::make_tuple(v.size()),
+                       boost::python::make_tuple(sizeof(mtest::real)), owner);
+}  // end of makeNumpyView
+
+static boost::python::numpy::ndarray CurrentState_getView(
+    boost::python::object o, const std::string& n) {
+  auto& s = boost::python::extract<mtest::CurrentState&>(o)();
+  return makeNumpyView(getCurrentStateField(s, n), o);
+}  // end of CurrentState_getView
+
+#endif /* TFEL_NUMPY_SUPPORT */
+
 static tfel::math::vector<mtest::CurrentState>::iterator v_begin(
     tfel::math::vector<mtest::CurrentState>& s) {
   return s.begin();
@@ -146,8 +208,8 @@ void declareCurrentState() {
   object (*ptr6)(const mtest::CurrentState&, const std::string&, const int) =
       ::getInternalStateVariableValue;
 
-  class_<mtest::CurrentState>("CurrentState")
-      .add_property("s_1", CurrentState_gets_1)
+  auto c = class_<mtest::CurrentState>("CurrentState");
+  c.add_property("s_1", CurrentState_gets_1)
       .add_property("s0", CurrentState_gets0)
       .add_property("s1", CurrentState_gets1)
       .add_property("e0", CurrentState_gete0)
@@ -228,6 +290,24 @@ void declareCurrentState() {
            "current time step\n"
            "- 1 means that we request the  value at the end of the current "
            "time step");
+#ifdef TFEL_NUMPY_SUPPORT
+  c.def("getView", CurrentState_getView,
+        "return a numpy array sharing its data with a field of the current "
+        "state\n"
+        "\n"
+        "param[in]  n: field name, i.e. one of `s_1`, `s0`, `s1`, `e0`, "
+        "`e1`,\n"
+        "              `e_th0`, `e_th1`, `mprops1`, `iv_1`, `iv0`, `iv1`, "
+        "`esv0`\n"
+        "              or `desv`\n"
+        "\n"
+        "Contrary to the properties of the same name, no copy is made: "
+        "modifying\n"
+        "the returned array modifies the current state. The array is "
+        "invalidated\n"
+        "if the field is resized, for instance when the current state is "
+        "initialized.");
+#endif /* TFEL_NUMPY_SUPPORT */
 
   class_<tfel::math::vector<mtest::CurrentState>>("CurrentStateVector")
       .def("__iter__",
@@ -830,6 +830,49 @@ static void MTest_addEvent(mtest::MTest& m,
   m.addEvent(n, std::vector<mtest::real>(1u, t));
 }  // end of MTest_addEvent
 
+static std::map<std::string, std::vector<mtest::real>> MTest_convertVariants(
+    const boost::python::dict& d) {
+  using boost::python::extract;
+  auto v = std::map<std::string, std::vector<mtest::real>>{};
+  const auto keys = d.keys();
+  for (boost::python::ssize_t i = 0; i != boost::python::len(keys); ++i) {
+    const std::string k = extract<std::string>(keys[i]);
+    v[k] = extract<std::vector<mtest::real>>(d[k]);
+  }
+  return v;
+}  // end of MTest_convertVariants
+
+static mtest::MTest::SweepResults MTest_sweep1(mtest::MTest& m,
+                                               const boost::python::dict& d) {
+  return m.sweep(MTest_convertVariants(d));
+}  // end of MTest_sweep1
+
+static mtest::MTest::SweepResults MTest_sweep2(mtest::MTest& m,
+                                               const boost::python::dict& d,
+                                               const std::size_t n) {
+  return m.sweep(MTest_convertVariants(d), n);
+}  // end of MTest_sweep2
+
+static std::vector<mtest::real> MTestSweepResults_getTimes(
+    const mtest::MTest::SweepResults& r) {
+  return r.times;
+}  // end of MTestSweepResults_getTimes
+
+static std::vector<std::string> MTestSweepResults_getNames(
+    const mtest::MTest::SweepResults& r) {
+  return r.names;
+}  // end of MTestSweepResults_getNames
+
+static std::vector<std::string> MTestSweepResults_getErrors(
+    const mtest::MTest::SweepResults& r) {
+  return r.errors;
+}  // end of MTestSweepResults_getErrors
+
+static std::vector<mtest::real> MTestSweepResults_getOutput(
+    const mtest::MTest::SweepResults& r, const std::string& n) {
+  return r.getOutput(n);
+}  // end of MTestSweepResults_getOutput
+
 void declareMTest();
 
 void declareMTest() {
@@ -928,6 +971,18 @@ void declareMTest() {
            "- 1 means that we request the  value at the end of the current "
            "time step");
 
+  class_<MTest::SweepResults>("MTestSweepResults")
+      .add_property("times", MTestSweepResults_getTimes,
+                    "times at which the outputs are evaluated")
+      .add_property("names", MTestSweepResults_getNames, "names of the outputs")
+      .add_property("errors", MTestSweepResults_getErrors,
+                    "error message associated with each variant. This "
+                    "message is empty if the computation succeeded")
+      .def("getOutput", MTestSweepResults_getOutput,
+           "return the values of an output. The value of the output "
+           "for the i-th variant at the k-th time is stored at index "
+           "i * len(times) + k");
+
   TestResult (MTest::*pm)(const bool) = &MTest::execute;
   TestResult (MTest::*pm2)() = &MTest::execute;
   void (MTest::*pm3)(StudyCurrentState&, SolverWorkSpace&, const real,
@@ -1288,6 +1343,17 @@ void declareMTest() {
            "    - the behaviour' internal state variables\n"
            "    - the behaviour' external state variables\n"
            "    - any evolution defined in the input file\n")
+      .def("sweep", MTest_sweep1, (arg("variants")))
+      .def("sweep", MTest_sweep2, (arg("variants"), "number_of_threads"),
+           "treat variants of the test sharing the same initialisation.\n"
+           "\n"
+           "param[in] variants: dictionary associating to the name of a\n"
+           "material property, an external state variable or a real\n"
+           "parameter the list of its values for each variant\n"
+           "param[in] number_of_threads: number of threads\n"
+           "\n"
+           "The tests, the user defined post-processings and the output\n"
+           "files are not considered when treating the variants.")
       .def("setCompareToNumericalTangentOperator",
            &MTest::setCompareToNumericalTangentOperator,
            "set if a comparison of the tangent operator returned by the "
@@ -160,6 +160,24 @@ static void PipeTest_setElementType(mtest::PipeTest& t, const std::string& e) {
   }
 }  // end of PipeTest_setElementType
 
+static void PipeTest_setStiffnessMatrixStorage(mtest::PipeTest& t,
+                                               const std::string& s) {
+  if (s == "Skyline") {
+    t.setStiffnessMatrixStorage(mtest::SolverWorkSpace::SKYLINESTORAGE);
+  } else if (s == "Dense") {
+    t.setStiffnessMatrixStorage(mtest::SolverWorkSpace::DENSESTORAGE);
+  } else if (s == "Sparse") {
+    t.setStiffnessMatrixStorage(mtest::SolverWorkSpace::SPARSESTORAGE);
+  } else {
+    tfel::raise(
+        "PipeTest::setStiffnessMatrixStorage: "
+        "invalid stiffness matrix storage ('" +
+        s +
+        "').\n"
+        "Valid storages are 'Skyline', 'Dense' and 'Sparse'");
+  }
+}  // end of PipeTest_setStiffnessMatrixStorage
+
 void declarePipeTest();
 
 void declarePipeTest() {
@@ -292,6 +310,13 @@ void declarePipeTest() {
            "is user-specified. See the 'setOuterRadiusEvolution' "
            "method for details.\n")
       .def("setElementType", &PipeTest_setElementType)
+      .def("setStiffnessMatrixStorage", &PipeTest_setStiffnessMatrixStorage,
+           "set how the global stiffness matrix is stored. Valid values "
+           "are 'Skyline' (default), 'Dense' and 'Sparse'")
+      .def("setNumberOfThreads", &PipeTest::setNumberOfThreads,
+           "set the number of threads used to integrate the behaviour "
+           "at the Gauss points. The results do not depend on the number "
+           "of threads")
       .def("addProfile", &PipeTest::addProfile)
       .def("computeMinimumValue",
            static_cast<real (PipeTest::*)(const StudyCurrentState&,
@@ -88,6 +88,19 @@ static void setOutputFrequency(mtest::SchemeBase& s, const std::string& v) {
   }
 }
 
+static void setOutputFileFormat(mtest::SchemeBase& s, const std::string& v) {
+  if (v == "Text") {
+    s.setOutputFileFormat(mtest::SchemeBase::TEXTFORMAT);
+  } else if (v == "Binary") {
+    s.setOutputFileFormat(mtest::SchemeBase::BINARYFORMAT);
+  } else {
+    tfel::raise(
+        "SchemeBase::setOutputFileFormat: "
+        "invalid format '" +
+        v + "'");
+  }
+}
+
 static void SchemeBase_printOutput(mtest::SchemeBase& s,
                                    const mtest::real t,
                                    const mtest::StudyCurrentState& scs) {
@@ -296,6 +309,14 @@ void declareSchemeBase() {
            "- 'EveryIteration': the outputs are written after each "
            "successful iteration.\n"
            "Note : These options only differs in case of substepping.")
+      .def("setOutputFileFormat", setOutputFileFormat,
+           "This method specify the format of the output file.\n"
+           "* The parameter (string) specify the choosen format. "
+           "The two allowed formats are:\n"
+           "- 'Text': the results are written in a text file (default).\n"
+           "- 'Binary': the results are written in a binary file "
+           "following the `npy` format of `numpy`. Each column is "
+           "named after the variable it stores.")
       .def("resetOutputFile", &SchemeBase::resetOutputFile,
            "close and reopen the output files");
 }
@@ -11,7 +11,13 @@
  * project under specific licensing conditions.
  */
 
+#include <algorithm>
 #include <boost/python.hpp>
+#ifdef TFEL_NUMPY_SUPPORT
+#include <boost/python/numpy.hpp>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Numpy/ndarray.hxx"
+#endif /* TFEL_NUMPY_SUPPORT */
 #include "MTest/CurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
 
@@ -20,11 +26,120 @@ static tfel::math::vector<mtest::CurrentState>& get_istates(
   return scs.istates;
 }
 
+#ifdef TFEL_NUMPY_SUPPORT
+
+tfel::math::vector<mtest::real>& getCurrentStateField(mtest::CurrentState&,
+                                                      const std::string&);
+
+boost::python::numpy::ndarray makeNumpyView(tfel::math::vector<mtest::real>&,
+                                            boost::python::object);
+
+//! \return the size of a field, which must be the same for all the
+//! integration points
+static std::size_t getFieldSize(mtest::StructureCurrentState& s,
+                                const std::string& n) {
+  if (s.istates.empty()) {
+    return 0;
+  }
+  const auto size = getCurrentStateField(s.istates[0], n).size();
+  for (auto& is : s.istates) {
+    tfel::raise_if(getCurrentStateField(is, n).size() != size,
+                   "StructureCurrentState::getFieldSize: "
+                   "the size of the field '" +
+                       n + "' is not the same for all integration points");
+  }
+  return size;
+}  // end of getFieldSize
+
+static boost::python::list StructureCurrentState_getViews(
+    boost::python::object o, const std::string& n) {
+  auto& s = boost::python::extract<mtest::StructureCurrentState&>(o)();
+  auto views = boost::python::list{};
+  for (auto& is : s.istates) {
+    views.append(makeNumpyView(getCurrentStateField(is, n), o));
+  }
+  return views;
+}  // end of StructureCurrentState_getViews
+
+static boost::python::numpy::ndarray StructureCurrentState_getValues(
+    mtest::StructureCurrentState& s, const std::string& n) {
+  namespace np = boost::python::numpy;
+  const auto nip = s.istates.size();
+  const auto size = getFieldSize(s, n);
+  auto r = np::empty(boost::python::make_tuple(nip, size),
+                     np::dtype::get_builtin<mtest::real>());
+  auto* const p = reinterpret_cast<mtest::real*>(r.get_data());
+  for (std::size_t i = 0; i != nip; ++i) {
+    const auto& v = getCurrentStateField(s.istates[i], n);
+    std::copy(v.begin(), v.end(), p + i * size);
+  }
+  return r;
+}  // end of StructureCurrentState_getValues
+
+static void StructureCurrentState_setValues(
+    mtest::StructureCurrentState& s,
+    const std::string& n,
+    boost::python::numpy::ndarray& a) {
+  const auto nip = s.istates.size();
+  const auto size = getFieldSize(s, n);
+  tfel::raise_if((a.get_nd() != 2) ||
+                     (static_cast<std::size_t>(a.shape(0)) != nip) ||
+                     (static_cast<std::size_t>(a.shape(1)) != size),
+                 "StructureCurrentState::setValues: "
+                 "invalid array shape");
+  // arrays of another type (integers, single precision floating point
+  // numbers, etc.) are converted
+  const auto b = [&a]() -> boost::python::numpy::ndarray {
+    const auto t = boost::python::numpy::dtype::get_builtin<mtest::real>();
+    if (a.get_dtype() == t) {
+      return a;
+    }
+    return a.astype(t);
+  }();
+  // the array may not be contiguous
+  const auto* const p = reinterpret_cast<const char*>(tfel::numpy::get_data(b));
+  const auto* const strides = b.get_strides();
+  for (std::size_t i = 0; i != nip; ++i) {
+    auto& v = getCurrentStateField(s.istates[i], n);
+    for (std::size_t j = 0; j != size; ++j) {
+      v[j] = *reinterpret_cast<const mtest::real*>(p + i * strides[0] +
+                                                   j * strides[1]);
+    }
+  }
+}  // end of StructureCurrentState_setValues
+
+#endif /* TFEL_NUMPY_SUPPORT */
+
 void declareStructureCurrentState();
 
 void declareStructureCurrentState() {
   using namespace boost::python;
-  class_<mtest::StructureCurrentState>("StructureCurrentState")
-      .add_property("istates",
-                    make_function(&get_istates, return_internal_reference<>()));
+  auto c = class_<mtest::StructureCurrentState>("StructureCurrentState");
+  c.add_property("istates",
+                 make_function(&get_istates, return_internal_reference<>()));
+#ifdef TFEL_NUMPY_SUPPORT
+  c.def("getViews", StructureCurrentState_getViews,
+        "return a list of numpy arrays sharing their data with a field of "
+        "the\n"
+        "current states of the integration points. No copy is made.\n"
+        "\n"
+        "param[in]  n: field name (see `CurrentState.getView`)")
+      .def("getValues", StructureCurrentState_getValues,
+           "return a new two dimensional numpy array containing the values "
+           "of a\n"
+           "field at all the integration points. The values of the i-th "
+           "integration\n"
+           "point are stored in the i-th row.\n"
+           "\n"
+           "param[in]  n: field name (see `CurrentState.getView`)")
+      .def("setValues", StructureCurrentState_setValues,
+           "set the values of a field at all the integration points from a "
+           "two\n"
+           "dimensional numpy array, as returned by the `getValues` "
+           "method. Arrays of another type than `numpy.float64` are\n"
+           "converted.\n"
+           "\n"
+           "param[in]  n: field name (see `CurrentState.getView`)\n"
+           "param[in]  a: values");
+#endif /* TFEL_NUMPY_SUPPORT */
 }  // end of declareStructureCurrentState
@@ -12,6 +12,10 @@
  */
 
 #include <boost/python.hpp>
+#ifdef TFEL_NUMPY_SUPPORT
+#include <boost/python/numpy.hpp>
+#include "TFEL/Raise.hxx"
+#endif /* TFEL_NUMPY_SUPPORT */
 #include "MTest/Evolution.hxx"
 #include "MTest/StudyCurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
@@ -40,11 +44,36 @@ static double StudyCurrentState_getEvolutionValue(mtest::StudyCurrentState& s,
   return s.getEvolution(n)(t);
 }
 
+#ifdef TFEL_NUMPY_SUPPORT
+
+boost::python::numpy::ndarray makeNumpyView(tfel::math::vector<mtest::real>&,
+                                            boost::python::object);
+
+static boost::python::numpy::ndarray StudyCurrentState_getView(
+    boost::python::object o, const std::string& n) {
+  auto& s = boost::python::extract<mtest::StudyCurrentState&>(o)();
+  auto& v = [&s, &n]() -> tfel::math::vector<mtest::real>& {
+    if (n == "u_1") {
+      return s.u_1;
+    } else if (n == "u0") {
+      return s.u0;
+    } else if (n == "u1") {
+      return s.u1;
+    } else if (n == "u10") {
+      return s.u10;
+    }
+    tfel::raise("StudyCurrentState::getView: invalid field '" + n + "'");
+  }();
+  return makeNumpyView(v, o);
+}  // end of StudyCurrentState_getView
+
+#endif /* TFEL_NUMPY_SUPPORT */
+
 void declareStudyCurrentState() {
   using mtest::StudyCurrentState;
 
-  boost::python::class_<StudyCurrentState>("StudyCurrentState")
-      .add_property("u_1", StudyCurrentState_getu_1)
+  auto c = boost::python::class_<StudyCurrentState>("StudyCurrentState");
+  c.add_property("u_1", StudyCurrentState_getu_1)
       .add_property("u0", StudyCurrentState_getu0)
       .add_property("u1", StudyCurrentState_getu1)
       .add_property("u10", StudyCurrentState_getu10)
@@ -65,4 +94,12 @@ void declareStudyCurrentState() {
            &mtest::StudyCurrentState::setNumberOfFailureCriterionStatus)
       .def("getNumberOfFailureCriterionStatus",
            &mtest::StudyCurrentState::getNumberOfFailureCriterionStatus);
+#ifdef TFEL_NUMPY_SUPPORT
+  c.def("getView", StudyCurrentState_getView,
+        "return a numpy array sharing its data with the unknowns\n"
+        "\n"
+        "param[in]  n: field name, i.e. one of `u_1`, `u0`, `u1` or `u10`\n"
+        "\n"
+        "Contrary to the properties of the same name, no copy is made.");
+#endif /* TFEL_NUMPY_SUPPORT */
 }
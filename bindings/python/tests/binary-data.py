@@ -0,0 +1,71 @@
+import os
+try:
+    import unittest2 as unittest
+except ImportError:
+    import unittest
+import numpy
+import tfel.utilities
+import mtest
+
+
+class BinaryDataTest(unittest.TestCase):
+    def test1(self):
+        # writing and reading a file
+        w = tfel.utilities.BinaryDataWriter('binary-data-test1.npy',
+                                            ['a', 'b'])
+        self.assertTrue(w.getNumberOfColumns() == 2)
+        for i in range(0, 3):
+            w.write([i, 2 * i + 0.5])
+        w.flush()
+        self.assertTrue(w.getNumberOfLines() == 3)
+        del w
+        self.assertTrue(
+            tfel.utilities.BinaryData.isBinaryDataFile(
+                'binary-data-test1.npy'))
+        d = tfel.utilities.BinaryData('binary-data-test1.npy')
+        self.assertTrue(d.getNumberOfColumns() == 2)
+        self.assertTrue(d.getNumberOfLines() == 3)
+        self.assertTrue(list(d.getLegends()) == ['a', 'b'])
+        self.assertTrue(d.findColumn('b') == 2)
+        self.assertTrue(list(d.getColumn(1)) == [0, 1, 2])
+        self.assertTrue(list(d.getColumn('b')) == [0.5, 2.5, 4.5])
+        # the file can be read by numpy
+        r = numpy.load('binary-data-test1.npy')
+        self.assertTrue(list(r.dtype.names) == ['a', 'b'])
+        self.assertTrue(numpy.array_equal(r['b'], [0.5, 2.5, 4.5]))
+
+    def test2(self):
+        # binary and text outputs of mtest hold the same values
+        for f in ['Text', 'Binary']:
+            m = self.getMTest()
+            m.setOutputFileName('binary-data-test2-' + f + '.res')
+            m.setOutputFileFormat(f)
+            m.execute()
+            del m
+        t = tfel.utilities.TextData('binary-data-test2-Text.res')
+        d = tfel.utilities.BinaryData('binary-data-test2-Binary.res')
+        self.assertTrue(d.getLegend(1) == 't')
+        self.assertTrue(d.getNumberOfLines() == 11)
+        for n, c in [('EXX', 2), ('SXX', 8), ('SYY', 9)]:
+            self.assertTrue(d.findColumn(n) == c)
+            self.assertTrue(
+                numpy.allclose(d.getColumn(c), t.getColumn(c),
+                               rtol=1.e-12, atol=1.e-3))
+        with self.assertRaises(RuntimeError):
+            self.getMTest().setOutputFileFormat('Unknown')
+
+    def getMTest(self):
+        l = os.environ['MTEST_BEHAVIOUR_LIBRARY']
+        m = mtest.MTest()
+        m.setModellingHypothesis('Tridimensional')
+        m.setBehaviour('generic', l, 'ImplicitNorton')
+        m.setMaterialProperty('YoungModulus', 150e9)
+        m.setMaterialProperty('PoissonRatio', 0.3)
+        m.setExternalStateVariable('Temperature', 293.15)
+        m.setImposedStrain('EXX', {0: 0, 1: 1.e-3})
+        m.setTimes([0.1 * i for i in range(0, 11)])
+        return m
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,44 @@
+try:
+    import unittest2 as unittest
+except ImportError:
+    import unittest
+import numpy
+import tfel.math
+
+
+class EvaluatorTest(unittest.TestCase):
+    def test1(self):
+        e = tfel.math.Evaluator('2*x+y')
+        x = numpy.linspace(0., 1., 10)
+        y = numpy.linspace(1., 2., 10)
+        r = e.evaluate({'x': x, 'y': y})
+        self.assertTrue(numpy.allclose(r, 2 * x + y, rtol=1e-14))
+
+    def test2(self):
+        # strided views are rejected
+        e = tfel.math.Evaluator('2*x+y')
+        x = numpy.linspace(0., 1., 20)
+        y = numpy.linspace(1., 2., 10)
+        with self.assertRaises(RuntimeError):
+            e.evaluate({'x': x[::2], 'y': y})
+        xy = numpy.column_stack((x[:10], y))
+        with self.assertRaises(RuntimeError):
+            e.evaluate({'x': xy[:, 0], 'y': xy[:, 1]})
+        r = e.evaluate({
+            'x': numpy.ascontiguousarray(x[::2]),
+            'y': numpy.ascontiguousarray(xy[:, 1])
+        })
+        self.assertTrue(numpy.allclose(r, 2 * x[::2] + y, rtol=1e-14))
+
+    def test3(self):
+        # only float64 values are accepted
+        e = tfel.math.Evaluator('2*x')
+        x = numpy.arange(10, dtype=numpy.float32)
+        with self.assertRaises(RuntimeError):
+            e.evaluate({'x': x})
+        r = e.evaluate({'x': x.astype(numpy.float64)})
+        self.assertTrue(numpy.allclose(r, 2 * x, rtol=1e-14))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,58 @@
+import os
+try:
+    import unittest2 as unittest
+except ImportError:
+    import unittest
+import numpy
+import mtest
+
+
+class StructureCurrentStateSetValues(unittest.TestCase):
+    def test1(self):
+        # double precision arrays are written as is
+        s = self.getStructureCurrentState()
+        v = numpy.arange(7, dtype=numpy.float64).reshape(1, 7)
+        s.setValues('iv1', v)
+        self.assertTrue(numpy.array_equal(s.getValues('iv1'), v))
+
+    def test2(self):
+        # single precision and integer arrays are converted
+        s = self.getStructureCurrentState()
+        for t in [numpy.float32, numpy.int32, numpy.int64]:
+            v = numpy.arange(1, 8, dtype=t).reshape(1, 7)
+            s.setValues('iv1', v)
+            r = s.getValues('iv1')
+            self.assertTrue(r.dtype == numpy.float64)
+            self.assertTrue(numpy.array_equal(r, v.astype(numpy.float64)))
+
+    def test3(self):
+        # non contiguous arrays
+        s = self.getStructureCurrentState()
+        v = numpy.arange(14, dtype=numpy.float32).reshape(7, 2).T[:1, :]
+        self.assertFalse(v.flags['C_CONTIGUOUS'])
+        s.setValues('iv1', v)
+        self.assertTrue(
+            numpy.array_equal(s.getValues('iv1'), v.astype(numpy.float64)))
+
+    def test4(self):
+        # invalid shapes are rejected
+        s = self.getStructureCurrentState()
+        with self.assertRaises(RuntimeError):
+            s.setValues('iv1', numpy.zeros((1, 6), dtype=numpy.float32))
+
+    def getStructureCurrentState(self):
+        l = os.environ['MTEST_BEHAVIOUR_LIBRARY']
+        m = mtest.MTest()
+        m.setModellingHypothesis('Tridimensional')
+        m.setBehaviour('generic', l, 'ImplicitNorton')
+        m.setMaterialProperty('YoungModulus', 150e9)
+        m.setMaterialProperty('PoissonRatio', 0.3)
+        m.setExternalStateVariable('Temperature', 293.15)
+        m.completeInitialisation()
+        self.s = mtest.MTestCurrentState()
+        m.initializeCurrentState(self.s)
+        return self.s.getStructureCurrentState('')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,71 @@
+/*!
+ * \file  bindings/python/tfel/BinaryData.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <boost/python.hpp>
+#include "TFEL/Utilities/BinaryData.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
+
+void declareBinaryData();
+
+static std::vector<double> BinaryData_getColumn(
+    const tfel::utilities::BinaryData& d,
+    const tfel::utilities::BinaryData::size_type c) {
+  return d.getColumn(c);
+}  // end of BinaryData_getColumn
+
+static std::vector<double> BinaryData_getColumn2(
+    const tfel::utilities::BinaryData& d, const std::string& n) {
+  return d.getColumn(d.findColumn(n));
+}  // end of BinaryData_getColumn2
+
+static std::vector<std::string> BinaryData_getLegends(
+    const tfel::utilities::BinaryData& d) {
+  return d.getLegends();
+}  // end of BinaryData_getLegends
+
+static void BinaryDataWriter_write(tfel::utilities::BinaryDataWriter& w,
+                                   const std::vector<double>& v) {
+  w.write(v);
+}  // end of BinaryDataWriter_write
+
+void declareBinaryData() {
+  using namespace boost::python;
+  using namespace tfel::utilities;
+
+  class_<BinaryData, boost::noncopyable>("BinaryData", no_init)
+      .def(init<std::string>())
+      .def(init<std::string, bool>())
+      .def("isBinaryDataFile", &BinaryData::isBinaryDataFile,
+           "return true if the given file follows the `npy` format")
+      .staticmethod("isBinaryDataFile")
+      .def("getNumberOfColumns", &BinaryData::getNumberOfColumns)
+      .def("getNumberOfLines", &BinaryData::getNumberOfLines)
+      .def("getColumn", BinaryData_getColumn,
+           "return the column of the given index (starting from 1)")
+      .def("getColumn", BinaryData_getColumn2,
+           "return the column of the given name")
+      .def("findColumn", &BinaryData::findColumn)
+      .def("getLegends", BinaryData_getLegends)
+      .def("getLegend", &BinaryData::getLegend)
+      .def("skipLines", &BinaryData::skipLines);
+
+  class_<BinaryDataWriter, boost::noncopyable>("BinaryDataWriter", no_init)
+      .def(init<std::string, std::vector<std::string>>())
+      .def("getNumberOfColumns", &BinaryDataWriter::getNumberOfColumns)
+      .def("getNumberOfLines", &BinaryDataWriter::getNumberOfLines)
+      .def("write", BinaryDataWriter_write,
+           "append a line to the file")
+      .def("flush", &BinaryDataWriter::flush,
+           "update the header of the file and flush it");
+
+}  // end of declareBinaryData
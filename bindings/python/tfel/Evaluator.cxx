@@ -11,9 +11,57 @@
  * project under specific licensing conditions.
  */
 
+#include <span>
 #include <boost/python.hpp>
+#ifdef TFEL_NUMPY_SUPPORT
+#include <boost/python/numpy.hpp>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Numpy/ndarray.hxx"
+#endif /* TFEL_NUMPY_SUPPORT */
 #include "TFEL/Math/Evaluator.hxx"
 
+#ifdef TFEL_NUMPY_SUPPORT
+
+static boost::python::numpy::ndarray Evaluator_evaluate(
+    tfel::math::Evaluator& e, const boost::python::dict& d) {
+  namespace np = boost::python::numpy;
+  const auto names = e.getVariablesNames();
+  tfel::raise_if(names.empty(),
+                 "Evaluator::evaluate: "
+                 "the formula does not depend on any variable");
+  auto values = std::vector<np::ndarray>{};
+  auto columns = std::vector<std::span<const double>>{};
+  for (const auto& n : names) {
+    tfel::raise_if(!d.has_key(n),
+                   "Evaluator::evaluate: "
+                   "no values given for variable '" +
+                       n + "'");
+    values.push_back(boost::python::extract<np::ndarray>(d[n]));
+    const auto& a = values.back();
+    // the values are read as a contiguous block: strided views (for
+    // example `a[::2]` or a column of a two dimensional array) would be
+    // silently misread
+    tfel::raise_if(!(a.get_flags() & np::ndarray::C_CONTIGUOUS),
+                   "Evaluator::evaluate: "
+                   "the values given for variable '" +
+                       n +
+                       "' are not stored contiguously "
+                       "(use numpy.ascontiguousarray)");
+    tfel::raise_if(a.get_dtype() != np::dtype::get_builtin<double>(),
+                   "Evaluator::evaluate: "
+                   "the values given for variable '" +
+                       n + "' are not of type float64");
+    columns.emplace_back(tfel::numpy::get_data(a), tfel::numpy::get_size(a));
+  }
+  const auto s = columns.front().size();
+  auto r = np::empty(boost::python::make_tuple(s),
+                     np::dtype::get_builtin<double>());
+  e.evaluate(columns, std::span<double>(tfel::numpy::get_data(r), s));
+  return r;
+}  // end of Evaluator_evaluate
+
+#endif /* TFEL_NUMPY_SUPPORT */
+
 void declareEvaluator();
 
 void declareEvaluator() {
@@ -27,8 +75,8 @@ void declareEvaluator() {
       &Evaluator::getValue;
   void (Evaluator::*ptr5)(const std::string&, const double) =
       &Evaluator::setVariableValue;
-  class_<Evaluator>("Evaluator", init<std::string>())
-      .def("__call__", ptr1, "evaluates the formula")
+  auto c = class_<Evaluator>("Evaluator", init<std::string>());
+  c.def("__call__", ptr1, "evaluates the formula")
       .def("__call__", ptr2, "evaluates the formula")
       .def("getValue", ptr3, "evaluates the formula")
       .def("getValue", ptr4, "evaluates the formula")
@@ -36,5 +84,17 @@ void declareEvaluator() {
       .def("getVariablesNames", &Evaluator::getVariablesNames,
            "return the variable names")
       .def("removeDependencies", &Evaluator::removeDependencies,
-           "resolves dependencies and removes them");
+           "resolves dependencies and removes them")
+      .def("compile", &Evaluator::compile,
+           "compiles the formula to bytecode to speed-up its evaluation")
+      .def("isCompiled", &Evaluator::isCompiled,
+           "return true if the formula has been compiled");
+#ifdef TFEL_NUMPY_SUPPORT
+  c.def("evaluate", Evaluator_evaluate,
+        "evaluates the formula for a set of values of the variables. "
+        "The values are given by a dictionary associating the name of "
+        "each variable to a numpy array. All arrays must be one "
+        "dimensional, C-contiguous arrays of float64 values of the "
+        "same size. The results are returned in a new numpy array.");
+#endif /* TFEL_NUMPY_SUPPORT */
 }
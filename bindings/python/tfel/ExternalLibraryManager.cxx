@@ -157,6 +157,8 @@ void declareExternalLibraryManager() {
       .def("getSource", &ELM::getSource)
       .def("getTFELVersion", &ELM::getTFELVersion,
            "return the TFEL Version used to generate the given entry point")
+      .def("isReentrant", &ELM::isReentrant,
+           "return true if the given entry point is declared reentrant")
       .def("getUnitSystem", &ELM::getUnitSystem,
            "return the unit system associated with the given entry point")
       .def("getEntryPoints", &ELM::getEntryPoints,
@@ -15,8 +15,10 @@
 
 void declareData();
 void declareTextData();
+void declareBinaryData();
 
 BOOST_PYTHON_MODULE(utilities) {
   declareData();
   declareTextData();
+  declareBinaryData();
 }
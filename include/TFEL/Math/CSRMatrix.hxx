@@ -0,0 +1,157 @@
+/*!
+ * \file   include/TFEL/Math/CSRMatrix.hxx
+ * \brief  This file declares the `CSRMatrix` class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_CSRMATRIX_HXX
+#define LIB_TFEL_MATH_CSRMATRIX_HXX
+
+#include <vector>
+#include <cstddef>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief a square matrix stored in compressed sparse row format.
+   *
+   * The sparsity pattern of the matrix is fixed at construction (or
+   * by the `resize` method): the column indices of the non null terms
+   * of each row are stored in increasing order, the diagonal term
+   * being always part of the pattern. All the terms outside the
+   * pattern are assumed null.
+   *
+   * Contrary to the skyline storage, this storage does not assume
+   * that the non null terms are gathered around the diagonal and does
+   * not reserve room for the fill-in of a direct factorisation. It is
+   * meant to be used with iterative solvers.
+   *
+   * \tparam ValueType: type of values hold by the matrix
+   */
+  template <typename ValueType>
+  struct CSRMatrix {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief a simple alias
+    using value_type = ValueType;
+    //! \brief default constructor
+    CSRMatrix();
+    /*!
+     * \brief constructor
+     * \param[in] p: column indices of the non null terms of each row.
+     * The indices of a row may be given in any order and may be
+     * repeated.
+     */
+    CSRMatrix(const std::vector<std::vector<size_type>>&);
+    //! \brief move constructor
+    CSRMatrix(CSRMatrix&&);
+    //! \brief copy constructor
+    CSRMatrix(const CSRMatrix&);
+    //! \brief move assignement
+    CSRMatrix& operator=(CSRMatrix&&);
+    //! \brief standard assignement
+    CSRMatrix& operator=(const CSRMatrix&);
+    /*!
+     * \brief change the sparsity pattern of the matrix. All values are
+     * set to zero.
+     * \param[in] p: column indices of the non null terms of each row.
+     */
+    void resize(const std::vector<std::vector<size_type>>&);
+    /*!
+     * \brief build a sparsity pattern suitable for a banded matrix,
+     * possibly bordered by some full rows and columns.
+     * \param[in] n: size of the banded part of the matrix
+     * \param[in] b: half-bandwidth of the banded part of the matrix
+     * \param[in] nb: number of full rows and columns appended at the
+     * end of the matrix
+     */
+    static std::vector<std::vector<size_type>> getBandedPattern(
+        const size_type, const size_type, const size_type = 0);
+    //! \brief clear the matrix
+    void clear();
+    //! \brief set all the values stored to zero
+    void zero();
+    //! \return the number of rows
+    size_type getNbRows() const;
+    //! \return the number of columns
+    size_type getNbCols() const;
+    //! \return the number of values stored
+    size_type getNumberOfStoredValues() const;
+    /*!
+     * \return if the given term belongs to the sparsity pattern of
+     * the matrix
+     * \param[in] i: row index
+     * \param[in] j: column index
+     */
+    bool isInPattern(const size_type, const size_type) const;
+    /*!
+     * \return a reference to the given term.
+     * \param[in] i: row index
+     * \param[in] j: column index
+     * \note an exception is thrown if the term does not belong to the
+     * sparsity pattern of the matrix.
+     */
+    ValueType& operator()(const size_type, const size_type);
+    /*!
+     * \return the value of the given term or zero if this term does
+     * not belong to the sparsity pattern of the matrix.
+     * \param[in] i: row index
+     * \param[in] j: column index
+     */
+    ValueType operator()(const size_type, const size_type) const;
+    /*!
+     * \brief compute the product `y=m.x`
+     * \param[out] y: result
+     * \param[in] x: vector
+     */
+    template <typename VectorType, typename VectorType2>
+    void multiply(VectorType&, const VectorType2&) const;
+    /*!
+     * \return the offsets of the rows in the arrays returned by
+     * `getColumnIndices` and `getValues`. The returned array has
+     * `getNbRows()+1` elements.
+     */
+    const std::vector<size_type>& getRowOffsets() const;
+    //! \return the column indices of the stored values
+    const std::vector<size_type>& getColumnIndices() const;
+    //! \return the stored values
+    std::vector<ValueType>& getValues();
+    //! \return the stored values
+    const std::vector<ValueType>& getValues() const;
+    //! \return the position of the diagonal term of each row
+    const std::vector<size_type>& getDiagonalPositions() const;
+    //! \brief destructor
+    ~CSRMatrix();
+
+   protected:
+    /*!
+     * \return the position of the given term in the `values` array or
+     * `values.size()` if this term does not belong to the sparsity
+     * pattern.
+     * \param[in] i: row index
+     * \param[in] j: column index
+     */
+    size_type getPosition(const size_type, const size_type) const;
+    //! \brief offset of each row in `columns` and `values`
+    std::vector<size_type> offsets;
+    //! \brief column indices, sorted in increasing order in each row
+    std::vector<size_type> columns;
+    //! \brief position of the diagonal term of each row
+    std::vector<size_type> diagonal;
+    //! \brief values
+    std::vector<ValueType> values;
+  };  // end of struct CSRMatrix
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/Matrix/CSRMatrix.ixx"
+
+#endif /* LIB_TFEL_MATH_CSRMATRIX_HXX */
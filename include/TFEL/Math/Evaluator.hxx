@@ -16,6 +16,7 @@
 #define LIB_TFEL_MATH_EVALUATOR_HXX
 
 #include <map>
+#include <span>
 #include <memory>
 #include <vector>
 #include <string>
@@ -23,6 +24,7 @@
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/EvaluatorBase.hxx"
 #include "TFEL/Math/Parser/ExternalFunction.hxx"
 #include "TFEL/Math/Parser/ExternalFunctionManager.hxx"
@@ -170,6 +172,26 @@ namespace tfel::math {
         const std::vector<std::string>&,
         const std::string&,
         std::shared_ptr<tfel::math::parser::ExternalFunctionManager>&);
+    /*!
+     * \brief compile the expression into a linear sequence of
+     * instructions (see the `Bytecode` class). Constant subexpressions
+     * are evaluated once and for all and common subexpressions are
+     * only evaluated once.
+     *
+     * Once compiled, the `getValue` method uses the bytecode rather
+     * than walking the tree representation of the expression. The
+     * bytecode is automatically rebuilt if the expression is modified
+     * (for instance by the `removeDependencies` method) and discarded
+     * if a new function is set.
+     */
+    void compile();
+    //! \return if the expression has been compiled
+    bool isCompiled() const noexcept;
+    /*!
+     * \return the bytecode associated with the expression, if the
+     * `compile` method has been called, a null pointer otherwise.
+     */
+    const tfel::math::parser::Bytecode* getBytecode() const noexcept;
     /*!
      * \brief evaluate the formula
      * \return the result of the evaluation
@@ -186,6 +208,25 @@ namespace tfel::math {
      * have been set with the `setVariableValue` method.
      */
     double getValue(const std::map<std::string, double>&);
+    /*!
+     * \brief evaluate the formula for a set of values of the variables
+     * \param[in] columns: values of the variables. The variables are
+     * sorted as in the list returned by the `getVariablesNames`
+     * method. The size of each column must be equal to the size of
+     * `out`.
+     * \param[out] out: results
+     *
+     * The formula is compiled (see the `compile` method) if required,
+     * and the values are treated by blocks, each instruction of the
+     * bytecode being applied to all the values of a block. If some
+     * nodes of the formula can't be compiled, the values are treated
+     * one by one.
+     *
+     * \note the values of the variables set by the `setVariableValue`
+     * method may be modified by this method.
+     */
+    void evaluate(std::span<const std::span<const double>>,
+                  std::span<double>);
     /*!
      * \brief evaluate the formula
      * \return the result of the evaluation
@@ -352,6 +393,8 @@ namespace tfel::math {
     ExprPtr expr;
     //! \brief a pointer to externally defined functions
     std::shared_ptr<tfel::math::parser::ExternalFunctionManager> manager;
+    //! \brief bytecode, if the expression has been compiled
+    std::unique_ptr<tfel::math::parser::Bytecode> bytecode;
   };  // end of struct Evaluator
 
 }  // end of namespace tfel::math
@@ -0,0 +1,309 @@
+/*!
+ * \file   include/TFEL/Math/GMRESSolve.hxx
+ * \brief  This file declares the `ILU0Preconditioner` class and the
+ * `GMRESSolve` solver.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_GMRESSOLVE_HXX
+#define LIB_TFEL_MATH_GMRESSOLVE_HXX
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+#include "TFEL/Math/CSRMatrix.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief incomplete LU factorisation without fill-in of a matrix
+   * stored in compressed sparse row format.
+   *
+   * The factors `L` and `U` share the sparsity pattern of the
+   * matrix. The lower triangular matrix `L` has unit diagonal terms
+   * which are not stored. If the pattern of the matrix contains the
+   * fill-in of its exact LU decomposition, as for banded matrices
+   * bordered by full rows and columns at their end, the factorisation
+   * is exact.
+   */
+  template <typename ValueType>
+  struct ILU0Preconditioner {
+    //! \brief a simple alias
+    using size_type = typename CSRMatrix<ValueType>::size_type;
+    /*!
+     * \brief compute the incomplete LU factorisation of the given
+     * matrix
+     * \param[in] m: matrix
+     * \param[in] eps: numerical parameter used to detect null pivot
+     */
+    void decomp(
+        const CSRMatrix<ValueType>& m,
+        const ValueType eps = 100 * std::numeric_limits<ValueType>::min()) {
+      if (m.getNbRows() == 0) {
+        throw(LUInvalidMatrixSize());
+      }
+      this->lu = m;
+      const auto n = this->lu.getNbRows();
+      const auto& o = this->lu.getRowOffsets();
+      const auto& c = this->lu.getColumnIndices();
+      const auto& d = this->lu.getDiagonalPositions();
+      auto& v = this->lu.getValues();
+      // position of the terms of the current row, indexed by column
+      this->w.assign(n, v.size());
+      for (size_type i = 0; i != n; ++i) {
+        for (auto p = o[i]; p != o[i + 1]; ++p) {
+          this->w[c[p]] = p;
+        }
+        for (auto p = o[i]; p != d[i]; ++p) {
+          const auto k = c[p];
+          v[p] /= v[d[k]];
+          for (auto q = d[k] + 1; q != o[k + 1]; ++q) {
+            const auto pj = this->w[c[q]];
+            if (pj != v.size()) {
+              v[pj] -= v[p] * v[q];
+            }
+          }
+        }
+        if (std::abs(v[d[i]]) < eps) {
+          throw(LUNullPivot());
+        }
+        for (auto p = o[i]; p != o[i + 1]; ++p) {
+          this->w[c[p]] = v.size();
+        }
+      }
+    }  // end of decomp
+    /*!
+     * \brief apply the preconditioner, i.e. solve `L.U.x=b`.
+     * \param[in,out] b: right hand side on input, solution on output
+     */
+    template <typename VectorType>
+    void apply(VectorType& b) const {
+      const auto n = this->lu.getNbRows();
+      const auto& o = this->lu.getRowOffsets();
+      const auto& c = this->lu.getColumnIndices();
+      const auto& d = this->lu.getDiagonalPositions();
+      const auto& v = this->lu.getValues();
+      for (size_type i = 0; i != n; ++i) {
+        auto x = b[i];
+        for (auto p = o[i]; p != d[i]; ++p) {
+          x -= v[p] * b[c[p]];
+        }
+        b[i] = x;
+      }
+      for (size_type i = n; i != 0; --i) {
+        const auto r = i - 1;
+        auto x = b[r];
+        for (auto p = d[r] + 1; p != o[r + 1]; ++p) {
+          x -= v[p] * b[c[p]];
+        }
+        b[r] = x / v[d[r]];
+      }
+    }  // end of apply
+
+   private:
+    //! \brief incomplete LU factors
+    CSRMatrix<ValueType> lu;
+    //! \brief temporary array used by the `decomp` method
+    std::vector<size_type> w;
+  };  // end of struct ILU0Preconditioner
+
+  //! \brief result of the `GMRESSolve::exe` method
+  template <typename ValueType>
+  struct GMRESResult {
+    //! \brief convergence flag
+    bool converged = false;
+    //! \brief number of iterations (matrix-vector products)
+    std::size_t iterations = 0;
+    /*!
+     * \brief normwise backward error of the solution, i.e. the ratio
+     * of the norm of the final residual `r=b-m.x` to
+     * `||m||.||x||+||b||`, where the Frobenius norm of `m` is used.
+     */
+    ValueType residual = ValueType{0};
+  };  // end of struct GMRESResult
+
+  /*!
+   * \brief This structure contains static methods for solving linear
+   * systems whose matrix is stored in compressed sparse row format by
+   * the restarted, right-preconditioned, generalised minimal residual
+   * method.
+   *
+   * The matrix is neither required to be symmetric nor to be positive
+   * definite.
+   */
+  struct GMRESSolve {
+    /*!
+     * \brief solve the linear system `m.x=b`.
+     * \param[in] m: matrix
+     * \param[in] pc: preconditioner, computed from `m`
+     * \param[in,out] b: right hand side on input, solution on output
+     * \param[in] eps: tolerance on the normwise backward error. Contrary
+     * to a tolerance on the residual relative to the right hand side,
+     * this criterion can be met for ill-conditioned matrices.
+     * \param[in] restart: number of iterations before restart
+     * \param[in] iterMax: maximal number of iterations
+     */
+    template <typename ValueType, typename VectorType>
+    static GMRESResult<ValueType> exe(const CSRMatrix<ValueType>& m,
+                                      const ILU0Preconditioner<ValueType>& pc,
+                                      VectorType& b,
+                                      const ValueType eps = ValueType(1e-12),
+                                      const std::size_t restart = 30,
+                                      const std::size_t iterMax = 1000) {
+      using size_type = typename CSRMatrix<ValueType>::size_type;
+      using Vector = std::vector<ValueType>;
+      auto norm = [](const Vector& v) {
+        auto s = ValueType{0};
+        for (const auto& e : v) {
+          s += e * e;
+        }
+        return std::sqrt(s);
+      };
+      const auto n = m.getNbRows();
+      if (n != b.size()) {
+        throw(LUUnmatchedSize());
+      }
+      if (n == 0) {
+        throw(LUInvalidMatrixSize());
+      }
+      auto r = GMRESResult<ValueType>{};
+      auto rhs = Vector(n);
+      for (size_type i = 0; i != n; ++i) {
+        rhs[i] = b[i];
+      }
+      const auto nb = norm(rhs);
+      const auto nm = norm(m.getValues());
+      const auto tiny = std::numeric_limits<ValueType>::min();
+      auto x = Vector(n, ValueType{0});
+      if (nb < tiny) {
+        std::fill(b.begin(), b.end(), ValueType{0});
+        r.converged = true;
+        return r;
+      }
+      const auto rs = std::max(restart, std::size_t{1});
+      // Krylov basis, allocated on demand
+      auto V = std::vector<Vector>{};
+      auto H = std::vector<ValueType>((rs + 1) * rs);
+      auto cs = Vector(rs);
+      auto sn = Vector(rs);
+      auto g = Vector(rs + 1);
+      auto y = Vector(rs);
+      auto z = Vector(n);
+      auto w = Vector(n);
+      auto h = [&H, rs](const size_type i, const size_type j) -> ValueType& {
+        return H[i * rs + j];
+      };
+      while (true) {
+        // residual
+        m.multiply(w, x);
+        for (size_type i = 0; i != n; ++i) {
+          w[i] = rhs[i] - w[i];
+        }
+        const auto beta = norm(w);
+        const auto scale = nm * norm(x) + nb;
+        r.residual = beta / scale;
+        if ((r.residual <= eps) || (r.iterations >= iterMax)) {
+          break;
+        }
+        if (V.empty()) {
+          V.emplace_back(n);
+        }
+        for (size_type i = 0; i != n; ++i) {
+          V[0][i] = w[i] / beta;
+        }
+        std::fill(g.begin(), g.end(), ValueType{0});
+        g[0] = beta;
+        auto k = size_type{0};
+        while (k != rs) {
+          // w = m.M^{-1}.v_k
+          z = V[k];
+          pc.apply(z);
+          m.multiply(w, z);
+          ++(r.iterations);
+          // modified Gram-Schmidt orthogonalisation
+          for (size_type i = 0; i <= k; ++i) {
+            auto s = ValueType{0};
+            for (size_type l = 0; l != n; ++l) {
+              s += w[l] * V[i][l];
+            }
+            h(i, k) = s;
+            for (size_type l = 0; l != n; ++l) {
+              w[l] -= s * V[i][l];
+            }
+          }
+          const auto hn = norm(w);
+          h(k + 1, k) = hn;
+          if (V.size() == k + 1) {
+            V.emplace_back(n);
+          }
+          if (hn > tiny) {
+            for (size_type l = 0; l != n; ++l) {
+              V[k + 1][l] = w[l] / hn;
+            }
+          }
+          // apply the previous Givens rotations to the new column
+          for (size_type i = 0; i != k; ++i) {
+            const auto t = cs[i] * h(i, k) + sn[i] * h(i + 1, k);
+            h(i + 1, k) = -sn[i] * h(i, k) + cs[i] * h(i + 1, k);
+            h(i, k) = t;
+          }
+          // new Givens rotation
+          const auto rho = std::hypot(h(k, k), h(k + 1, k));
+          if (rho < tiny) {
+            throw(LUNullPivot());
+          }
+          cs[k] = h(k, k) / rho;
+          sn[k] = h(k + 1, k) / rho;
+          h(k, k) = rho;
+          h(k + 1, k) = ValueType{0};
+          g[k + 1] = -sn[k] * g[k];
+          g[k] = cs[k] * g[k];
+          ++k;
+          if ((std::abs(g[k]) <= eps * scale) || (!(hn > tiny)) ||
+              (r.iterations >= iterMax)) {
+            break;
+          }
+        }
+        // solve the upper triangular system H.y=g
+        for (size_type i = k; i != 0; --i) {
+          const auto ii = i - 1;
+          auto s = g[ii];
+          for (size_type j = i; j != k; ++j) {
+            s -= h(ii, j) * y[j];
+          }
+          y[ii] = s / h(ii, ii);
+        }
+        // update the solution: x += M^{-1}.V.y
+        std::fill(z.begin(), z.end(), ValueType{0});
+        for (size_type i = 0; i != k; ++i) {
+          for (size_type l = 0; l != n; ++l) {
+            z[l] += y[i] * V[i][l];
+          }
+        }
+        pc.apply(z);
+        for (size_type l = 0; l != n; ++l) {
+          x[l] += z[l];
+        }
+      }
+      r.converged = r.residual <= eps;
+      for (size_type i = 0; i != n; ++i) {
+        b[i] = x[i];
+      }
+      return r;
+    }  // end of exe
+
+  };  // end of struct GMRESSolve
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_GMRESSOLVE_HXX */
@@ -0,0 +1,121 @@
+/*!
+ * \file   include/TFEL/Math/Kriging/KrigingKdTree.hxx
+ * \brief  This file declares the `KrigingKdTree` class, a k-d tree used
+ * to find the nearest neighbours of a point in a set of points.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_KRIGING_KRIGINGKDTREE_HXX
+#define LIB_TFEL_MATH_KRIGING_KRIGINGKDTREE_HXX
+
+#include <span>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Math/Kriging/KrigingVariable.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief a k-d tree built over a set of points.
+   *
+   * The points are sorted so that the points of a leaf are contiguous in
+   * memory. The tree is stored in an array of nodes.
+   *
+   * \tparam N: space dimension
+   * \tparam T: numeric type
+   */
+  template <unsigned short N, typename T>
+  struct KrigingKdTree {
+    //! \brief a simple alias
+    using Variable = typename KrigingVariable<N, T>::type;
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    /*!
+     * \brief workspace used by the `findNearestNeighbours` method. The
+     * same workspace may be used for successive searches to avoid
+     * memory allocations.
+     */
+    using Workspace = std::vector<std::pair<T, size_type>>;
+    //! \brief maximal number of points in a leaf
+    static constexpr size_type leafSize = 8;
+    /*!
+     * \brief build the tree
+     * \param[in] p: points
+     */
+    void build(std::span<const Variable>);
+    //! \return the number of points in the tree
+    size_type size() const noexcept;
+    /*!
+     * \brief find the `k` nearest neighbours of the given point.
+     * \param[out] n: indices of the neighbours in the list of points given
+     * to the `build` method, sorted by increasing distance.
+     * \param[in,out] w: workspace
+     * \param[in] x: point
+     * \param[in] k: number of neighbours. If `k` is greater than the
+     * number of points, all the points are returned.
+     */
+    void findNearestNeighbours(std::vector<size_type>&,
+                               Workspace&,
+                               const Variable&,
+                               const size_type) const;
+
+   private:
+    //! \brief a node of the tree
+    struct Node {
+      //! \brief index of the first point of the node
+      size_type first;
+      //! \brief index past the last point of the node
+      size_type last;
+      //! \brief index of the left child, if any
+      size_type left;
+      //! \brief index of the right child, if any
+      size_type right;
+      //! \brief splitting value
+      T split;
+      //! \brief splitting direction
+      unsigned short axis;
+      //! \return if the node is a leaf
+      bool isLeaf() const noexcept { return this->left == this->right; }
+    };
+    /*!
+     * \brief build the node associated with the points in the range
+     * `[first, last[`
+     * \return the index of the node
+     * \param[in] p: points given to the `build` method
+     * \param[in] first: index of the first point
+     * \param[in] last: index past the last point
+     */
+    size_type buildNode(std::span<const Variable>,
+                        const size_type,
+                        const size_type);
+    //! \brief search the nearest neighbours in the given node
+    void search(Workspace&,
+                const size_type,
+                const Variable&,
+                const size_type) const;
+    //! \return the ith component of the given point
+    static T getComponent(const Variable&, const unsigned short) noexcept;
+    //! \return the squared distance between two points
+    static T getSquaredDistance(const Variable&, const Variable&) noexcept;
+    //! \brief nodes, the root being the first one
+    std::vector<Node> nodes;
+    //! \brief sorted points
+    std::vector<Variable> points;
+    //! \brief indices of the sorted points in the initial list of points
+    std::vector<size_type> indices;
+  };  // end of struct KrigingKdTree
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/Kriging/KrigingKdTree.ixx"
+
+#endif /* LIB_TFEL_MATH_KRIGING_KRIGINGKDTREE_HXX */
@@ -0,0 +1,161 @@
+/*!
+ * \file   include/TFEL/Math/Kriging/KrigingKdTree.ixx
+ * \brief  This file implements the `KrigingKdTree` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_KRIGING_KRIGINGKDTREE_IXX
+#define LIB_TFEL_MATH_KRIGING_KRIGINGKDTREE_IXX
+
+#include <numeric>
+#include <algorithm>
+
+namespace tfel::math {
+
+  template <unsigned short N, typename T>
+  T KrigingKdTree<N, T>::getComponent(const Variable& x,
+                                      const unsigned short i) noexcept {
+    if constexpr (N == 1) {
+      static_cast<void>(i);
+      return x;
+    } else {
+      return x[i];
+    }
+  }  // end of getComponent
+
+  template <unsigned short N, typename T>
+  T KrigingKdTree<N, T>::getSquaredDistance(const Variable& x,
+                                            const Variable& y) noexcept {
+    auto d2 = T(0);
+    for (unsigned short i = 0; i != N; ++i) {
+      const auto d = getComponent(x, i) - getComponent(y, i);
+      d2 += d * d;
+    }
+    return d2;
+  }  // end of getSquaredDistance
+
+  template <unsigned short N, typename T>
+  void KrigingKdTree<N, T>::build(std::span<const Variable> p) {
+    this->nodes.clear();
+    this->points.clear();
+    this->indices.resize(p.size());
+    std::iota(this->indices.begin(), this->indices.end(), size_type{0});
+    if (p.empty()) {
+      return;
+    }
+    this->buildNode(p, 0, p.size());
+    this->points.reserve(p.size());
+    for (const auto i : this->indices) {
+      this->points.push_back(p[i]);
+    }
+  }  // end of build
+
+  template <unsigned short N, typename T>
+  typename KrigingKdTree<N, T>::size_type KrigingKdTree<N, T>::buildNode(
+      std::span<const Variable> p, const size_type first, const size_type last) {
+    const auto id = this->nodes.size();
+    this->nodes.push_back(Node{first, last, 0, 0, T(0), 0});
+    if (last - first <= leafSize) {
+      return id;
+    }
+    // splitting along the direction of largest extent
+    unsigned short axis = 0;
+    auto extent = T(0);
+    for (unsigned short i = 0; i != N; ++i) {
+      const auto [pmin, pmax] = std::minmax_element(
+          this->indices.begin() + first, this->indices.begin() + last,
+          [&p, i](const size_type a, const size_type b) {
+            return getComponent(p[a], i) < getComponent(p[b], i);
+          });
+      const auto e = getComponent(p[*pmax], i) - getComponent(p[*pmin], i);
+      if (e > extent) {
+        extent = e;
+        axis = i;
+      }
+    }
+    if (!(extent > T(0))) {
+      // all the points are equal
+      return id;
+    }
+    const auto mid = first + (last - first) / 2;
+    std::nth_element(this->indices.begin() + first,
+                     this->indices.begin() + mid,
+                     this->indices.begin() + last,
+                     [&p, axis](const size_type a, const size_type b) {
+                       return getComponent(p[a], axis) <
+                              getComponent(p[b], axis);
+                     });
+    const auto split = getComponent(p[this->indices[mid]], axis);
+    const auto l = this->buildNode(p, first, mid);
+    const auto r = this->buildNode(p, mid, last);
+    auto& n = this->nodes[id];
+    n.left = l;
+    n.right = r;
+    n.split = split;
+    n.axis = axis;
+    return id;
+  }  // end of buildNode
+
+  template <unsigned short N, typename T>
+  typename KrigingKdTree<N, T>::size_type KrigingKdTree<N, T>::size()
+      const noexcept {
+    return this->points.size();
+  }  // end of size
+
+  template <unsigned short N, typename T>
+  void KrigingKdTree<N, T>::findNearestNeighbours(std::vector<size_type>& n,
+                                                  Workspace& w,
+                                                  const Variable& x,
+                                                  const size_type k) const {
+    w.clear();
+    n.clear();
+    if ((this->nodes.empty()) || (k == 0)) {
+      return;
+    }
+    this->search(w, 0, x, k);
+    std::sort_heap(w.begin(), w.end());
+    for (const auto& v : w) {
+      n.push_back(this->indices[v.second]);
+    }
+  }  // end of findNearestNeighbours
+
+  template <unsigned short N, typename T>
+  void KrigingKdTree<N, T>::search(Workspace& w,
+                                   const size_type id,
+                                   const Variable& x,
+                                   const size_type k) const {
+    const auto& n = this->nodes[id];
+    if (n.isLeaf()) {
+      // the workspace is a max-heap of the current neighbours
+      for (auto i = n.first; i != n.last; ++i) {
+        const auto d2 = getSquaredDistance(this->points[i], x);
+        if (w.size() < k) {
+          w.emplace_back(d2, i);
+          std::push_heap(w.begin(), w.end());
+        } else if (d2 < w.front().first) {
+          std::pop_heap(w.begin(), w.end());
+          w.back() = {d2, i};
+          std::push_heap(w.begin(), w.end());
+        }
+      }
+      return;
+    }
+    const auto d = getComponent(x, n.axis) - n.split;
+    const auto near = d < 0 ? n.left : n.right;
+    const auto far = d < 0 ? n.right : n.left;
+    this->search(w, near, x, k);
+    if ((w.size() < k) || (d * d < w.front().first)) {
+      this->search(w, far, x, k);
+    }
+  }  // end of search
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_KRIGING_KRIGINGKDTREE_IXX */
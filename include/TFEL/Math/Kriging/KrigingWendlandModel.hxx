@@ -0,0 +1,102 @@
+/*!
+ * \file   include/TFEL/Math/Kriging/KrigingWendlandModel.hxx
+ * \brief  This file declares a kriging model based on a compactly
+ * supported covariance.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_KRIGING_KRIGINGWENDLANDMODEL_HXX
+#define LIB_TFEL_MATH_KRIGING_KRIGINGWENDLANDMODEL_HXX
+
+#include <cmath>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/Kriging/KrigingVariable.hxx"
+#include "TFEL/Math/Kriging/KrigingDefaultNuggetModel.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief a kriging model based on the \f$C^{2}\f$ Wendland function:
+   * \f[
+   * C\left(h\right)=
+   * \left(1-\frac{h}{r}\right)^{4}\left(1+4\,\frac{h}{r}\right)
+   * \quad\text{if}\quad h < r
+   * \f]
+   * where \f$r\f$ is the support radius. The covariance is zero for
+   * \f$h\geq r\f$ and is positive definite up to the dimension \f$3\f$.
+   * A constant drift is used (ordinary kriging).
+   *
+   * \param N  : space dimension
+   * \param T  : numeric type
+   * \param NM : nugget model
+   */
+  template <unsigned short N,
+            typename T,
+            typename NM = KrigingDefaultNuggetModel<N, T>>
+  struct KrigingWendlandModel : public NM {
+    static_assert((N >= 1) && (N <= 3), "invalid space dimension");
+
+    static TFEL_MATH_INLINE T one(const typename KrigingVariable<N, T>::type&) {
+      return T(1);
+    }
+
+    TFEL_MATH_INLINE T
+    covariance(const typename KrigingVariable<N, T>::type& v) const {
+      const auto h = [&v] {
+        if constexpr (N == 1) {
+          return std::abs(v);
+        } else {
+          auto h2 = T(0);
+          for (unsigned short i = 0; i != N; ++i) {
+            h2 += v(i) * v(i);
+          }
+          return std::sqrt(h2);
+        }
+      }();
+      const auto r = h / this->radius;
+      if (r >= 1) {
+        return T(0);
+      }
+      const auto s = (1 - r) * (1 - r);
+      return s * s * (1 + 4 * r);
+    }  // end of covariance
+    /*!
+     * \brief set the support radius of the covariance
+     * \param[in] r: support radius
+     */
+    void setSupportRadius(const T r) {
+      raise_if(!(r > T(0)),
+               "KrigingWendlandModel::setSupportRadius: "
+               "invalid support radius");
+      this->radius = r;
+    }  // end of setSupportRadius
+    //! \return the support radius of the covariance
+    T getSupportRadius() const { return this->radius; }
+
+    typedef T (*Drifts)(const typename KrigingVariable<N, T>::type&);
+
+    static const unsigned short nb = 1u; /* number of drifts */
+    static const Drifts drifts[1u];
+
+   protected:
+    //! \brief support radius
+    T radius = T(1);
+  };
+
+  template <unsigned short N, typename T, typename NM>
+  const typename KrigingWendlandModel<N, T, NM>::Drifts
+      KrigingWendlandModel<N, T, NM>::drifts[1u] = {
+          KrigingWendlandModel<N, T, NM>::one};
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_KRIGING_KRIGINGWENDLANDMODEL_HXX */
@@ -0,0 +1,142 @@
+/*!
+ * \file   include/TFEL/Math/Kriging/LocalKriging.ixx
+ * \brief  This file implements the `LocalKriging` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_KRIGING_LOCALKRIGING_IXX
+#define LIB_TFEL_MATH_KRIGING_LOCALKRIGING_IXX
+
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/Kriging/KrigingErrors.hxx"
+
+namespace tfel::math {
+
+  template <unsigned short N, typename T, typename Model>
+  void LocalKriging<N, T, Model>::addValue(const Variable& xv, const T& fv) {
+    this->x.push_back(xv);
+    this->f.push_back(fv);
+  }  // end of addValue
+
+  template <unsigned short N, typename T, typename Model>
+  void LocalKriging<N, T, Model>::setNumberOfNeighbours(const size_type n) {
+    raise_if(n <= Model::nb,
+             "LocalKriging::setNumberOfNeighbours: "
+             "the number of neighbours must be greater than the number of "
+             "drifts");
+    this->nneighbours = n;
+  }  // end of setNumberOfNeighbours
+
+  template <unsigned short N, typename T, typename Model>
+  typename LocalKriging<N, T, Model>::size_type
+  LocalKriging<N, T, Model>::getNumberOfNeighbours() const noexcept {
+    return this->nneighbours;
+  }  // end of getNumberOfNeighbours
+
+  template <unsigned short N, typename T, typename Model>
+  void LocalKriging<N, T, Model>::buildInterpolation() {
+    if (this->x.size() != this->f.size()) {
+      throw(KrigingErrorInvalidLength());
+    }
+    if (this->x.empty()) {
+      throw(KrigingErrorNoDataSpecified());
+    }
+    if (this->x.size() <= Model::nb) {
+      throw(KrigingErrorInsufficientData());
+    }
+    this->tree.build(this->x);
+  }  // end of buildInterpolation
+
+  template <unsigned short N, typename T, typename Model>
+  void LocalKriging<N, T, Model>::buildLocalInterpolation(Workspace& w) const {
+    const auto& n = w.previous_neighbours;
+    const auto nt = n.size() + Model::nb;
+    w.m.resize(nt, nt, T(0));
+    w.a.resize(nt);
+    w.tmp.resize(nt);
+    w.p.resize(nt);
+    for (size_type i = 0; i != n.size(); ++i) {
+      const auto& xi = this->x[n[i]];
+      for (size_type j = 0; j != i; ++j) {
+        w.m(i, j) = w.m(j, i) = Model::covariance(xi - this->x[n[j]]);
+      }
+      // the covariance of the models used by the `Kriging` class is null
+      // at the origin, contrary to compactly supported covariances
+      w.m(i, i) = Model::covariance(xi - xi) + Model::nuggetEffect(n[i], xi);
+      for (unsigned short d = 0; d != Model::nb; ++d) {
+        w.m(n.size() + d, i) = w.m(i, n.size() + d) = (Model::drifts[d])(xi);
+      }
+      w.a[i] = this->f[n[i]];
+    }
+    for (size_type i = n.size(); i != nt; ++i) {
+      for (size_type j = n.size(); j != nt; ++j) {
+        w.m(i, j) = T(0);
+      }
+      w.a[i] = T(0);
+    }
+    LUSolve::exe(w.m, w.a, w.tmp, w.p);
+  }  // end of buildLocalInterpolation
+
+  template <unsigned short N, typename T, typename Model>
+  T LocalKriging<N, T, Model>::evaluate(Workspace& w,
+                                        const Variable& xv) const {
+    raise_if(this->tree.size() != this->x.size(),
+             "LocalKriging::evaluate: "
+             "the buildInterpolation method has not been called");
+    const auto k = std::min(this->nneighbours, this->x.size());
+    this->tree.findNearestNeighbours(w.neighbours, w.search, xv, k);
+    // the local interpolation only depends on the set of neighbours
+    std::sort(w.neighbours.begin(), w.neighbours.end());
+    if (w.neighbours != w.previous_neighbours) {
+      w.previous_neighbours = w.neighbours;
+      try {
+        this->buildLocalInterpolation(w);
+      } catch (...) {
+        w.previous_neighbours.clear();
+        throw;
+      }
+    }
+    const auto& n = w.previous_neighbours;
+    auto r = T(0);
+    for (size_type i = 0; i != n.size(); ++i) {
+      r += w.a[i] * Model::covariance(xv - this->x[n[i]]);
+    }
+    for (unsigned short d = 0; d != Model::nb; ++d) {
+      r += w.a[n.size() + d] * (Model::drifts[d])(xv);
+    }
+    return r;
+  }  // end of evaluate
+
+  template <unsigned short N, typename T, typename Model>
+  T LocalKriging<N, T, Model>::operator()(const Variable& xv) const {
+    auto w = Workspace{};
+    return this->evaluate(w, xv);
+  }  // end of operator()
+
+  template <unsigned short N, typename T, typename Model>
+  void LocalKriging<N, T, Model>::evaluate(
+      std::span<T> r, std::span<const Variable> xv) const {
+    raise_if(r.size() != xv.size(),
+             "LocalKriging::evaluate: "
+             "unmatched number of points and results");
+    auto w = Workspace{};
+    for (size_type i = 0; i != xv.size(); ++i) {
+      r[i] = this->evaluate(w, xv[i]);
+    }
+  }  // end of evaluate
+
+  template <unsigned short N, typename T, typename Model>
+  LocalKriging<N, T, Model>::~LocalKriging() noexcept = default;
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_KRIGING_LOCALKRIGING_IXX */
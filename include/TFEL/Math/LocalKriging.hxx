@@ -0,0 +1,146 @@
+/*!
+ * \file   include/TFEL/Math/LocalKriging.hxx
+ * \brief  This file declares the `LocalKriging` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_LOCALKRIGING_HXX
+#define LIB_TFEL_MATH_LOCALKRIGING_HXX
+
+#include <span>
+#include <vector>
+#include <cstddef>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/LU/Permutation.hxx"
+#include "TFEL/Math/Kriging/KrigingVariable.hxx"
+#include "TFEL/Math/Kriging/KrigingKdTree.hxx"
+#include "TFEL/Math/Kriging/KrigingWendlandModel.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief a kriging interpolation restricted to the neighbourhood of
+   * the evaluation point.
+   *
+   * Contrary to the `Kriging` class, which solves a linear system whose
+   * size is the number of points, the interpolation at a given point is
+   * built using its `k` nearest neighbours, which are found using a k-d
+   * tree. A linear system of size `k` plus the number of drifts is thus
+   * solved for each evaluation, unless the neighbours are the same as
+   * in the previous evaluation (see the `evaluate` method). This makes
+   * interpolations of large data sets tractable.
+   *
+   * The interpolation is exact at the data points, but is only
+   * piecewise continuous, since the neighbourhood changes with the
+   * evaluation point.
+   *
+   * The default model is based on a compactly supported covariance
+   * (see the `KrigingWendlandModel` class), whose support radius shall be
+   * chosen consistently with the distances between the neighbours. The
+   * models used by the `Kriging` class can also be used.
+   *
+   * \tparam N: space dimension
+   * \tparam T: numeric type
+   * \tparam Model: kriging model
+   */
+  template <unsigned short N,
+            typename T = double,
+            typename Model = KrigingWendlandModel<N, T>>
+  struct TFEL_VISIBILITY_LOCAL LocalKriging : public Model {
+    //! \brief a simple alias
+    using Variable = typename KrigingVariable<N, T>::type;
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief default number of neighbours
+    static constexpr size_type defaultNumberOfNeighbours = 16;
+    /*!
+     * \brief data used to evaluate the interpolation. Using the same
+     * workspace for successive evaluations avoids memory allocations and
+     * allows to reuse the local interpolation if the neighbours of the
+     * evaluation point did not change.
+     */
+    struct Workspace {
+      //! \brief workspace of the k-d tree
+      typename KrigingKdTree<N, T>::Workspace search;
+      //! \brief neighbours of the evaluation point
+      std::vector<size_type> neighbours;
+      //! \brief neighbours of the last local interpolation
+      std::vector<size_type> previous_neighbours;
+      //! \brief matrix of the local system
+      matrix<T> m;
+      //! \brief coefficients of the last local interpolation
+      vector<T> a;
+      //! \brief temporary vector used by the LU solver
+      vector<T> tmp;
+      //! \brief permutation used by the LU solver
+      Permutation<index_type<matrix<T>>> p;
+    };
+    //! \brief default constructor
+    LocalKriging() = default;
+    /*!
+     * \brief add a data point
+     * \param[in] x: point
+     * \param[in] f: value
+     */
+    void addValue(const Variable&, const T&);
+    /*!
+     * \brief set the number of neighbours used to build the local
+     * interpolation.
+     * \param[in] n: number of neighbours
+     */
+    void setNumberOfNeighbours(const size_type);
+    //! \return the number of neighbours
+    size_type getNumberOfNeighbours() const noexcept;
+    //! \brief build the k-d tree used to find the neighbours
+    void buildInterpolation();
+    /*!
+     * \return the value of the interpolation at the given point
+     * \param[in] x: point
+     */
+    T operator()(const Variable&) const;
+    /*!
+     * \return the value of the interpolation at the given point
+     * \param[in,out] w: workspace
+     * \param[in] x: point
+     */
+    T evaluate(Workspace&, const Variable&) const;
+    /*!
+     * \brief evaluate the interpolation at a set of points
+     * \param[out] r: values of the interpolation
+     * \param[in] x: points
+     * \note points close to each other are likely to share the same
+     * neighbours. Sorting the points accordingly (for instance, by
+     * element) reduces the number of local systems to be solved.
+     */
+    void evaluate(std::span<T>, std::span<const Variable>) const;
+    //! \brief destructor
+    ~LocalKriging() noexcept;
+
+   private:
+    LocalKriging(const LocalKriging&) = delete;
+    LocalKriging& operator=(const LocalKriging&) = delete;
+    //! \brief build the local interpolation
+    void buildLocalInterpolation(Workspace&) const;
+    //! \brief points
+    std::vector<Variable> x;
+    //! \brief values
+    std::vector<T> f;
+    //! \brief k-d tree
+    KrigingKdTree<N, T> tree;
+    //! \brief number of neighbours
+    size_type nneighbours = defaultNumberOfNeighbours;
+  };  // end of struct LocalKriging
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/Kriging/LocalKriging.ixx"
+
+#endif /* LIB_TFEL_MATH_LOCALKRIGING_HXX */
@@ -0,0 +1,222 @@
+/*!
+ * \file   include/TFEL/Math/Matrix/CSRMatrix.ixx
+ * \brief  This file implements the `CSRMatrix` class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_CSRMATRIX_IXX
+#define LIB_TFEL_MATH_CSRMATRIX_IXX
+
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+
+namespace tfel::math {
+
+  template <typename ValueType>
+  CSRMatrix<ValueType>::CSRMatrix() = default;
+
+  template <typename ValueType>
+  CSRMatrix<ValueType>::CSRMatrix(
+      const std::vector<std::vector<size_type>>& p) {
+    this->resize(p);
+  }  // end of CSRMatrix
+
+  template <typename ValueType>
+  CSRMatrix<ValueType>::CSRMatrix(CSRMatrix&&) = default;
+
+  template <typename ValueType>
+  CSRMatrix<ValueType>::CSRMatrix(const CSRMatrix&) = default;
+
+  template <typename ValueType>
+  CSRMatrix<ValueType>& CSRMatrix<ValueType>::operator=(CSRMatrix&&) =
+      default;
+
+  template <typename ValueType>
+  CSRMatrix<ValueType>& CSRMatrix<ValueType>::operator=(const CSRMatrix&) =
+      default;
+
+  template <typename ValueType>
+  std::vector<std::vector<typename CSRMatrix<ValueType>::size_type>>
+  CSRMatrix<ValueType>::getBandedPattern(const size_type n,
+                                         const size_type b,
+                                         const size_type nb) {
+    auto p = std::vector<std::vector<size_type>>(n + nb);
+    for (size_type i = 0; i != n; ++i) {
+      const auto jb = (i > b) ? i - b : 0;
+      const auto je = std::min(i + b + 1, n);
+      for (size_type j = jb; j != je; ++j) {
+        p[i].push_back(j);
+      }
+      for (size_type j = n; j != n + nb; ++j) {
+        p[i].push_back(j);
+      }
+    }
+    for (size_type i = n; i != n + nb; ++i) {
+      for (size_type j = 0; j != n + nb; ++j) {
+        p[i].push_back(j);
+      }
+    }
+    return p;
+  }  // end of getBandedPattern
+
+  template <typename ValueType>
+  void CSRMatrix<ValueType>::resize(
+      const std::vector<std::vector<size_type>>& p) {
+    this->clear();
+    const auto n = p.size();
+    this->offsets.resize(n + 1);
+    this->diagonal.resize(n);
+    this->offsets[0] = 0;
+    auto row = std::vector<size_type>{};
+    for (size_type i = 0; i != n; ++i) {
+      row = p[i];
+      row.push_back(i);
+      std::sort(row.begin(), row.end());
+      row.erase(std::unique(row.begin(), row.end()), row.end());
+      if (row.back() >= n) {
+        tfel::raise<std::invalid_argument>(
+            "CSRMatrix::resize: invalid column index in row " +
+            std::to_string(i));
+      }
+      const auto pd = std::lower_bound(row.begin(), row.end(), i);
+      this->diagonal[i] = this->columns.size() + (pd - row.begin());
+      this->columns.insert(this->columns.end(), row.begin(), row.end());
+      this->offsets[i + 1] = this->columns.size();
+    }
+    this->values.resize(this->columns.size(), ValueType{0});
+  }  // end of resize
+
+  template <typename ValueType>
+  void CSRMatrix<ValueType>::clear() {
+    this->offsets.clear();
+    this->columns.clear();
+    this->diagonal.clear();
+    this->values.clear();
+  }  // end of clear
+
+  template <typename ValueType>
+  void CSRMatrix<ValueType>::zero() {
+    std::fill(this->values.begin(), this->values.end(), ValueType{0});
+  }  // end of zero
+
+  template <typename ValueType>
+  typename CSRMatrix<ValueType>::size_type CSRMatrix<ValueType>::getNbRows()
+      const {
+    return this->diagonal.size();
+  }  // end of getNbRows
+
+  template <typename ValueType>
+  typename CSRMatrix<ValueType>::size_type CSRMatrix<ValueType>::getNbCols()
+      const {
+    return this->diagonal.size();
+  }  // end of getNbCols
+
+  template <typename ValueType>
+  typename CSRMatrix<ValueType>::size_type
+  CSRMatrix<ValueType>::getNumberOfStoredValues() const {
+    return this->values.size();
+  }  // end of getNumberOfStoredValues
+
+  template <typename ValueType>
+  typename CSRMatrix<ValueType>::size_type CSRMatrix<ValueType>::getPosition(
+      const size_type i, const size_type j) const {
+    const auto b = this->columns.begin() + this->offsets[i];
+    const auto e = this->columns.begin() + this->offsets[i + 1];
+    const auto p = std::lower_bound(b, e, j);
+    if ((p == e) || (*p != j)) {
+      return this->values.size();
+    }
+    return static_cast<size_type>(p - this->columns.begin());
+  }  // end of getPosition
+
+  template <typename ValueType>
+  bool CSRMatrix<ValueType>::isInPattern(const size_type i,
+                                         const size_type j) const {
+    return this->getPosition(i, j) != this->values.size();
+  }  // end of isInPattern
+
+  template <typename ValueType>
+  ValueType& CSRMatrix<ValueType>::operator()(const size_type i,
+                                              const size_type j) {
+    if (i == j) {
+      return this->values[this->diagonal[i]];
+    }
+    const auto p = this->getPosition(i, j);
+    if (p == this->values.size()) {
+      tfel::raise<std::out_of_range>(
+          "CSRMatrix::operator(): term (" + std::to_string(i) + ", " +
+          std::to_string(j) + ") is outside the pattern of the matrix");
+    }
+    return this->values[p];
+  }  // end of operator()
+
+  template <typename ValueType>
+  ValueType CSRMatrix<ValueType>::operator()(const size_type i,
+                                             const size_type j) const {
+    if (i == j) {
+      return this->values[this->diagonal[i]];
+    }
+    const auto p = this->getPosition(i, j);
+    if (p == this->values.size()) {
+      return ValueType{0};
+    }
+    return this->values[p];
+  }  // end of operator()
+
+  template <typename ValueType>
+  template <typename VectorType, typename VectorType2>
+  void CSRMatrix<ValueType>::multiply(VectorType& y,
+                                      const VectorType2& x) const {
+    const auto n = this->getNbRows();
+    for (size_type i = 0; i != n; ++i) {
+      auto v = ValueType{0};
+      for (auto p = this->offsets[i]; p != this->offsets[i + 1]; ++p) {
+        v += this->values[p] * x[this->columns[p]];
+      }
+      y[i] = v;
+    }
+  }  // end of multiply
+
+  template <typename ValueType>
+  const std::vector<typename CSRMatrix<ValueType>::size_type>&
+  CSRMatrix<ValueType>::getRowOffsets() const {
+    return this->offsets;
+  }  // end of getRowOffsets
+
+  template <typename ValueType>
+  const std::vector<typename CSRMatrix<ValueType>::size_type>&
+  CSRMatrix<ValueType>::getColumnIndices() const {
+    return this->columns;
+  }  // end of getColumnIndices
+
+  template <typename ValueType>
+  std::vector<ValueType>& CSRMatrix<ValueType>::getValues() {
+    return this->values;
+  }  // end of getValues
+
+  template <typename ValueType>
+  const std::vector<ValueType>& CSRMatrix<ValueType>::getValues() const {
+    return this->values;
+  }  // end of getValues
+
+  template <typename ValueType>
+  const std::vector<typename CSRMatrix<ValueType>::size_type>&
+  CSRMatrix<ValueType>::getDiagonalPositions() const {
+    return this->diagonal;
+  }  // end of getDiagonalPositions
+
+  template <typename ValueType>
+  CSRMatrix<ValueType>::~CSRMatrix() = default;
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_CSRMATRIX_IXX */
@@ -0,0 +1,195 @@
+/*!
+ * \file   include/TFEL/Math/Matrix/SkylineMatrix.ixx
+ * \brief  This file implements the `SkylineMatrix` class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_SKYLINEMATRIX_IXX
+#define LIB_TFEL_MATH_SKYLINEMATRIX_IXX
+
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+
+namespace tfel::math {
+
+  template <typename ValueType>
+  SkylineMatrix<ValueType>::SkylineMatrix() = default;
+
+  template <typename ValueType>
+  SkylineMatrix<ValueType>::SkylineMatrix(const std::vector<size_type>& f) {
+    this->resize(f);
+  }  // end of SkylineMatrix
+
+  template <typename ValueType>
+  SkylineMatrix<ValueType>::SkylineMatrix(SkylineMatrix&&) = default;
+
+  template <typename ValueType>
+  SkylineMatrix<ValueType>::SkylineMatrix(const SkylineMatrix&) = default;
+
+  template <typename ValueType>
+  SkylineMatrix<ValueType>& SkylineMatrix<ValueType>::operator=(
+      SkylineMatrix&&) = default;
+
+  template <typename ValueType>
+  SkylineMatrix<ValueType>& SkylineMatrix<ValueType>::operator=(
+      const SkylineMatrix&) = default;
+
+  template <typename ValueType>
+  std::vector<typename SkylineMatrix<ValueType>::size_type>
+  SkylineMatrix<ValueType>::getBandedProfile(const size_type n,
+                                             const size_type b,
+                                             const size_type nb) {
+    auto f = std::vector<size_type>(n + nb, 0);
+    for (size_type i = 0; i != n; ++i) {
+      f[i] = (i > b) ? i - b : 0;
+    }
+    return f;
+  }  // end of getBandedProfile
+
+  template <typename ValueType>
+  void SkylineMatrix<ValueType>::resize(const std::vector<size_type>& f) {
+    this->clear();
+    this->first = f;
+    this->offsets.resize(f.size() + 1);
+    this->offsets[0] = 0;
+    for (size_type i = 0; i != f.size(); ++i) {
+      if (f[i] > i) {
+        tfel::raise<std::invalid_argument>(
+            "SkylineMatrix::resize: invalid profile");
+      }
+      this->offsets[i + 1] = this->offsets[i] + (i - f[i]);
+    }
+    this->diagonal.resize(f.size(), ValueType{0});
+    this->lower.resize(this->offsets.back(), ValueType{0});
+    this->upper.resize(this->offsets.back(), ValueType{0});
+  }  // end of resize
+
+  template <typename ValueType>
+  void SkylineMatrix<ValueType>::clear() {
+    this->first.clear();
+    this->offsets.clear();
+    this->diagonal.clear();
+    this->lower.clear();
+    this->upper.clear();
+  }  // end of clear
+
+  template <typename ValueType>
+  void SkylineMatrix<ValueType>::zero() {
+    std::fill(this->diagonal.begin(), this->diagonal.end(), ValueType{0});
+    std::fill(this->lower.begin(), this->lower.end(), ValueType{0});
+    std::fill(this->upper.begin(), this->upper.end(), ValueType{0});
+  }  // end of zero
+
+  template <typename ValueType>
+  typename SkylineMatrix<ValueType>::size_type
+  SkylineMatrix<ValueType>::getNbRows() const {
+    return this->diagonal.size();
+  }  // end of getNbRows
+
+  template <typename ValueType>
+  typename SkylineMatrix<ValueType>::size_type
+  SkylineMatrix<ValueType>::getNbCols() const {
+    return this->diagonal.size();
+  }  // end of getNbCols
+
+  template <typename ValueType>
+  typename SkylineMatrix<ValueType>::size_type
+  SkylineMatrix<ValueType>::getNumberOfStoredValues() const {
+    return this->diagonal.size() + this->lower.size() + this->upper.size();
+  }  // end of getNumberOfStoredValues
+
+  template <typename ValueType>
+  typename SkylineMatrix<ValueType>::size_type
+  SkylineMatrix<ValueType>::getFirstIndex(const size_type i) const {
+    return this->first[i];
+  }  // end of getFirstIndex
+
+  template <typename ValueType>
+  bool SkylineMatrix<ValueType>::isInProfile(const size_type i,
+                                             const size_type j) const {
+    if (i == j) {
+      return true;
+    }
+    return (i > j) ? (j >= this->first[i]) : (i >= this->first[j]);
+  }  // end of isInProfile
+
+  template <typename ValueType>
+  ValueType& SkylineMatrix<ValueType>::operator()(const size_type i,
+                                                  const size_type j) {
+    if (i == j) {
+      return this->diagonal[i];
+    }
+    if (!this->isInProfile(i, j)) {
+      tfel::raise<std::out_of_range>(
+          "SkylineMatrix::operator(): term (" + std::to_string(i) + ", " +
+          std::to_string(j) + ") is outside the profile of the matrix");
+    }
+    if (i > j) {
+      return this->lower[this->offsets[i] + j - this->first[i]];
+    }
+    return this->upper[this->offsets[j] + i - this->first[j]];
+  }  // end of operator()
+
+  template <typename ValueType>
+  ValueType SkylineMatrix<ValueType>::operator()(const size_type i,
+                                                 const size_type j) const {
+    if (i == j) {
+      return this->diagonal[i];
+    }
+    if (!this->isInProfile(i, j)) {
+      return ValueType{0};
+    }
+    if (i > j) {
+      return this->lower[this->offsets[i] + j - this->first[i]];
+    }
+    return this->upper[this->offsets[j] + i - this->first[j]];
+  }  // end of operator()
+
+  template <typename ValueType>
+  ValueType* SkylineMatrix<ValueType>::getLowerPart(const size_type i) {
+    return this->lower.data() + this->offsets[i];
+  }  // end of getLowerPart
+
+  template <typename ValueType>
+  const ValueType* SkylineMatrix<ValueType>::getLowerPart(
+      const size_type i) const {
+    return this->lower.data() + this->offsets[i];
+  }  // end of getLowerPart
+
+  template <typename ValueType>
+  ValueType* SkylineMatrix<ValueType>::getUpperPart(const size_type j) {
+    return this->upper.data() + this->offsets[j];
+  }  // end of getUpperPart
+
+  template <typename ValueType>
+  const ValueType* SkylineMatrix<ValueType>::getUpperPart(
+      const size_type j) const {
+    return this->upper.data() + this->offsets[j];
+  }  // end of getUpperPart
+
+  template <typename ValueType>
+  ValueType& SkylineMatrix<ValueType>::getDiagonalTerm(const size_type i) {
+    return this->diagonal[i];
+  }  // end of getDiagonalTerm
+
+  template <typename ValueType>
+  const ValueType& SkylineMatrix<ValueType>::getDiagonalTerm(
+      const size_type i) const {
+    return this->diagonal[i];
+  }  // end of getDiagonalTerm
+
+  template <typename ValueType>
+  SkylineMatrix<ValueType>::~SkylineMatrix() = default;
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_SKYLINEMATRIX_IXX */
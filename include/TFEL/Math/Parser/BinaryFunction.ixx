@@ -65,6 +65,14 @@ namespace tfel::math::parser {
     return res;
   }  // end of StandardBinaryFunction::StandardBinaryFunction
 
+  template <double (*f)(const double, const double)>
+  std::vector<double>::size_type StandardBinaryFunction<f>::compile(
+      Bytecode& c) const {
+    const auto r1 = this->expr1->compile(c);
+    const auto r2 = this->expr2->compile(c);
+    return c.addFunctionCall(f, r1, r2);
+  }  // end of compile
+
   template <double (*f)(const double, const double)>
   void StandardBinaryFunction<f>::checkCyclicDependency(
       std::vector<std::string>& names) const {
@@ -22,6 +22,8 @@
 namespace tfel::math::parser {
 
   struct OpPlus {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::ADD;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -36,6 +38,8 @@ namespace tfel::math::parser {
   };  // end of struct OpPlus
 
   struct OpMinus {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::SUBSTRACT;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -50,6 +54,8 @@ namespace tfel::math::parser {
   };  // end of struct OpMinus
 
   struct OpMult {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::MULTIPLY;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -64,6 +70,8 @@ namespace tfel::math::parser {
   };  // end of struct OpMult
 
   struct OpDiv {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::DIVIDE;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -78,6 +86,8 @@ namespace tfel::math::parser {
   };  // end of struct OpDiv
 
   struct OpPower {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::POWER;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -105,6 +115,7 @@ namespace tfel::math::parser {
     //
     bool isConstant() const override;
     double getValue() const override final;
+    std::vector<double>::size_type compile(Bytecode&) const override final;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     std::string getCxxFormula(
         const std::vector<std::string>&) const override final;
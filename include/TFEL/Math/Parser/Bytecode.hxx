@@ -0,0 +1,313 @@
+/*!
+ * \file   include/TFEL/Math/Parser/Bytecode.hxx
+ * \brief  This file declares the `Bytecode` class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_PARSER_BYTECODE_HXX
+#define LIB_TFEL_MATH_PARSER_BYTECODE_HXX
+
+#include <map>
+#include <span>
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::math::parser {
+
+  // forward declaration
+  struct Expr;
+  // forward declaration
+  struct LogicalExpr;
+
+  /*!
+   * \brief a flat representation of an expression, as a linear sequence
+   * of instructions acting on registers.
+   *
+   * Each instruction stores its result in a dedicated register, so
+   * that:
+   *
+   * - instructions whose arguments are constant are evaluated once
+   *   and for all at compile-time (constant folding).
+   * - identical instructions acting on the same registers are only
+   *   emitted once (common subexpression elimination).
+   *
+   * The only exceptions are conditional expressions: the result of
+   * each branch is moved into the register associated with the
+   * conditional expression. Branches are only evaluated if selected,
+   * as in the tree representation.
+   *
+   * Expressions which can't be lowered (external functions, kriged
+   * functions, etc.) are evaluated by calling their `getValue` method.
+   *
+   * \note the bytecode keeps references to the nodes of the expression
+   * from which it has been built and to the vector holding the values
+   * of the variables. It must not outlive them.
+   */
+  struct TFELMATHPARSER_VISIBILITY_EXPORT Bytecode {
+    //! \brief a simple alias
+    using size_type = std::vector<double>::size_type;
+    //! \brief a simple alias
+    using UnaryFunctionPtr = double (*)(double);
+    //! \brief a simple alias
+    using BinaryFunctionPtr = double (*)(const double, const double);
+    //! \brief list of operations
+    enum OpCode : std::uint8_t {
+      //! \brief loading the value of a variable
+      LOAD,
+      //! \brief addition
+      ADD,
+      //! \brief substraction
+      SUBSTRACT,
+      //! \brief multiplication
+      MULTIPLY,
+      //! \brief division
+      DIVIDE,
+      //! \brief power of a number
+      POWER,
+      //! \brief opposite of a number
+      NEGATE,
+      //! \brief call to an unary function
+      CALL1,
+      //! \brief call to an unary function checking `errno`
+      CHECKED_CALL1,
+      //! \brief call to a binary function checking `errno`
+      CHECKED_CALL2,
+      //! \brief equality test
+      EQUAL,
+      //! \brief comparison operator `>`
+      GREATER,
+      //! \brief comparison operator `>=`
+      GREATER_OR_EQUAL,
+      //! \brief comparison operator `<`
+      LESSER,
+      //! \brief comparison operator `<=`
+      LESSER_OR_EQUAL,
+      //! \brief logical and
+      AND,
+      //! \brief logical or
+      OR,
+      //! \brief logical negation
+      NOT,
+      //! \brief jump if the argument is false
+      JUMP_IF_FALSE,
+      //! \brief unconditional jump
+      JUMP,
+      //! \brief copy of a register
+      MOVE,
+      //! \brief evaluation of an expression by its `getValue` method
+      EXPRESSION,
+      //! \brief evaluation of a logical expression by its `getValue`
+      //! method
+      LOGICAL_EXPRESSION
+    };  // end of enum OpCode
+    //! \brief an instruction
+    struct Instruction {
+      //! \brief operation
+      OpCode op;
+      //! \brief destination register
+      size_type d = 0;
+      //! \brief first argument
+      size_type a = 0;
+      //! \brief second argument
+      size_type b = 0;
+      //! \brief target of jumps
+      size_type target = 0;
+      //! \brief unary function
+      UnaryFunctionPtr f1 = nullptr;
+      //! \brief binary function
+      BinaryFunctionPtr f2 = nullptr;
+      //! \brief expression
+      const Expr* e = nullptr;
+      //! \brief logical expression
+      const LogicalExpr* l = nullptr;
+    };  // end of struct Instruction
+    /*!
+     * \brief build the bytecode associated with an expression
+     * \param[in] e: expression
+     * \param[in] v: values of the variables
+     */
+    Bytecode(const Expr&, const std::vector<double>&);
+    //! \return the result of the evaluation of the expression
+    double getValue() const;
+    /*!
+     * \return if the bytecode can be evaluated by the `evaluate`
+     * method, i.e. if all the nodes of the expression have been
+     * lowered.
+     */
+    bool isVectorizable() const noexcept;
+    /*!
+     * \brief evaluate the expression for a set of values of the
+     * variables.
+     *
+     * The values are treated by blocks: each instruction is applied
+     * to all the values of a block in a simple loop which can be
+     * vectorized by the compiler. If the values of a block don't
+     * select the same branch of a conditional expression, the values
+     * of this block are treated one by one.
+     *
+     * \param[in] v: values of the variables, sorted by position. The
+     * size of each array must be equal to the size of `r`.
+     * \param[out] r: results
+     * \pre the bytecode must be vectorizable.
+     */
+    void evaluate(std::span<const double* const>, std::span<double>) const;
+    //! \return the number of instructions
+    size_type getNumberOfInstructions() const noexcept;
+    //! \return the number of registers
+    size_type getNumberOfRegisters() const noexcept;
+    //! \return the instructions
+    const std::vector<Instruction>& getInstructions() const noexcept;
+    /*!
+     * \name methods used by the expressions to build the bytecode
+     *
+     * Those methods return the register in which the result is stored.
+     */
+    //! \{
+    /*!
+     * \brief add a constant
+     * \param[in] v: value
+     */
+    size_type addConstant(const double);
+    /*!
+     * \brief add the loading of a variable
+     * \param[in] e: expression associated with the variable
+     * \param[in] v: values of the variables
+     * \param[in] p: position of the variable
+     *
+     * If `v` is not the vector given to the constructor, the variable
+     * is evaluated by the `getValue` method of the expression.
+     */
+    size_type addVariable(const Expr&,
+                          const std::vector<double>&,
+                          const size_type);
+    /*!
+     * \brief add an unary operation (`NEGATE` or `NOT`)
+     * \param[in] op: operation
+     * \param[in] a: argument
+     */
+    size_type addOperation(const OpCode, const size_type);
+    /*!
+     * \brief add a binary operation
+     * \param[in] op: operation
+     * \param[in] a: first argument
+     * \param[in] b: second argument
+     */
+    size_type addOperation(const OpCode, const size_type, const size_type);
+    /*!
+     * \brief add a call to an unary function
+     * \param[in] f: function
+     * \param[in] a: argument
+     * \param[in] check_errno: check the value of `errno` after the call
+     */
+    size_type addFunctionCall(const UnaryFunctionPtr,
+                              const size_type,
+                              const bool);
+    /*!
+     * \brief add a call to a binary function. The value of `errno` is
+     * checked after the call.
+     * \param[in] f: function
+     * \param[in] a: first argument
+     * \param[in] b: second argument
+     */
+    size_type addFunctionCall(const BinaryFunctionPtr,
+                              const size_type,
+                              const size_type);
+    /*!
+     * \brief add a conditional expression
+     * \param[in] c: condition
+     * \param[in] a: expression evaluated if the condition is true
+     * \param[in] b: expression evaluated if the condition is false
+     */
+    size_type addConditionalExpression(const LogicalExpr&,
+                                       const Expr&,
+                                       const Expr&);
+    /*!
+     * \brief add an expression evaluated by its `getValue` method
+     * \param[in] e: expression
+     */
+    size_type addExpression(const Expr&);
+    /*!
+     * \brief add a logical expression evaluated by its `getValue`
+     * method
+     * \param[in] e: expression
+     */
+    size_type addLogicalExpression(const LogicalExpr&);
+    //! \}
+   private:
+    //! \brief a simple alias
+    using Key = std::tuple<OpCode, size_type, size_type, std::uintptr_t>;
+    //! \brief add a new register
+    size_type addRegister();
+    /*!
+     * \brief add an instruction, unless an identical instruction has
+     * already been added or the instruction can be evaluated at
+     * compile-time.
+     * \param[in] i: instruction
+     * \param[in] k: key used to identify identical instructions
+     */
+    size_type addInstruction(Instruction, const Key&);
+    //! \return if the given register holds a constant
+    bool isConstant(const size_type) const;
+    /*!
+     * \brief renumber the registers so that the constants are stored
+     * in the first registers.
+     */
+    void finalize();
+    //! \brief execute the given instructions
+    static void execute(double* const,
+                        const double* const,
+                        const Instruction* const,
+                        const Instruction* const);
+    /*!
+     * \brief execute the given instructions on a block of values
+     * \return false if the values of the block don't select the same
+     * branch of a conditional expression.
+     * \param[in] r: registers. Each register holds the values
+     * associated with the block.
+     * \param[in] v: values of the variables
+     * \param[in] o: offset of the block
+     * \param[in] n: size of the block
+     * \param[in] pb: first instruction
+     * \param[in] pe: past-the-end instruction
+     */
+    static bool execute(double* const,
+                        std::span<const double* const>,
+                        const size_type,
+                        const size_type,
+                        const Instruction* const,
+                        const Instruction* const);
+    //! \brief values of the variables
+    const std::vector<double>& variables;
+    //! \brief instructions
+    std::vector<Instruction> instructions;
+    //! \brief values of the constants, stored in the first registers
+    std::vector<double> constants;
+    /*!
+     * \brief values of the registers holding constants. Those values
+     * are only meaningful during the build of the bytecode.
+     */
+    std::vector<double> constant_values;
+    //! \brief flags stating if a register holds a constant
+    std::vector<bool> constant_registers;
+    //! \brief registers associated with constants, indexed by their bits
+    std::map<std::uint64_t, size_type> constants_registers;
+    //! \brief instructions already emitted in the current block
+    std::map<Key, size_type> emitted;
+    //! \brief number of registers
+    size_type nregisters = 0;
+    //! \brief register holding the result
+    size_type result = 0;
+  };  // end of struct Bytecode
+
+}  // end of namespace tfel::math::parser
+
+#endif /* LIB_TFEL_MATH_PARSER_BYTECODE_HXX */
@@ -20,6 +20,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include "TFEL/Math/Parser/Bytecode.hxx"
 
 namespace tfel::math::parser {
 
@@ -38,6 +39,15 @@ namespace tfel::math::parser {
     virtual bool isConstant() const = 0;
     //! \return the result of the evaluation of the expression
     virtual double getValue() const = 0;
+    /*!
+     * \brief add the instructions evaluating the expression to the
+     * given bytecode.
+     * \return the register holding the result of the evaluation
+     * \param[in,out] c: bytecode
+     *
+     * By default, the expression is evaluated by its `getValue` method.
+     */
+    virtual std::vector<double>::size_type compile(Bytecode&) const;
     //! \brief check if the expression does not lead to a cyclic dependency
     virtual void checkCyclicDependency(std::vector<std::string>&) const = 0;
     virtual std::shared_ptr<Expr> resolveDependencies(
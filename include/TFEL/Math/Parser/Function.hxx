@@ -72,6 +72,7 @@ namespace tfel::math::parser {
      */
     StandardFunction(const char* const, const std::shared_ptr<Expr>) noexcept;
     double getValue() const override;
+    std::vector<double>::size_type compile(Bytecode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     std::shared_ptr<Expr> resolveDependencies(
         const std::vector<double>&) const override;
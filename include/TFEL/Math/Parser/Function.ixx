@@ -57,6 +57,12 @@ namespace tfel::math::parser {
     return res;
   }  // end of getValue
 
+  template <StandardFunctionPtr f>
+  std::vector<double>::size_type StandardFunction<f>::compile(
+      Bytecode& c) const {
+    return c.addFunctionCall(f, this->expr->compile(c), true);
+  }  // end of compile
+
   template <StandardFunctionPtr f>
   std::string StandardFunction<f>::getCxxFormula(
       const std::vector<std::string>& m) const {
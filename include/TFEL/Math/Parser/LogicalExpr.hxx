@@ -26,6 +26,8 @@
 namespace tfel::math::parser {
 
   struct OpEqual {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::EQUAL;
     static bool apply(const double, const double);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -37,6 +39,8 @@ namespace tfel::math::parser {
   };  // end of struct OpEqual
 
   struct OpGreater {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::GREATER;
     static bool apply(const double, const double);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -48,6 +52,8 @@ namespace tfel::math::parser {
   };  // end of struct OpGreater
 
   struct OpGreaterOrEqual {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::GREATER_OR_EQUAL;
     static bool apply(const double, const double);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -59,6 +65,8 @@ namespace tfel::math::parser {
   };  // end of struct OpGreaterOrEqual
 
   struct OpLesser {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::LESSER;
     static bool apply(const double, const double);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -70,6 +78,8 @@ namespace tfel::math::parser {
   };  // end of struct OpLess
 
   struct OpLesserOrEqual {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::LESSER_OR_EQUAL;
     static bool apply(const double, const double);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -81,6 +91,8 @@ namespace tfel::math::parser {
   };  // end of struct OpLessOrEqual
 
   struct OpAnd {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::AND;
     static bool apply(const bool, const bool);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -92,6 +104,8 @@ namespace tfel::math::parser {
   };  // end of struct OpAnd
 
   struct OpOr {
+    //! \brief associated bytecode operation
+    static constexpr auto opcode = Bytecode::OR;
     static bool apply(const bool, const bool);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -108,6 +122,16 @@ namespace tfel::math::parser {
   struct LogicalExpr {
     //! \return the result of the evaluation of the logical expression
     virtual bool getValue() const = 0;
+    /*!
+     * \brief add the instructions evaluating the logical expression to
+     * the given bytecode. The result is stored as `1` if the logical
+     * expression is true, `0` otherwise.
+     * \return the register holding the result of the evaluation
+     * \param[in,out] c: bytecode
+     *
+     * By default, the expression is evaluated by its `getValue` method.
+     */
+    virtual std::vector<double>::size_type compile(Bytecode&) const;
     //! \brief return if the expression is constant
     virtual bool isConstant() const = 0;
     /*!
@@ -148,6 +172,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    std::vector<double>::size_type compile(Bytecode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
@@ -176,6 +201,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    std::vector<double>::size_type compile(Bytecode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
@@ -202,6 +228,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    std::vector<double>::size_type compile(Bytecode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
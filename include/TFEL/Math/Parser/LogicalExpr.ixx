@@ -42,6 +42,14 @@ namespace tfel::math::parser {
     return Op::apply(this->a->getValue(), this->b->getValue());
   }  // end of getValue
 
+  template <typename Op>
+  std::vector<double>::size_type LogicalOperation<Op>::compile(
+      Bytecode& c) const {
+    const auto ra = this->a->compile(c);
+    const auto rb = this->b->compile(c);
+    return c.addOperation(Op::opcode, ra, rb);
+  }  // end of compile
+
   template <typename Op>
   std::string LogicalOperation<Op>::getCxxFormula(
       const std::vector<std::string>& m) const {
@@ -117,6 +125,14 @@ namespace tfel::math::parser {
     return Op::apply(this->a->getValue(), this->b->getValue());
   }  // end of getValue
 
+  template <typename Op>
+  std::vector<double>::size_type LogicalBinaryOperation<Op>::compile(
+      Bytecode& c) const {
+    const auto ra = this->a->compile(c);
+    const auto rb = this->b->compile(c);
+    return c.addOperation(Op::opcode, ra, rb);
+  }  // end of compile
+
   template <typename Op>
   std::string LogicalBinaryOperation<Op>::getCxxFormula(
       const std::vector<std::string>& m) const {
@@ -50,6 +50,7 @@ namespace tfel::math::parser {
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     //! \return the number value
     double getValue() const override;
+    std::vector<double>::size_type compile(Bytecode&) const override;
     //! \brief destructor
     ~Number() override;
 
@@ -33,7 +33,13 @@ namespace tfel::math::parser {
      * \param[in] e: expression
      */
     PowerFunction(const std::shared_ptr<Expr>) noexcept;
+    /*!
+     * \return the `N`-th power of the given value
+     * \param[in] x: value
+     */
+    static double compute(const double);
     double getValue() const override;
+    std::vector<double>::size_type compile(Bytecode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     std::shared_ptr<Expr> resolveDependencies(
         const std::vector<double>&) const override;
@@ -32,19 +32,36 @@ namespace tfel::math::parser {
       : Function(e) {}  // end of PowerFunction
 
   template <int N>
-  double PowerFunction<N>::getValue() const {
+  double PowerFunction<N>::compute(const double arg) {
     if constexpr (N == 0) {
       return 1;
     }
-    const auto arg = this->expr->getValue();
     if constexpr (N < 0) {
       if (tfel::math::ieee754::fpclassify(arg) == FP_ZERO) {
         FunctionBase::throwInvalidCallException(arg, EINVAL);
       }
     }
     return tfel::math::power<N>(arg);
+  }  // end of compute
+
+  template <int N>
+  double PowerFunction<N>::getValue() const {
+    if constexpr (N == 0) {
+      return 1;
+    }
+    return PowerFunction<N>::compute(this->expr->getValue());
   }  // end of getValue
 
+  template <int N>
+  std::vector<double>::size_type PowerFunction<N>::compile(
+      Bytecode& c) const {
+    if constexpr (N == 0) {
+      return c.addConstant(1);
+    }
+    return c.addFunctionCall(&PowerFunction<N>::compute,
+                             this->expr->compile(c), false);
+  }  // end of compile
+
   template <int N>
   std::string PowerFunction<N>::getCxxFormula(
       const std::vector<std::string>& m) const {
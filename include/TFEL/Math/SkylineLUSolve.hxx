@@ -0,0 +1,142 @@
+/*!
+ * \file   include/TFEL/Math/SkylineLUSolve.hxx
+ * \brief  This file declares the `SkylineLUSolve` class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_SKYLINELUSOLVE_HXX
+#define LIB_TFEL_MATH_SKYLINELUSOLVE_HXX
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+#include "TFEL/Math/SkylineMatrix.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief This structure contains static methods for solving linear
+   * systems by LU decomposition of matrices stored in skyline format.
+   *
+   * No pivoting is performed, so that the decomposition preserves the
+   * profile of the matrix. The cost of the decomposition is thus
+   * proportional to the sum of the squares of the heights of the
+   * columns of the matrix, i.e. `n*b*b` for a banded matrix of size
+   * `n` and half-bandwidth `b`.
+   */
+  struct SkylineLUSolve {
+    /*!
+     * \brief compute the LU decomposition of the given matrix in place.
+     * The lower triangular matrix `L` has unit diagonal terms which are
+     * not stored.
+     * \param[in,out] m: matrix
+     * \param[in] eps: numerical parameter used to detect null pivot
+     */
+    template <typename ValueType>
+    static void decomp(
+        SkylineMatrix<ValueType>& m,
+        const ValueType eps = 100 * std::numeric_limits<ValueType>::min()) {
+      using size_type = typename SkylineMatrix<ValueType>::size_type;
+      const auto n = m.getNbRows();
+      if (n == 0) {
+        throw(LUInvalidMatrixSize());
+      }
+      for (size_type i = 0; i != n; ++i) {
+        const auto fi = m.getFirstIndex(i);
+        auto* const li = m.getLowerPart(i);
+        auto* const ui = m.getUpperPart(i);
+        for (size_type j = fi; j != i; ++j) {
+          const auto fj = m.getFirstIndex(j);
+          const auto k0 = std::max(fi, fj);
+          const auto* const lj = m.getLowerPart(j);
+          const auto* const uj = m.getUpperPart(j);
+          auto su = ui[j - fi];
+          auto sl = li[j - fi];
+          for (size_type k = k0; k != j; ++k) {
+            su -= lj[k - fj] * ui[k - fi];
+            sl -= li[k - fi] * uj[k - fj];
+          }
+          ui[j - fi] = su;
+          li[j - fi] = sl / m.getDiagonalTerm(j);
+        }
+        auto& d = m.getDiagonalTerm(i);
+        for (size_type k = fi; k != i; ++k) {
+          d -= li[k - fi] * ui[k - fi];
+        }
+        if (std::abs(d) < eps) {
+          throw(LUNullPivot());
+        }
+      }
+    }  // end of decomp
+    /*!
+     * \brief solve the linear system `m.x=b` knowing the LU
+     * decomposition of `m`.
+     * \param[in] m: LU decomposition of the matrix
+     * \param[in,out] b: right hand side on input, solution on output
+     */
+    template <typename ValueType, typename VectorType>
+    static void back_substitute(const SkylineMatrix<ValueType>& m,
+                                VectorType& b) {
+      using size_type = typename SkylineMatrix<ValueType>::size_type;
+      const auto n = m.getNbRows();
+      if (m.getNbRows() != b.size()) {
+        throw(LUUnmatchedSize());
+      }
+      if (n == 0) {
+        throw(LUInvalidMatrixSize());
+      }
+      // forward substitution
+      for (size_type i = 0; i != n; ++i) {
+        const auto fi = m.getFirstIndex(i);
+        const auto* const li = m.getLowerPart(i);
+        auto v = b(i);
+        for (size_type k = fi; k != i; ++k) {
+          v -= li[k - fi] * b(k);
+        }
+        b(i) = v;
+      }
+      // backward substitution, column oriented
+      for (size_type i = n; i != 0; --i) {
+        const auto j = i - 1;
+        const auto fj = m.getFirstIndex(j);
+        const auto* const uj = m.getUpperPart(j);
+        b(j) /= m.getDiagonalTerm(j);
+        const auto xj = b(j);
+        for (size_type k = fj; k != j; ++k) {
+          b(k) -= uj[k - fj] * xj;
+        }
+      }
+    }  // end of back_substitute
+    /*!
+     * \brief solve the linear system `m.x=b`.
+     * \param[in,out] m: matrix. On output, `m` contains its LU
+     * decomposition.
+     * \param[in,out] b: right hand side on input, solution on output
+     * \param[in] eps: numerical parameter used to detect null pivot
+     */
+    template <typename ValueType, typename VectorType>
+    static void exe(
+        SkylineMatrix<ValueType>& m,
+        VectorType& b,
+        const ValueType eps = 100 * std::numeric_limits<ValueType>::min()) {
+      if (m.getNbRows() != b.size()) {
+        throw(LUUnmatchedSize());
+      }
+      SkylineLUSolve::decomp(m, eps);
+      SkylineLUSolve::back_substitute(m, b);
+    }  // end of exe
+
+  };  // end of struct SkylineLUSolve
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_SKYLINELUSOLVE_HXX */
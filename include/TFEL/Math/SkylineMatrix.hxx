@@ -0,0 +1,159 @@
+/*!
+ * \file   include/TFEL/Math/SkylineMatrix.hxx
+ * \brief  This file declares the `SkylineMatrix` class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_SKYLINEMATRIX_HXX
+#define LIB_TFEL_MATH_SKYLINEMATRIX_HXX
+
+#include <vector>
+#include <cstddef>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief a square matrix stored in skyline (profile) format.
+   *
+   * The profile is symmetric, but the values are not: for each row
+   * `i`, the matrix stores the diagonal term, the terms of the lower
+   * part of row `i` and the terms of the upper part of column `i`
+   * from the index `getFirstIndex(i)` up to `i-1`. All the terms
+   * outside the profile are assumed null.
+   *
+   * This storage is well suited for finite element problems whose
+   * stiffness matrix is banded, with possibly a few coupling
+   * unknowns (Lagrange multipliers, generalised strains) stored at
+   * the end: the LU decomposition without pivoting preserves the
+   * profile.
+   *
+   * \tparam ValueType: type of values hold by the matrix
+   */
+  template <typename ValueType>
+  struct SkylineMatrix {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief a simple alias
+    using value_type = ValueType;
+    //! \brief default constructor
+    SkylineMatrix();
+    /*!
+     * \brief constructor
+     * \param[in] f: index of the first non null term of each row (and
+     * each column) of the matrix. By definition, `f[i]<=i`.
+     */
+    SkylineMatrix(const std::vector<size_type>&);
+    //! \brief move constructor
+    SkylineMatrix(SkylineMatrix&&);
+    //! \brief copy constructor
+    SkylineMatrix(const SkylineMatrix&);
+    //! \brief move assignement
+    SkylineMatrix& operator=(SkylineMatrix&&);
+    //! \brief standard assignement
+    SkylineMatrix& operator=(const SkylineMatrix&);
+    /*!
+     * \brief change the profile of the matrix. All values are set to
+     * zero.
+     * \param[in] f: index of the first non null term of each row (and
+     * each column) of the matrix.
+     */
+    void resize(const std::vector<size_type>&);
+    /*!
+     * \brief build a profile suitable for a banded matrix, possibly
+     * bordered by some full rows and columns.
+     * \param[in] n: size of the banded part of the matrix
+     * \param[in] b: half-bandwidth of the banded part of the matrix
+     * \param[in] nb: number of full rows and columns appended at the
+     * end of the matrix
+     */
+    static std::vector<size_type> getBandedProfile(const size_type,
+                                                   const size_type,
+                                                   const size_type = 0);
+    //! \brief clear the matrix
+    void clear();
+    //! \brief set all the values stored in the profile to zero
+    void zero();
+    //! \return the number of rows
+    size_type getNbRows() const;
+    //! \return the number of columns
+    size_type getNbCols() const;
+    //! \return the number of values stored
+    size_type getNumberOfStoredValues() const;
+    /*!
+     * \return the index of the first non null term of the given row
+     * (and column)
+     * \param[in] i: row index
+     */
+    size_type getFirstIndex(const size_type) const;
+    /*!
+     * \return if the given term belongs to the profile of the matrix
+     * \param[in] i: row index
+     * \param[in] j: column index
+     */
+    bool isInProfile(const size_type, const size_type) const;
+    /*!
+     * \return a reference to the given term.
+     * \param[in] i: row index
+     * \param[in] j: column index
+     * \note an exception is thrown if the term does not belong to the
+     * profile of the matrix.
+     */
+    ValueType& operator()(const size_type, const size_type);
+    /*!
+     * \return the value of the given term or zero if this term does
+     * not belong to the profile of the matrix.
+     * \param[in] i: row index
+     * \param[in] j: column index
+     */
+    ValueType operator()(const size_type, const size_type) const;
+    /*!
+     * \return a pointer to the values of the lower part of the given
+     * row. The first value corresponds to the term
+     * `(i,getFirstIndex(i))`.
+     * \param[in] i: row index
+     */
+    ValueType* getLowerPart(const size_type);
+    //! \copydoc getLowerPart
+    const ValueType* getLowerPart(const size_type) const;
+    /*!
+     * \return a pointer to the values of the upper part of the given
+     * column. The first value corresponds to the term
+     * `(getFirstIndex(j),j)`.
+     * \param[in] j: column index
+     */
+    ValueType* getUpperPart(const size_type);
+    //! \copydoc getUpperPart
+    const ValueType* getUpperPart(const size_type) const;
+    //! \return a reference to the ith diagonal term
+    ValueType& getDiagonalTerm(const size_type);
+    //! \return the ith diagonal term
+    const ValueType& getDiagonalTerm(const size_type) const;
+    //! \brief destructor
+    ~SkylineMatrix();
+
+   protected:
+    //! \brief index of the first non null term of each row and column
+    std::vector<size_type> first;
+    //! \brief offset of each row (and column) in `lower` and `upper`
+    std::vector<size_type> offsets;
+    //! \brief diagonal terms
+    std::vector<ValueType> diagonal;
+    //! \brief lower part of the matrix, stored row by row
+    std::vector<ValueType> lower;
+    //! \brief upper part of the matrix, stored column by column
+    std::vector<ValueType> upper;
+  };  // end of struct SkylineMatrix
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/Matrix/SkylineMatrix.ixx"
+
+#endif /* LIB_TFEL_MATH_SKYLINEMATRIX_HXX */
@@ -0,0 +1,146 @@
+/*!
+ * \file   include/TFEL/Math/Stensor/StensorBatchedEigenSolver.hxx
+ * \brief  This file declares the `StensorBatchedEigenSolver` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_HXX
+#define LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_HXX
+
+#include <span>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Math/stensor.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief compute the eigen values and the eigen vectors of a set of
+   * symmetric tensors.
+   *
+   * The tensors are stored by components (structure of arrays): if
+   * \f$n\f$ is the number of tensors, the \f$c\f$-th component of the
+   * \f$i\f$-th tensor is stored at the position \f$c\,n+i\f$. The
+   * components follow the conventions of the `stensor` class, i.e. the
+   * off-diagonal components are multiplied by \f$\sqrt{2}\f$. The results
+   * are stored following the same layout:
+   *
+   * - the \f$k\f$-th eigen value of the \f$i\f$-th tensor is stored at
+   *   the position \f$k\,n+i\f$,
+   * - the component \f$\left(r,c\right)\f$ of the rotation matrix of
+   *   the \f$i\f$-th tensor, i.e. the \f$r\f$-th component of its
+   *   \f$c\f$-th eigen vector, is stored at the position
+   *   \f$\left(3\,r+c\right)\,n+i\f$.
+   *
+   * The tensors are treated by blocks of `blockSize` tensors, copied
+   * in local arrays. The same operations are applied to all the tensors
+   * of a block without data-dependent branches, so that the loops over
+   * the tensors of a block can be vectorized by the compiler:
+   *
+   * - in \f$2D\f$, one Jacobi rotation diagonalizes the tensors exactly.
+   * - in \f$3D\f$, cyclic Jacobi sweeps are performed until all the
+   *   tensors of the block are diagonal up to the machine precision.
+   *
+   * \note with `gcc`, the loops involving square roots are only
+   * vectorized if the `-fno-math-errno` flag is used.
+   *
+   * \tparam N: space dimension
+   * \tparam real: numeric type
+   */
+  template <unsigned short N, typename real>
+  struct StensorBatchedEigenSolver {
+    static_assert((N == 1u) || (N == 2u) || (N == 3u),
+                  "invalid space dimension");
+    static_assert(std::is_floating_point_v<real>, "invalid numeric type");
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief a simple alias
+    using EigenValuesOrdering = stensor_common::EigenValuesOrdering;
+    //! \brief number of tensors treated simultaneously
+    static constexpr size_type blockSize = 8;
+    //! \brief maximum number of Jacobi sweeps
+    static constexpr unsigned short maximumNumberOfSweeps = 10;
+    /*!
+     * \brief compute the eigen values of a set of symmetric tensors
+     * \param[out] vp: eigen values
+     * \param[in] s: symmetric tensors
+     * \param[in] o: eigen values ordering
+     */
+    static void computeEigenValues(
+        std::span<real>,
+        std::span<const real>,
+        const EigenValuesOrdering = stensor_common::UNSORTED);
+    /*!
+     * \brief compute the eigen values and the eigen vectors of a set of
+     * symmetric tensors
+     * \param[out] vp: eigen values
+     * \param[out] m: rotation matrices
+     * \param[in] s: symmetric tensors
+     * \param[in] o: eigen values ordering
+     */
+    static void computeEigenVectors(
+        std::span<real>,
+        std::span<real>,
+        std::span<const real>,
+        const EigenValuesOrdering = stensor_common::UNSORTED);
+
+   private:
+    /*!
+     * \brief components of the tensors of a block. The three first
+     * components are the diagonal ones, the last ones are the
+     * off-diagonal components \f$01\f$, \f$02\f$ and \f$12\f$, without
+     * the \f$\sqrt{2}\f$ factor.
+     */
+    using Block = std::array<std::array<real, blockSize>, 6u>;
+    //! \brief rotation matrices of the tensors of a block
+    using RotationMatricesBlock = std::array<std::array<real, blockSize>, 9u>;
+    /*!
+     * \brief compute the eigen values, and the eigen vectors if
+     * requested, of a set of symmetric tensors
+     * \tparam withEigenVectors: compute the eigen vectors
+     * \param[out] vp: eigen values
+     * \param[out] m: rotation matrices
+     * \param[in] s: symmetric tensors
+     * \param[in] o: eigen values ordering
+     */
+    template <bool withEigenVectors>
+    static void exe(std::span<real>,
+                    std::span<real>,
+                    std::span<const real>,
+                    const EigenValuesOrdering);
+    /*!
+     * \brief apply a Jacobi rotation cancelling the off-diagonal
+     * component \f$pq\f$.
+     * \param[in,out] a: tensors
+     * \param[in,out] v: rotation matrices
+     */
+    template <unsigned short p, unsigned short q, bool withEigenVectors>
+    static void rotate(Block&, RotationMatricesBlock&) noexcept;
+    //! \return if all the tensors of the block are diagonal
+    static bool isDiagonal(const Block&) noexcept;
+    /*!
+     * \brief swap the eigen values \f$i\f$ and \f$j\f$, and the
+     * associated eigen vectors, when they are not in the requested order
+     * \param[in,out] a: tensors
+     * \param[in,out] v: rotation matrices
+     */
+    template <unsigned short i,
+              unsigned short j,
+              bool ascending,
+              bool withEigenVectors>
+    static void sort(Block&, RotationMatricesBlock&) noexcept;
+  };  // end of struct StensorBatchedEigenSolver
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/Stensor/StensorBatchedEigenSolver.ixx"
+
+#endif /* LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_HXX */
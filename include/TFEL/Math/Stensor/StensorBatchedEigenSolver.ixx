@@ -0,0 +1,215 @@
+/*!
+ * \file   include/TFEL/Math/Stensor/StensorBatchedEigenSolver.ixx
+ * \brief  This file implements the `StensorBatchedEigenSolver` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_IXX
+#define LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_IXX
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/General/MathConstants.hxx"
+
+namespace tfel::math {
+
+  template <unsigned short N, typename real>
+  void StensorBatchedEigenSolver<N, real>::computeEigenValues(
+      std::span<real> vp,
+      std::span<const real> s,
+      const EigenValuesOrdering o) {
+    StensorBatchedEigenSolver::exe<false>(vp, std::span<real>{}, s, o);
+  }  // end of computeEigenValues
+
+  template <unsigned short N, typename real>
+  void StensorBatchedEigenSolver<N, real>::computeEigenVectors(
+      std::span<real> vp,
+      std::span<real> m,
+      std::span<const real> s,
+      const EigenValuesOrdering o) {
+    StensorBatchedEigenSolver::exe<true>(vp, m, s, o);
+  }  // end of computeEigenVectors
+
+  template <unsigned short N, typename real>
+  template <bool withEigenVectors>
+  void StensorBatchedEigenSolver<N, real>::exe(std::span<real> vp,
+                                               std::span<real> m,
+                                               std::span<const real> s,
+                                               const EigenValuesOrdering o) {
+    constexpr auto ssize = StensorDimeToSize<N>::value;
+    constexpr auto icste = Cste<real>::isqrt2;
+    raise_if(s.size() % ssize != 0,
+             "StensorBatchedEigenSolver::exe: "
+             "invalid number of components");
+    const auto n = s.size() / ssize;
+    raise_if(vp.size() != 3 * n,
+             "StensorBatchedEigenSolver::exe: "
+             "invalid size of the array of eigen values");
+    if constexpr (withEigenVectors) {
+      raise_if(m.size() != 9 * n,
+               "StensorBatchedEigenSolver::exe: "
+               "invalid size of the array of rotation matrices");
+    }
+    auto a = Block{};
+    auto v = RotationMatricesBlock{};
+    for (size_type i0 = 0; i0 < n; i0 += blockSize) {
+      const auto nb = std::min(blockSize, n - i0);
+      for (unsigned short c = 0; c != 6; ++c) {
+        if (c >= ssize) {
+          a[c].fill(real(0));
+          continue;
+        }
+        const auto cste = (c < 3) ? real(1) : icste;
+        const auto* const sc = s.data() + c * n + i0;
+        if (nb == blockSize) {
+          for (size_type l = 0; l != blockSize; ++l) {
+            a[c][l] = sc[l] * cste;
+          }
+        } else {
+          // the last block is completed by repeating its last tensor
+          for (size_type l = 0; l != blockSize; ++l) {
+            a[c][l] = sc[std::min(l, nb - 1)] * cste;
+          }
+        }
+      }
+      if constexpr (withEigenVectors) {
+        for (unsigned short c = 0; c != 9; ++c) {
+          v[c].fill((c % 4 == 0) ? real(1) : real(0));
+        }
+      }
+      if constexpr (N == 2) {
+        rotate<0, 1, withEigenVectors>(a, v);
+      } else if constexpr (N == 3) {
+        for (unsigned short sweep = 0;
+             (sweep != maximumNumberOfSweeps) && (!isDiagonal(a)); ++sweep) {
+          rotate<0, 1, withEigenVectors>(a, v);
+          rotate<0, 2, withEigenVectors>(a, v);
+          rotate<1, 2, withEigenVectors>(a, v);
+        }
+      }
+      // as in the `stensor` class, the eigen values are not sorted in
+      // 1D and the out of plane eigen value is the last one in 2D
+      if constexpr (N == 2) {
+        if (o == stensor_common::ASCENDING) {
+          sort<0, 1, true, withEigenVectors>(a, v);
+        } else if (o == stensor_common::DESCENDING) {
+          sort<0, 1, false, withEigenVectors>(a, v);
+        }
+      } else if constexpr (N == 3) {
+        if (o == stensor_common::ASCENDING) {
+          sort<0, 1, true, withEigenVectors>(a, v);
+          sort<1, 2, true, withEigenVectors>(a, v);
+          sort<0, 1, true, withEigenVectors>(a, v);
+        } else if (o == stensor_common::DESCENDING) {
+          sort<0, 1, false, withEigenVectors>(a, v);
+          sort<1, 2, false, withEigenVectors>(a, v);
+          sort<0, 1, false, withEigenVectors>(a, v);
+        }
+      }
+      for (unsigned short k = 0; k != 3; ++k) {
+        for (size_type l = 0; l != nb; ++l) {
+          vp[k * n + i0 + l] = a[k][l];
+        }
+      }
+      if constexpr (withEigenVectors) {
+        for (unsigned short c = 0; c != 9; ++c) {
+          for (size_type l = 0; l != nb; ++l) {
+            m[c * n + i0 + l] = v[c][l];
+          }
+        }
+      }
+    }
+  }  // end of exe
+
+  template <unsigned short N, typename real>
+  template <unsigned short p, unsigned short q, bool withEigenVectors>
+  void StensorBatchedEigenSolver<N, real>::rotate(
+      Block& a, RotationMatricesBlock& v) noexcept {
+    constexpr unsigned short r = 3 - p - q;
+    // positions of the off-diagonal components
+    constexpr unsigned short pq = 2 + p + q;
+    constexpr unsigned short pr = 2 + p + r;
+    constexpr unsigned short qr = 2 + q + r;
+    for (size_type l = 0; l != blockSize; ++l) {
+      const auto apq = a[pq][l];
+      const auto d = a[q][l] - a[p][l];
+      // tangent of the rotation angle, see Numerical Recipes, Section
+      // 11.1. The denominator only vanishes if apq is null, so adding the
+      // smallest positive number avoids a test and gives a null tangent.
+      const auto t = std::copysign(real(2), d) * apq /
+                     (std::abs(d) + std::sqrt(d * d + 4 * apq * apq) +
+                      std::numeric_limits<real>::min());
+      const auto c = 1 / std::sqrt(1 + t * t);
+      const auto sn = t * c;
+      a[p][l] -= t * apq;
+      a[q][l] += t * apq;
+      a[pq][l] = real(0);
+      // in 2D, the components 02 and 12 are null, as well as the
+      // components of the rotation matrices which are affected by the
+      // rotation in the third row.
+      if constexpr (N == 3) {
+        const auto arp = a[pr][l];
+        const auto arq = a[qr][l];
+        a[pr][l] = c * arp - sn * arq;
+        a[qr][l] = sn * arp + c * arq;
+      }
+      if constexpr (withEigenVectors) {
+        for (unsigned short k = 0; k != (N == 3 ? 3 : 2); ++k) {
+          const auto vkp = v[3 * k + p][l];
+          const auto vkq = v[3 * k + q][l];
+          v[3 * k + p][l] = c * vkp - sn * vkq;
+          v[3 * k + q][l] = sn * vkp + c * vkq;
+        }
+      }
+    }
+  }  // end of rotate
+
+  template <unsigned short N, typename real>
+  bool StensorBatchedEigenSolver<N, real>::isDiagonal(
+      const Block& a) noexcept {
+    constexpr auto eps = std::numeric_limits<real>::epsilon();
+    auto r = real(0);
+    for (size_type l = 0; l != blockSize; ++l) {
+      const auto d = a[0][l] * a[0][l] + a[1][l] * a[1][l] + a[2][l] * a[2][l];
+      const auto o = a[3][l] * a[3][l] + a[4][l] * a[4][l] + a[5][l] * a[5][l];
+      r = std::max(r, o - eps * eps * d);
+    }
+    return !(r > 0);
+  }  // end of isDiagonal
+
+  template <unsigned short N, typename real>
+  template <unsigned short i,
+            unsigned short j,
+            bool ascending,
+            bool withEigenVectors>
+  void StensorBatchedEigenSolver<N, real>::sort(
+      Block& a, RotationMatricesBlock& v) noexcept {
+    for (size_type l = 0; l != blockSize; ++l) {
+      const auto ai = a[i][l];
+      const auto aj = a[j][l];
+      const auto b = ascending ? (aj < ai) : (ai < aj);
+      a[i][l] = b ? aj : ai;
+      a[j][l] = b ? ai : aj;
+      if constexpr (withEigenVectors) {
+        for (unsigned short k = 0; k != 3; ++k) {
+          const auto vki = v[3 * k + i][l];
+          const auto vkj = v[3 * k + j][l];
+          v[3 * k + i][l] = b ? vkj : vki;
+          v[3 * k + j][l] = b ? vki : vkj;
+        }
+      }
+    }
+  }  // end of sort
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_IXX */
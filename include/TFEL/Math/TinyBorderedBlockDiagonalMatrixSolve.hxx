@@ -0,0 +1,178 @@
+/*!
+ * \file   include/TFEL/Math/TinyBorderedBlockDiagonalMatrixSolve.hxx
+ * \brief  This file declares the `TinyBorderedBlockDiagonalMatrixSolve`
+ * class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_TINYBORDEREDBLOCKDIAGONALMATRIXSOLVE_HXX
+#define LIB_TFEL_MATH_TINYBORDEREDBLOCKDIAGONALMATRIXSOLVE_HXX
+
+#include <array>
+#include <limits>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/TinyMatrixSolve.hxx"
+#include "TFEL/Math/LU/TinyPermutation.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief solve a linear system whose matrix is block diagonal with a
+   * border, up to a permutation of the unknowns:
+   *
+   * \f[
+   * \left(
+   * \begin{array}{cccc}
+   * A_{1} &        &         & B_{1}  \\
+   *       & \ddots &         & \vdots \\
+   *       &        & A_{N_b} & B_{N_b} \\
+   * C_{1} & \cdots & C_{N_b} & D
+   * \end{array}
+   * \right)
+   * \f]
+   *
+   * Each diagonal block \f$A_{i}\f$ is factorized independently and the
+   * unknowns of the border are the solution of the Schur complement
+   * \f$D-\sum_{i}C_{i}\,A_{i}^{-1}\,B_{i}\f$. The cost of the resolution
+   * is proportional to \f$N_b\,B_s^{3}\f$ instead of \f$N^{3}\f$.
+   *
+   * The permutation `p` gives, for each unknown of the permuted system,
+   * its index in the original system: the `Bs` unknowns of the `i`-th
+   * block are `p[i*Bs]`, ..., `p[(i+1)*Bs-1]` and the unknowns of the
+   * border are the last `N-Nb*Bs` ones. The terms of the matrix which
+   * couple two different blocks are assumed to be null and are not
+   * read.
+   *
+   * \tparam N: size of the system
+   * \tparam Nb: number of diagonal blocks
+   * \tparam Bs: size of the diagonal blocks
+   * \tparam T: numeric type
+   * \tparam use_exceptions: if false, failures are reported by the
+   * returned value
+   */
+  template <unsigned short N,
+            unsigned short Nb,
+            unsigned short Bs,
+            typename T,
+            bool use_exceptions = true>
+  struct TinyBorderedBlockDiagonalMatrixSolve {
+    static_assert(Nb * Bs <= N, "invalid block structure");
+    static_assert(Bs != 0, "invalid block size");
+    //! \brief type of the permutation
+    using Permutation = std::array<unsigned short, N>;
+    //! \brief size of the border
+    static constexpr unsigned short Nc = N - Nb * Bs;
+    /*!
+     * \brief solve the linear system m.x = b
+     * \param[in,out] m: matrix, overwritten during computations
+     * \param[in,out] b: right hand side on input, solution on output
+     * \param[in] p: permutation
+     * \param[in] eps: numerical parameter to detect null pivot
+     */
+    TFEL_HOST_DEVICE static bool exe(
+        tmatrix<N, N, T>& m,
+        tvector<N, T>& b,
+        const Permutation& p,
+        const T eps = 100 *
+                      std::numeric_limits<T>::min()) noexcept(!use_exceptions) {
+      using LUSolve = TinyMatrixSolveBase<Bs, T, use_exceptions, false>;
+      constexpr auto nbu = static_cast<unsigned short>(Nb * Bs);
+      // Schur complement and its right hand side
+      constexpr auto nc = static_cast<unsigned short>((Nc == 0) ? 1 : Nc);
+      [[maybe_unused]] auto S = tmatrix<nc, nc, T>{};
+      [[maybe_unused]] auto g = tvector<nc, T>{};
+      if constexpr (Nc != 0) {
+        for (unsigned short i = 0; i != Nc; ++i) {
+          g(i) = b(p[nbu + i]);
+          for (unsigned short j = 0; j != Nc; ++j) {
+            S(i, j) = m(p[nbu + i], p[nbu + j]);
+          }
+        }
+      }
+      // elimination of the blocks
+      for (unsigned short ib = 0; ib != Nb; ++ib) {
+        const auto o = static_cast<unsigned short>(ib * Bs);
+        auto A = tmatrix<Bs, Bs, T>{};
+        auto y = tvector<Bs, T>{};
+        for (unsigned short i = 0; i != Bs; ++i) {
+          y(i) = b(p[o + i]);
+          for (unsigned short j = 0; j != Bs; ++j) {
+            A(i, j) = m(p[o + i], p[o + j]);
+          }
+        }
+        auto lu = TinyPermutation<Bs>{};
+        if (!LUSolve::decomp(A, lu, eps)) {
+          return false;
+        }
+        if (!LUSolve::back_substitute(A, lu, y, eps)) {
+          return false;
+        }
+        for (unsigned short i = 0; i != Bs; ++i) {
+          b(p[o + i]) = y(i);
+        }
+        if constexpr (Nc != 0) {
+          // X = A^{-1}.B is stored in place of B
+          auto X = tmatrix<Bs, Nc, T>{};
+          for (unsigned short i = 0; i != Bs; ++i) {
+            for (unsigned short j = 0; j != Nc; ++j) {
+              X(i, j) = m(p[o + i], p[nbu + j]);
+            }
+          }
+          if (!LUSolve::back_substitute(A, lu, X, eps)) {
+            return false;
+          }
+          for (unsigned short i = 0; i != Bs; ++i) {
+            for (unsigned short j = 0; j != Nc; ++j) {
+              m(p[o + i], p[nbu + j]) = X(i, j);
+            }
+          }
+          // update of the Schur complement and of its right hand side
+          for (unsigned short i = 0; i != Nc; ++i) {
+            const auto pi = p[nbu + i];
+            for (unsigned short k = 0; k != Bs; ++k) {
+              const auto c = m(pi, p[o + k]);
+              g(i) -= c * y(k);
+              for (unsigned short j = 0; j != Nc; ++j) {
+                S(i, j) -= c * X(k, j);
+              }
+            }
+          }
+        }
+      }
+      if constexpr (Nc != 0) {
+        // resolution of the border
+        if (!TinyMatrixSolve<Nc, T, use_exceptions>::exe(S, g, eps)) {
+          return false;
+        }
+        for (unsigned short i = 0; i != Nc; ++i) {
+          b(p[nbu + i]) = g(i);
+        }
+        // back-substitution in the blocks
+        for (unsigned short ib = 0; ib != Nb; ++ib) {
+          const auto o = static_cast<unsigned short>(ib * Bs);
+          for (unsigned short i = 0; i != Bs; ++i) {
+            const auto pi = p[o + i];
+            auto v = b(pi);
+            for (unsigned short j = 0; j != Nc; ++j) {
+              v -= m(pi, p[nbu + j]) * g(j);
+            }
+            b(pi) = v;
+          }
+        }
+      }
+      return true;
+    }  // end of exe
+  };   // end of struct TinyBorderedBlockDiagonalMatrixSolve
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_TINYBORDEREDBLOCKDIAGONALMATRIXSOLVE_HXX */
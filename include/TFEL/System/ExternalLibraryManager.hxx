@@ -15,6 +15,7 @@
 #define LIB_TFEL_SYSTEM_EXTERNALLIBRARYMANAGER_HXX
 
 #include <map>
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -400,6 +401,16 @@ namespace tfel::system {
      * If the symbol is not found, an empty string is returned.
      */
     std::string getTFELVersion(const std::string&, const std::string&);
+    /*!
+     * \return true if the given entry point is declared reentrant, i.e.
+     * if it can be called concurrently by several threads.
+     * \param[in] l: name of the library
+     * \param[in] f: name of function or mechanical behaviour
+     * This function looks for the symbol f+'_reentrant' in the
+     * library and expect it to be an unsigned short. If the symbol is
+     * not found, the entry point is assumed not to be reentrant.
+     */
+    bool isReentrant(const std::string&, const std::string&);
     /*!
      * \return the unit system used by the given entry point.
      * \param[in] l: name of the library
@@ -572,6 +583,41 @@ namespace tfel::system {
      */
     GenericBehaviourFctPtr getGenericBehaviourFunction(const std::string&,
                                                        const std::string&);
+    /*!
+     * \return true if the batched entry point of the given function,
+     * generated by the `generic` interface, is available.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     */
+    bool hasGenericBehaviourBatchFunction(const std::string&,
+                                         const std::string&);
+    /*!
+     * \return the batched entry point of the given function, generated
+     * by the `generic` interface.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     */
+    GenericBehaviourBatchFctPtr getGenericBehaviourBatchFunction(
+        const std::string&, const std::string&);
+    /*!
+     * \return true if the entry point of the given function taking the
+     * values of the parameters, generated by the `generic` interface, is
+     * available. This entry point is generated if the
+     * `caller_owned_parameters` DSL option is set.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     */
+    bool hasGenericBehaviourFunctionWithParameters(const std::string&,
+                                                   const std::string&);
+    /*!
+     * \return the entry point of the given function taking the values of
+     * the parameters, generated by the `generic` interface.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     */
+    GenericBehaviourWithParametersFctPtr
+    getGenericBehaviourFunctionWithParameters(const std::string&,
+                                              const std::string&);
     /*!
      * \return the post-processings associated with a behaviour generated
      * through the `generic` interface.
@@ -1461,12 +1507,70 @@ namespace tfel::system {
                                             const std::string&,
                                             const std::string&,
                                             const std::string&);
+    /*!
+     * \brief look for the values of a symbol in the metadata records
+     * exported by `MFront`.
+     *
+     * `MFront` exports, for each prefix of the symbols describing a
+     * behaviour, a string named `<prefix>_mfront_metadata` with the
+     * following format:
+     *
+     * - the first line contains the string `mfront_metadata` followed
+     *   by the version of the format (currently `1`).
+     * - each symbol is described by a line giving its name (without the
+     *   prefix) and its number of values, followed by one line per value.
+     *
+     * Those records are parsed once and cached, so that most of the
+     * information about a behaviour can be retrieved without calling
+     * `dlsym`. Records with an unknown version are ignored.
+     *
+     * \return a pointer to the values of the symbol, or `nullptr` if the
+     * symbol is not described by the metadata records. In this case, the
+     * symbol shall be retrieved directly from the library.
+     * \param[in] l: library
+     * \param[in] f: entry point
+     * \param[in] h: modelling hypothesis, may be empty
+     * \param[in] n: name of the symbol, without the entry point and the
+     * modelling hypothesis
+     */
+    TFEL_VISIBILITY_LOCAL const std::vector<std::string>* getMetaData(
+        const std::string&,
+        const std::string&,
+        const std::string&,
+        const std::string&);
+    /*!
+     * \return the value of an unsigned short symbol, or -1 if the symbol
+     * is not defined.
+     * \param[in] l: library
+     * \param[in] f: entry point
+     * \param[in] h: modelling hypothesis, may be empty
+     * \param[in] n: name of the symbol, without the entry point and the
+     * modelling hypothesis
+     * \note if the modelling hypothesis is not empty, the symbol
+     * associated with this hypothesis is first searched. If not found,
+     * the symbol associated with the entry point is searched.
+     */
+    TFEL_VISIBILITY_LOCAL int getUnsignedShort(const std::string&,
+                                               const std::string&,
+                                               const std::string&,
+                                               const std::string&);
 
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
     std::map<std::string, HINSTANCE__*> librairies;
 #else
     std::map<std::string, void*> librairies;
 #endif /* LIB_EXTERNALLIBRARYMANAGER_HXX */
+    /*!
+     * \brief metadata records, sorted by library and prefix. A record is
+     * empty if the associated symbol is not defined.
+     */
+    std::map<std::string,
+             std::map<std::string, std::map<std::string,
+                                            std::vector<std::string>,
+                                            std::less<>>>>
+        metadata;
+    //! \brief mutex protecting the metadata records
+    std::mutex metadata_mutex;
 
   };  // end of struct LibraryManager
 
@@ -0,0 +1,59 @@
+/*!
+ * \file   include/TFEL/System/ParallelizationSettings.hxx
+ * \brief  This file declares the `ParallelizationSettings` structure and
+ * the `getSharedThreadPool` function.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_SYSTEM_PARALLELIZATIONSETTINGS_HXX
+#define LIB_TFEL_SYSTEM_PARALLELIZATIONSETTINGS_HXX
+
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+
+namespace tfel::system {
+
+  /*!
+   * \brief settings used to parallelize loops over independent items,
+   * such as the integration points treated by a call to a behaviour
+   * from an explicit solver.
+   */
+  struct ParallelizationSettings {
+    //! \brief number of threads, including the calling thread
+    ThreadPool::size_type number_of_threads = 1;
+    //! \brief partitioning of the loops
+    ThreadPool::Partitioning partitioning = ThreadPool::Partitioning::STATIC;
+    //! \brief grain size, see `ThreadPool::parallel_for`
+    ThreadPool::size_type grain_size = 0;
+  };  // end of struct ParallelizationSettings
+
+  /*!
+   * \return the parallelization settings defined by the following
+   * environment variables, which are read at the first call:
+   *
+   * - `TFEL_NUMBER_OF_THREADS`: number of threads, including the
+   *   calling thread. If not defined, the `ABAQUSEXPLICIT_NTHREADS`
+   *   environment variable is used. By default, 4 threads are used.
+   * - `TFEL_PARTITIONING`: `static` (default), `dynamic` or `guided`.
+   * - `TFEL_GRAIN_SIZE`: grain size (null by default).
+   */
+  TFELSYSTEM_VISIBILITY_EXPORT const ParallelizationSettings&
+  getParallelizationSettings();
+  /*!
+   * \return a thread pool shared by all the callers of the process. The
+   * pool is created at the first call. Its number of workers is the
+   * number of threads given by the parallelization settings minus one,
+   * since the calling thread takes part in the `parallel_for` calls.
+   */
+  TFELSYSTEM_VISIBILITY_EXPORT ThreadPool& getSharedThreadPool();
+
+}  // end of namespace tfel::system
+
+#endif /* LIB_TFEL_SYSTEM_PARALLELIZATIONSETTINGS_HXX */
@@ -20,8 +20,9 @@
 #ifndef TFEL_SYSTEM_THREAD_POOL_HXX
 #define TFEL_SYSTEM_THREAD_POOL_HXX
 
-#include <queue>
 #include <mutex>
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <thread>
 #include <future>
@@ -34,10 +35,28 @@ namespace tfel::system {
 
   /*!
    * \brief structure handling a fixed-size pool of threads
+   *
+   * Each worker owns a queue of tasks. A worker treats the tasks of
+   * its own queue in last-in first-out order and, when its queue is
+   * empty, steals the oldest tasks of the other queues. Tasks added
+   * by a worker are pushed in its own queue, other tasks are
+   * distributed in a round-robin fashion.
    */
   struct TFELSYSTEM_VISIBILITY_EXPORT ThreadPool {
     //! a simple alias
     using size_type = std::vector<std::thread>::size_type;
+    //! \brief strategies used to split the range of a `parallel_for` call
+    enum struct Partitioning {
+      //! \brief the range is split in one contiguous chunk per thread
+      STATIC,
+      //! \brief chunks of fixed size are distributed on demand
+      DYNAMIC,
+      /*!
+       * \brief chunks whose size is proportional to the number of
+       * remaining indices are distributed on demand
+       */
+      GUIDED
+    };
     /*!
      * \brief constructor
      * \param[in] n: number of thread to be created
@@ -51,6 +70,53 @@ namespace tfel::system {
     template <typename F, typename... Args>
     std::future<ThreadedTaskResult<std::invoke_result_t<F, Args...>>> addTask(
         F&&, Args&&...);
+    /*!
+     * \brief call `f(i)` for each index `i` in the range `[b, e)`.
+     *
+     * The range is split in chunks of `g` indices which are treated by
+     * the workers and by the calling thread. The chunks are distributed
+     * dynamically, so that uneven costs are balanced. No memory is
+     * allocated per index nor per chunk. This method returns once all
+     * the indices have been treated. If a call to `f` throws, the
+     * remaining chunks are skipped and the first exception is
+     * rethrown.
+     *
+     * \param[in] b: first index
+     * \param[in] e: past-the-end index
+     * \param[in] g: grain size, i.e. the number of indices per chunk.
+     * If null, the grain size is chosen so that each thread treats
+     * about four chunks.
+     * \param[in] f: function
+     */
+    template <typename F>
+    void parallel_for(const size_type, const size_type, const size_type, F&&);
+    /*!
+     * \brief call `f(i)` for each index `i` in the range `[b, e)`,
+     * using the given partitioning of the range.
+     *
+     * The meaning of the grain size depends on the partitioning:
+     *
+     * - `STATIC`: minimal number of indices per chunk. The range is
+     *   split in contiguous chunks of equal sizes, one per thread
+     *   (including the calling thread).
+     * - `DYNAMIC`: number of indices per chunk, as in the previous
+     *   method.
+     * - `GUIDED`: minimal number of indices per chunk. The first chunks
+     *   are large and the last ones are small, which balances uneven
+     *   costs with few synchronisations.
+     *
+     * \param[in] p: partitioning
+     * \param[in] b: first index
+     * \param[in] e: past-the-end index
+     * \param[in] g: grain size
+     * \param[in] f: function
+     */
+    template <typename F>
+    void parallel_for(const Partitioning,
+                      const size_type,
+                      const size_type,
+                      const size_type,
+                      F&&);
     //! \return the number of threads managed by the ppol
     size_type getNumberOfThreads() const;
     //! \brief wait for all tasks to be finished
@@ -62,16 +128,63 @@ namespace tfel::system {
     //! wrapper around the given task
     template <typename F>
     struct Wrapper;
-    //! enum describing the status of workers
-    enum Status { WORKING, IDLE };  // end of enum Status
-    std::vector<Status> statuses;
+    //! \brief queue of tasks owned by a worker
+    struct WorkQueue;
+    //! \brief state shared by the threads treating a `parallel_for` call
+    struct ParallelForState;
+    /*!
+     * \brief add a task to the queue of the calling worker, or to the
+     * queue of a worker chosen in a round-robin fashion if the calling
+     * thread does not belong to the pool.
+     * \param[in] t: task
+     */
+    void push(std::function<void()>);
+    /*!
+     * \brief retrieve a task, first from the given queue (newest task),
+     * then from the other queues (oldest tasks).
+     * \return true if a task was retrieved
+     * \param[out] t: task
+     * \param[in] i: index of the first queue to be searched
+     */
+    bool pop(std::function<void()>&, const size_type);
+    /*!
+     * \brief execute a pending task, if any.
+     * \return true if a task was executed
+     */
+    bool executePendingTask();
+    //! \brief to be called once a task is finished
+    void finish();
+    /*!
+     * \brief implementation of the `parallel_for` methods
+     * \param[in] p: partitioning
+     * \param[in] b: first index
+     * \param[in] e: past-the-end index
+     * \param[in] g: grain size
+     * \param[in] f: function treating a chunk `[ib, ie)`
+     */
+    void parallelFor(const Partitioning,
+                     const size_type,
+                     const size_type,
+                     const size_type,
+                     const std::function<void(size_type, size_type)>&);
+    //! \brief queues of tasks, one per worker
+    std::vector<std::unique_ptr<WorkQueue>> queues;
     //! list of available threads
     std::vector<std::thread> workers;
-    // the task queue
-    std::queue<std::function<void()>> tasks;
+    //! \brief number of tasks stored in the queues
+    std::atomic<size_type> queued{0};
+    //! \brief number of tasks added and not finished
+    std::atomic<size_type> active{0};
+    //! \brief number of sleeping workers
+    std::atomic<size_type> sleeping{0};
+    //! \brief counter used to distribute the tasks added from outside
+    std::atomic<size_type> next_queue{0};
     // synchronization
     std::mutex m;
+    //! \brief condition used to wake up sleeping workers
     std::condition_variable c;
+    //! \brief condition used by the `wait` method
+    std::condition_variable finished;
     bool stop = false;
   };
 
@@ -67,20 +67,32 @@ namespace tfel::system {
     auto t = std::make_shared<task>(
         std::bind(Wrapper<F>(std::forward<F>(f)), std::forward<Args>(a)...));
     auto res = t->get_future();
-    {
-      std::unique_lock<std::mutex> lock(this->m);
-      // don't allow enqueueing after stopping the pool
-      if (this->stop) {
-        throw std::runtime_error(
-            "ThreadPool::addTask: "
-            "enqueue on stopped ThreadPool");
-      }
-      this->tasks.emplace([t] { (*t)(); });
-    }
-    this->c.notify_one();
+    this->push([t] { (*t)(); });
     return res;
   }
 
+  template <typename F>
+  void ThreadPool::parallel_for(const size_type b,
+                                const size_type e,
+                                const size_type g,
+                                F&& f) {
+    this->parallel_for(Partitioning::DYNAMIC, b, e, g, std::forward<F>(f));
+  }  // end of parallel_for
+
+  template <typename F>
+  void ThreadPool::parallel_for(const Partitioning p,
+                                const size_type b,
+                                const size_type e,
+                                const size_type g,
+                                F&& f) {
+    this->parallelFor(p, b, e, g,
+                      [&f](const size_type ib, const size_type ie) {
+                        for (auto i = ib; i != ie; ++i) {
+                          f(i);
+                        }
+                      });
+  }  // end of parallel_for
+
 }  // end of namespace tfel::system
 
 #endif /* TFEL_SYSTEM_THREAD_POOL_IXX */
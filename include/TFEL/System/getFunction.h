@@ -110,6 +110,28 @@ double(TFEL_ADDCALL_PTR tfel_getGenericMaterialProperty(
 int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourFunction(LibraryHandlerPtr,
                                                       const char* const))(
     struct mfront_gb_BehaviourData* const);
+/*!
+ * \brief return the batched entry point of a behaviour generated by the
+ * generic behaviour interface
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourBatchFunction(
+    LibraryHandlerPtr,
+    const char* const))(struct mfront_gb_BatchBehaviourData* const);
+/*!
+ * \brief return the entry point of a behaviour generated by the generic
+ * behaviour interface taking the values of the parameters
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourFunctionWithParameters(
+    LibraryHandlerPtr, const char* const))(
+    struct mfront_gb_BehaviourData* const, const mfront_gb_real* const);
 /*!
  * \brief return a function generated by the generic behaviour interface
  * associated with an initialize functions.
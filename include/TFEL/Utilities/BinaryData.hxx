@@ -0,0 +1,128 @@
+/*!
+ * \file   include/TFEL/Utilities/BinaryData.hxx
+ * \brief  This file declares the `BinaryData` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_BINARYDATA_HXX
+#define LIB_TFEL_UTILITIES_BINARYDATA_HXX
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::utilities {
+
+  // forward declaration
+  struct MappedFile;
+
+  /*!
+   * \brief class in charge of reading columns of floating point numbers
+   * stored in a binary file following the `npy` format of `numpy`.
+   *
+   * The following arrays of double precision numbers are supported:
+   *
+   * - one dimensional arrays of records having only double precision
+   *   fields, as written by the `BinaryDataWriter` class. Each field
+   *   defines a column, named after the field.
+   * - one dimensional arrays, treated as a single column, and two
+   *   dimensional arrays, each row defining a line. The columns are not
+   *   named.
+   *
+   * The file is memory-mapped when the platform allows it and the
+   * values are only read when a column is requested.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT BinaryData {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    /*!
+     * \return if the given file starts as a file following the `npy`
+     * format
+     * \param[in] f: file name
+     */
+    static bool isBinaryDataFile(const std::string&);
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     * \param[in] b: use memory mapping to read the file, if available
+     * \throw std::runtime_error if the file can't be opened or if its
+     * content is not supported
+     */
+    BinaryData(const std::string&, const bool = true);
+    //! \brief move constructor
+    BinaryData(BinaryData&&);
+    //! \brief move assignement
+    BinaryData& operator=(BinaryData&&);
+    //! \return the number of columns
+    size_type getNumberOfColumns() const noexcept;
+    //! \return the number of lines
+    size_type getNumberOfLines() const noexcept;
+    /*!
+     * \return the specified column
+     * \param[in] i: column number (starting from 1)
+     * \throw std::runtime_error if the column number is invalid
+     */
+    std::vector<double> getColumn(const size_type) const;
+    /*!
+     * \brief extract the specified column
+     * \param[out] tab: column values
+     * \param[in]  i: column number (starting from 1)
+     * \throw std::runtime_error if the column number is invalid
+     */
+    void getColumn(std::vector<double>&, const size_type) const;
+    /*!
+     * \return the column having the specified name
+     * \param[in] name: column name
+     * \throw std::runtime_error if no column with the specified name
+     * is found
+     */
+    size_type findColumn(const std::string&) const;
+    //! \return the names of the columns
+    const std::vector<std::string>& getLegends() const noexcept;
+    /*!
+     * \return the name of the specified column
+     * \param[in] c: column number (starting from 1)
+     */
+    std::string getLegend(const size_type c) const;
+    /*!
+     * \brief skip the first lines
+     * \param[in] n: number of lines to be skipped
+     */
+    void skipLines(const size_type);
+    //! \brief destructor
+    ~BinaryData();
+
+   private:
+    BinaryData() = delete;
+    BinaryData(const BinaryData&) = delete;
+    BinaryData& operator=(const BinaryData&) = delete;
+    //! \brief content of the file
+    std::unique_ptr<MappedFile> content;
+    //! \brief names of the columns
+    std::vector<std::string> legends;
+    //! \brief position of the first value
+    size_type offset = 0;
+    //! \brief number of lines stored in the file
+    size_type nlines = 0;
+    //! \brief number of lines skipped
+    size_type first_line = 0;
+    //! \brief number of columns
+    size_type ncolumns = 0;
+    //! \brief values are stored column by column
+    bool fortran_order = false;
+    //! \brief values are not stored in the native byte order
+    bool swap_bytes = false;
+  };  // end of struct BinaryData
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_BINARYDATA_HXX */
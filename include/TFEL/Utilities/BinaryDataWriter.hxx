@@ -0,0 +1,93 @@
+/*!
+ * \file   include/TFEL/Utilities/BinaryDataWriter.hxx
+ * \brief  This file declares the `BinaryDataWriter` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_BINARYDATAWRITER_HXX
+#define LIB_TFEL_UTILITIES_BINARYDATAWRITER_HXX
+
+#include <span>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <fstream>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief class in charge of writing a set of named columns of floating
+   * point numbers, line by line, in a binary file.
+   *
+   * The file follows the `npy` format of `numpy`: a text header
+   * describing a one dimensional array of records, each record having
+   * one double precision field per column, is followed by the raw
+   * values, stored line by line in the native byte order. Such a file
+   * can be read by the `BinaryData` class, by the `TextData` class, or
+   * directly by `numpy.load` (possibly with memory mapping).
+   *
+   * The number of lines stored in the header is updated when the
+   * `flush` method is called and when the writer is destroyed. Enough
+   * space is reserved in the header so that lines can be appended
+   * without moving the values already written.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT BinaryDataWriter {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     * \param[in] c: names of the columns
+     * \throw std::runtime_error if the file can't be opened or if the
+     * names of the columns are empty or not unique
+     */
+    BinaryDataWriter(const std::string&, const std::vector<std::string>&);
+    //! \return the number of columns
+    size_type getNumberOfColumns() const noexcept;
+    //! \return the number of lines written
+    size_type getNumberOfLines() const noexcept;
+    /*!
+     * \brief append a line
+     * \param[in] v: values
+     * \throw std::runtime_error if the number of values is not equal to
+     * the number of columns
+     */
+    void write(std::span<const double>);
+    //! \brief update the header and flush the file
+    void flush();
+    //! \brief destructor
+    ~BinaryDataWriter();
+
+   private:
+    BinaryDataWriter() = delete;
+    BinaryDataWriter(BinaryDataWriter&&) = delete;
+    BinaryDataWriter(const BinaryDataWriter&) = delete;
+    BinaryDataWriter& operator=(BinaryDataWriter&&) = delete;
+    BinaryDataWriter& operator=(const BinaryDataWriter&) = delete;
+    //! \brief write the header at the beginning of the file
+    void writeHeader();
+    //! \brief file name
+    std::string file;
+    //! \brief names of the columns
+    std::vector<std::string> columns;
+    //! \brief output stream
+    std::ofstream out;
+    //! \brief number of lines written
+    size_type nlines = 0;
+    //! \brief size of the header
+    size_type header_size = 0;
+    //! \brief version of the `npy` format
+    unsigned char version = 1;
+  };  // end of struct BinaryDataWriter
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_BINARYDATAWRITER_HXX */
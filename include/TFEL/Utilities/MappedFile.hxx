@@ -0,0 +1,59 @@
+/*!
+ * \file   include/TFEL/Utilities/MappedFile.hxx
+ * \brief  This file declares the `MappedFile` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_MAPPEDFILE_HXX
+#define LIB_TFEL_UTILITIES_MAPPEDFILE_HXX
+
+#include <string>
+#include <cstddef>
+#include <string_view>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief a class giving a read-only access to the content of a file,
+   * either by memory-mapping it, when the platform allows it, or by
+   * reading it in a buffer.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT MappedFile {
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     * \param[in] b: use memory mapping, if available
+     * \throw std::runtime_error if the file can't be opened
+     */
+    MappedFile(const std::string&, const bool = true);
+    //! \return a view of the content of the file
+    std::string_view view() const noexcept;
+    //! \return if the file has been memory-mapped
+    bool isMemoryMapped() const noexcept;
+    //! \brief destructor
+    ~MappedFile();
+
+   private:
+    MappedFile(MappedFile&&) = delete;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    //! \brief buffer used when the file is not memory-mapped
+    std::string buffer;
+    //! \brief memory-mapped file
+    void* mapping = nullptr;
+    //! \brief size of the memory-mapped file
+    std::size_t mapping_size = 0;
+  };  // end of struct MappedFile
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_MAPPEDFILE_HXX */
@@ -0,0 +1,129 @@
+/*!
+ * \file   include/TFEL/Utilities/NumericTextData.hxx
+ * \brief  This file declares the `NumericTextData` class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_NUMERICTEXTDATA_HXX
+#define LIB_TFEL_UTILITIES_NUMERICTEXTDATA_HXX
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief class in charge of reading a text file containing only
+   * numeric values organised in columns.
+   *
+   * The values are parsed using `std::from_chars` and are stored
+   * column by column in contiguous arrays. The file is memory-mapped
+   * when the platform allows it.
+   *
+   * The treatment of comments, legends and preamble is the same than
+   * the one of the `TextData` class. Contrary to the `TextData` class,
+   * an exception is thrown at construction if a value can't be
+   * interpreted as a floating point number or if all lines do not
+   * have the same number of values.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT NumericTextData {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief options passed to the constructor
+    struct Options {
+      //! \brief file format (see the `TextData` class)
+      std::string format;
+      //! \brief use memory mapping to read the file, if available
+      bool use_memory_mapping = true;
+    };  // end of struct Options
+    /*!
+     * \brief constructor
+     * \param[in] file: file name
+     * \param[in] format: file format (see the `TextData` class)
+     * \throw std::runtime_error if the file can't be opened or if its
+     * content can't be interpreted as a set of columns of floating
+     * point numbers
+     */
+    NumericTextData(const std::string&, const std::string& = "");
+    /*!
+     * \brief constructor
+     * \param[in] file: file name
+     * \param[in] opts: options
+     */
+    NumericTextData(const std::string&, const Options&);
+    //! \brief move constructor
+    NumericTextData(NumericTextData&&);
+    //! \brief move assignement
+    NumericTextData& operator=(NumericTextData&&);
+    //! \return the number of columns
+    size_type getNumberOfColumns() const noexcept;
+    //! \return the number of lines containing data
+    size_type getNumberOfLines() const noexcept;
+    /*!
+     * \return the specified column
+     * \param[in] i: column number (starting from 1)
+     * \throw std::runtime_error if the column number is invalid
+     */
+    const std::vector<double>& getColumn(const size_type) const;
+    /*!
+     * \brief extract the specified column
+     * \param[out] tab: column values
+     * \param[in]  i: column number (starting from 1)
+     * \throw std::runtime_error if the column number is invalid
+     */
+    void getColumn(std::vector<double>&, const size_type) const;
+    /*!
+     * \return the line numbers of the lines containing data. As in the
+     * `TextData` class, empty lines are not taken into account.
+     */
+    const std::vector<size_type>& getLineNumbers() const noexcept;
+    /*!
+     * \return the column having the specified title
+     * \param[in] name: column title
+     * \throw std::runtime_error if no column with the specified
+     * title is found
+     */
+    size_type findColumn(const std::string&) const;
+    //! \return the legend associated to the curves
+    const std::vector<std::string>& getLegends() const noexcept;
+    /*!
+     * \return the title of the specified column
+     * \param[in] c: column number (starting from 1)
+     */
+    std::string getLegend(const size_type c) const;
+    //! \return the first commented lines
+    const std::vector<std::string>& getPreamble() const noexcept;
+    /*!
+     * \brief skip the first lines of the file
+     * \param[in] n: number of lines to be skipped
+     */
+    void skipLines(const size_type);
+    //! \brief destructor
+    ~NumericTextData();
+
+   private:
+    NumericTextData() = delete;
+    NumericTextData(const NumericTextData&) = delete;
+    NumericTextData& operator=(const NumericTextData&) = delete;
+    //! \brief values, stored by columns
+    std::vector<std::vector<double>> columns;
+    //! \brief line numbers
+    std::vector<size_type> lines;
+    //! \brief list of column titles
+    std::vector<std::string> legends;
+    //! \brief first commented lines
+    std::vector<std::string> preamble;
+  };  // end of struct NumericTextData
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_NUMERICTEXTDATA_HXX */
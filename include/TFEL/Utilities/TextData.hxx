@@ -14,16 +14,31 @@
 #ifndef LIB_TFEL_UTILITIES_TEXTDATA_HXX
 #define LIB_TFEL_UTILITIES_TEXTDATA_HXX
 
+#include <mutex>
 #include <vector>
 #include <string>
+#include <memory>
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Utilities/Token.hxx"
+#include "TFEL/Utilities/NumericTextData.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
 
 namespace tfel::utilities {
 
   /*!
    * \brief class in charge of reading data in a text file
+   *
+   * If the file only contains numeric values, the file is read using
+   * the `NumericTextData` class, which stores the values by columns.
+   * Otherwise, each line is splitted in tokens. In the first case, the
+   * tokens are only computed if the lines are accessed through the
+   * `begin` and `end` methods. Those methods can be called concurrently
+   * by several threads.
+   *
+   * Binary files following the `npy` format, as written by the
+   * `BinaryDataWriter` class, are read using the `BinaryData` class.
+   * The names of the columns are then used as legends.
    */
   struct TFELUTILITIES_VISIBILITY_EXPORT TextData {
     //! a simple alias
@@ -53,6 +68,8 @@ namespace tfel::utilities {
      *   set key autotitle columnhead
      */
     TextData(const std::string&, const std::string& = "");
+    //! \brief destructor
+    ~TextData();
     /*!
      * \param[in] i : column number
      * \return the specified column, converting all values to double
@@ -105,6 +122,16 @@ namespace tfel::utilities {
      * \param[in] n : number of lines to be skipped
      */
     void skipLines(const Token::size_type);
+    /*!
+     * \return the values read by the `NumericTextData` class, if the
+     * file only contains numeric values, a null pointer otherwise.
+     */
+    const NumericTextData* getNumericTextData() const noexcept;
+    /*!
+     * \return the values read by the `BinaryData` class, if the file is
+     * a binary file, a null pointer otherwise.
+     */
+    const BinaryData* getBinaryData() const noexcept;
 
    private:
     TextData() = delete;
@@ -112,8 +139,20 @@ namespace tfel::utilities {
     TextData(const TextData&) = delete;
     TextData& operator=(TextData&&) = delete;
     TextData& operator=(const TextData&) = delete;
+    //! \brief file name
+    std::string file;
+    //! \brief file format
+    std::string format;
+    //! \brief values, if the file only contains numeric values
+    std::unique_ptr<NumericTextData> numeric_data;
+    //! \brief values, if the file is a binary file
+    std::unique_ptr<BinaryData> binary_data;
     //! list of all tokens of the file, sorted by line
-    std::vector<Line> lines;
+    mutable std::vector<Line> lines;
+    //! \brief boolean stating if the `lines` member has been built
+    mutable bool tokenized = false;
+    //! \brief mutex protecting the lazy construction of the `lines` member
+    mutable std::mutex m;
     //! list of column titles
     std::vector<std::string> legends;
     //! first commented lines
@@ -143,6 +143,17 @@ namespace mfront {
     static const char* const compareToNumericalJacobian;
     //! list of jacobian blocks that must be computed numerically
     static const char* const numericallyComputedJacobianBlocks;
+    /*!
+     * \brief list of integration variables whose jacobian is block
+     * diagonal with respect to their array index
+     */
+    static const char* const blockDiagonalJacobianVariables;
+    /*!
+     * \brief finite difference scheme used to compute a numerical
+     * approximation of the jacobian or of some of its blocks. Supported
+     * values are `Centered` (default) and `Forward`.
+     */
+    static const char* const numericalJacobianFiniteDifferenceScheme;
     /*!
      * a boolean attribute telling if the additionnal variables can be
      * declared. This attribute is set by DSL's when the first code
@@ -66,6 +66,10 @@ namespace mfront {
     static const char* const modellingHypothesis;
     //! \brief standard option
     static const char* const modellingHypotheses;
+    //! \brief standard option and attribute name
+    static const char* const callerOwnedParameters;
+    //! \brief standard option and attribute name
+    static const char* const reentrant;
     //! \brief a simple alias
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
     //! \brief a simple alias
@@ -1972,6 +1976,26 @@ namespace mfront {
    */
   MFRONT_VISIBILITY_EXPORT std::string getParametersFileName(
       const BehaviourDescription&, const BehaviourDescription::Hypothesis);
+  /*!
+   * \brief this function returns the value of the
+   * `BehaviourDescription::callerOwnedParameters` attribute if it is
+   * defined, `false` otherwise.
+   * \return if the values of the parameters may be given by the caller
+   * in a parameters block.
+   * \param[in] bd: behaviour description
+   */
+  MFRONT_VISIBILITY_EXPORT bool areParametersOwnedByTheCaller(
+      const BehaviourDescription&);
+  /*!
+   * \brief this function returns the value of the
+   * `BehaviourDescription::reentrant` attribute if it is defined, `true`
+   * otherwise.
+   * \return if the behaviour can be called concurrently by several
+   * threads.
+   * \param[in] bd: behaviour description
+   */
+  MFRONT_VISIBILITY_EXPORT bool isBehaviourReentrant(
+      const BehaviourDescription&);
 
   /*!
    * \brief set the elastic symmetry of a material if not already
@@ -0,0 +1,82 @@
+/*!
+ * \file   mfront/include/MFront/BehaviourPrecompiledHeader.hxx
+ * \brief  This file gathers the headers included by most sources
+ * generated for behaviours. It is meant to be precompiled by the
+ * build files generated by `mfront` when the `--precompiled-headers`
+ * option is used.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_BEHAVIOURPRECOMPILEDHEADER_HXX
+#define LIB_MFRONT_BEHAVIOURPRECOMPILEDHEADER_HXX
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+#include "TFEL/Raise.hxx"
+#include "TFEL/PhysicalConstants.hxx"
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Config/TFELTypes.hxx"
+#include "TFEL/TypeTraits/IsReal.hxx"
+#include "TFEL/TypeTraits/IsFundamentalNumericType.hxx"
+#include "TFEL/Math/General/IEEE754.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/tensor.hxx"
+#include "TFEL/Math/t2tost2.hxx"
+#include "TFEL/Math/t2tot2.hxx"
+#include "TFEL/Math/TinyMatrixSolve.hxx"
+#include "TFEL/Math/TinyNewtonRaphsonSolver.hxx"
+#include "TFEL/Material/MaterialException.hxx"
+#include "TFEL/Material/ModellingHypothesis.hxx"
+#include "TFEL/Material/MechanicalBehaviour.hxx"
+#include "TFEL/Material/MechanicalBehaviourTraits.hxx"
+#include "TFEL/Material/OutOfBoundsPolicy.hxx"
+#include "TFEL/Material/BoundsCheck.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Material/StiffnessTensor.hxx"
+#include "TFEL/Material/IsotropicPlasticity.hxx"
+#include "TFEL/Material/FiniteStrainBehaviourTangentOperator.hxx"
+#include "MFront/GenericBehaviour/GenericBehaviourTraits.hxx"
+#include "MFront/GenericBehaviour/Integrate.hxx"
+#include "MFront/GenericBehaviour/BatchIntegrate.hxx"
+
+namespace mfront::internals {
+
+  /*!
+   * \brief instantiate the definitions of the classes used by most
+   * behaviours, so that they are stored in the precompiled header.
+   * \tparam N: space dimension
+   */
+  template <unsigned short N>
+  struct BehaviourPrecompiledHeaderInstantiations {
+    static_assert(sizeof(tfel::math::stensor<N, double>) != 0);
+    static_assert(sizeof(tfel::math::st2tost2<N, double>) != 0);
+    static_assert(sizeof(tfel::math::tensor<N, double>) != 0);
+    static_assert(sizeof(tfel::math::t2tost2<N, double>) != 0);
+    static_assert(sizeof(tfel::math::t2tot2<N, double>) != 0);
+  };
+
+  static_assert(sizeof(BehaviourPrecompiledHeaderInstantiations<1u>) != 0);
+  static_assert(sizeof(BehaviourPrecompiledHeaderInstantiations<2u>) != 0);
+  static_assert(sizeof(BehaviourPrecompiledHeaderInstantiations<3u>) != 0);
+
+}  // end of namespace mfront::internals
+
+#endif /* LIB_MFRONT_BEHAVIOURPRECOMPILEDHEADER_HXX */
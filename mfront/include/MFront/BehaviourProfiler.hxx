@@ -25,18 +25,70 @@
 #include "MFront/MFrontConfig.hxx"
 
 #include <array>
-#include <atomic>
+#include <mutex>
+#include <limits>
+#include <memory>
 #include <string>
+#include <vector>
+#include <cstdint>
 
 namespace mfront {
 
   /*!
    * structure in charge of performance measurements in mechanical
    * behaviour
+   *
+   * Each thread reports its measures in its own accumulators, so that
+   * threads integrating the same behaviour do not interfere. Those
+   * accumulators are merged when the profiler is destroyed, i.e. at
+   * the end of the program, and the results are printed on the
+   * standard output.
+   *
+   * If the `MFRONT_PROFILING_OUTPUT_FORMAT` environment variable is
+   * defined, the results are also written in files named after the
+   * behaviour. This variable is a comma-separated list of formats,
+   * the supported formats being `json` and `csv`.
    */
   struct MFRONTPROFILING_VISIBILITY_EXPORT BehaviourProfiler {
     //! a simple alias
     using index_type = unsigned short;
+    //! \brief number of code blocks
+    static constexpr std::size_t number_of_code_blocks = 23;
+    /*!
+     * \brief measures associated with a code block
+     *
+     * The durations are sorted in a log-scale histogram: the `i`-th
+     * bin counts the calls whose duration `d` (in nanoseconds)
+     * satisfies \(2^{i-1} \leq d < 2^{i}\), the first bin counting
+     * the calls whose duration is null.
+     */
+    struct MFRONTPROFILING_VISIBILITY_EXPORT CodeBlockMeasures {
+      /*!
+       * \brief add a new measure
+       * \param[in] d: duration in nanoseconds
+       */
+      void add(const std::intmax_t) noexcept;
+      /*!
+       * \brief merge the given measures
+       * \param[in] src: measures
+       */
+      void merge(const CodeBlockMeasures&) noexcept;
+      //! \brief time spent in the code block (nanoseconds)
+      std::intmax_t total = 0;
+      //! \brief number of calls
+      std::intmax_t calls = 0;
+      //! \brief minimal duration of a call
+      std::intmax_t min = std::numeric_limits<std::intmax_t>::max();
+      //! \brief maximal duration of a call
+      std::intmax_t max = 0;
+      //! \brief log-scale histogram of the durations
+      std::array<std::intmax_t, 64> histogram = {};
+    };  // end of struct CodeBlockMeasures
+    //! \brief measures performed by a thread
+    struct alignas(64) ThreadMeasures {
+      //! \brief measures of each code block
+      std::array<CodeBlockMeasures, number_of_code_blocks> measures;
+    };  // end of struct ThreadMeasures
     /*!
      * a timer for a specicied code block.
      * This descructor will increase the time count for the code block.
@@ -137,14 +189,27 @@ namespace mfront {
         APOSTERIORITIMESTEPSCALINGFACTOR = 21;
     //! code block index in the measures array
     static MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER index_type TOTALTIME = 22;
+    /*!
+     * \return the measures of each code block, merged over all the
+     * threads.
+     * \note this method must not be called while measures are
+     * performed.
+     */
+    std::array<CodeBlockMeasures, number_of_code_blocks> getMeasures() const;
     //! destructor
     ~BehaviourProfiler();
 
    protected:
+    //! \return the measures associated with the calling thread
+    ThreadMeasures& getThreadMeasures();
     //! name of the behaviour
     const std::string name;
-    //! time spend in each code block (nanoseconds)
-    std::array<std::atomic<intmax_t>, 23> measures;
+    //! \brief identifier of the profiler, unique in the process
+    const std::size_t identifier;
+    //! \brief mutex used to register new threads
+    mutable std::mutex m;
+    //! \brief measures performed by each thread
+    std::vector<std::unique_ptr<ThreadMeasures>> thread_measures;
   };  // end of BehaviourProfiler
 
 }  // end of namespace mfront
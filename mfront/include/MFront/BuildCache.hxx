@@ -0,0 +1,83 @@
+/*!
+ * \file   mfront/include/MFront/BuildCache.hxx
+ * \brief  This file declares the functions used to avoid treating again
+ * input files whose content, dependencies and options did not change.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_BUILDCACHE_HXX
+#define LIB_MFRONT_BUILDCACHE_HXX
+
+#include <string>
+#include <vector>
+#include <optional>
+#include "MFront/MFrontConfig.hxx"
+#include "MFront/TargetsDescription.hxx"
+
+namespace mfront {
+
+  /*!
+   * \brief a data structure describing the treatment of an input file
+   * by a previous session of `MFront`.
+   */
+  struct BuildCacheEntry {
+    //! \brief hash of the dependencies and of the options
+    std::string key;
+    //! \brief files read while treating the input file
+    std::vector<std::string> dependencies;
+    //! \brief targets associated with the input file
+    TargetsDescription targets;
+  };  // end of struct BuildCacheEntry
+
+  /*!
+   * \brief register a file read while treating the current input file.
+   * \param[in] f: file path
+   */
+  MFRONT_VISIBILITY_EXPORT void addBuildCacheDependency(const std::string&);
+  /*!
+   * \return all the files registered by `addBuildCacheDependency` since
+   * the beginning of the session, in registration order.
+   */
+  MFRONT_VISIBILITY_EXPORT const std::vector<std::string>&
+  getBuildCacheDependencies();
+  /*!
+   * \return the key associated with the given dependencies and options,
+   * or an empty string if one of the dependencies can't be read.
+   * \param[in] deps: dependencies
+   * \param[in] opts: a string describing the options affecting the
+   * generated sources and their compilation
+   */
+  MFRONT_VISIBILITY_EXPORT std::string computeBuildCacheKey(
+      const std::vector<std::string>&, const std::string&);
+  /*!
+   * \return the entry associated with the given input file, if any.
+   * \param[in] f: input file
+   */
+  MFRONT_VISIBILITY_EXPORT std::optional<BuildCacheEntry> getBuildCacheEntry(
+      const std::string&);
+  /*!
+   * \brief save the entry associated with the given input file.
+   * \param[in] f: input file
+   * \param[in] e: entry
+   */
+  MFRONT_VISIBILITY_EXPORT void writeBuildCacheEntry(const std::string&,
+                                                     const BuildCacheEntry&);
+  /*!
+   * \return true if the sources of the libraries and the headers
+   * described by the given targets are present in the `src` and the
+   * `include` directories.
+   * \param[in] t: targets
+   */
+  MFRONT_VISIBILITY_EXPORT bool areGeneratedFilesAvailable(
+      const TargetsDescription&);
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_BUILDCACHE_HXX */
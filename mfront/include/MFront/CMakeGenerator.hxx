@@ -41,10 +41,12 @@ namespace mfront {
    * directory using the specified file.
    * \param[in] t : target name
    * \param[in] d : directory
-   * \param[in] f : file name
+   * \param[in] j : number of jobs. If null, the default parallelism
+   * of the build tool is used.
    */
   MFRONT_VISIBILITY_EXPORT void callCMake(const std::string&,
-                                          const std::string& = "src");
+                                          const std::string& = "src",
+                                          const unsigned short = 0);
 
 }  // end of namespace mfront
 
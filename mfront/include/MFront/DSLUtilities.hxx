@@ -345,6 +345,15 @@ namespace mfront {
       std::ostream&,
       const std::string_view,
       const MaterialPropertyDescription&);
+  /*!
+   * \return the type identifiers of a set of parameters, as exported by
+   * the `writeParametersDeclarationSymbols` function: `0` for floating
+   * point values, `1` for integers and `2` for unsigned short integers.
+   * Arrays of parameters are expanded.
+   * \param[in] parameters: list of parameters
+   */
+  MFRONT_VISIBILITY_EXPORT std::vector<int> getParametersTypes(
+      const VariableDescriptionContainer&);
   /*!
    * \brief export parameters declarations
    * \param[out] os: output stream
@@ -80,6 +80,11 @@ namespace mfront {
     OptimisationLevel olevel = LEVEL1;
     //! \brief add debugging flags
     bool debugFlags = false;
+    /*!
+     * \brief precompile the headers commonly included by the generated
+     * `C++` sources (see `MFront/BehaviourPrecompiledHeader.hxx`)
+     */
+    bool precompiledHeaders = false;
     /*!
      * \brief boolean stating that no output regarding the compilation
      * commands shall be displayed.
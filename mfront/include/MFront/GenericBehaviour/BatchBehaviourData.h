@@ -0,0 +1,130 @@
+/*!
+ * \file   include/MFront/GenericBehaviour/BatchBehaviourData.h
+ * \brief  This file declares the data structure passed to the batched
+ * entry point of behaviours generated by the `generic` interface.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H
+#define LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H
+
+#include "MFront/GenericBehaviour/Types.h"
+#include "MFront/GenericBehaviour/State.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * \brief size, for one integration point, of the arrays passed to the
+ * batched entry point.
+ */
+typedef struct {
+  //! \brief size of the gradients
+  mfront_gb_size_type gradients;
+  //! \brief size of the thermodynamic forces
+  mfront_gb_size_type thermodynamic_forces;
+  //! \brief size of the material properties
+  mfront_gb_size_type material_properties;
+  //! \brief size of the internal state variables
+  mfront_gb_size_type internal_state_variables;
+  //! \brief size of the external state variables
+  mfront_gb_size_type external_state_variables;
+  //! \brief size of the tangent operator
+  mfront_gb_size_type tangent_operator;
+} mfront_gb_BatchSizes;
+
+/*!
+ * \brief structure passed to the batched behaviour integration.
+ *
+ * The values associated with `n` integration points are stored as
+ * structures of arrays: the `i`-th component of a variable for the
+ * `p`-th integration point is stored at index `i * n + p`. This layout
+ * applies to all the arrays of the initial and final states and to the
+ * tangent operators.
+ *
+ * The volumetric mass densities, the stored and dissipated energies
+ * and the speeds of sound are stored as arrays of `n` values, if they
+ * are not null.
+ */
+#ifndef MFRONT_GB_BATCHBEHAVIOURDATA_FORWARD_DECLARATION
+typedef struct mfront_gb_BatchBehaviourData mfront_gb_BatchBehaviourData;
+#endif
+
+/*!
+ * \brief structure passed to the batched behaviour integration.
+ */
+struct mfront_gb_BatchBehaviourData {
+  /*!
+   * \brief pointer to a buffer used to store error message
+   *
+   * \note This pointer can be nullptr. If not null, the pointer must
+   * point to a buffer which is at least 512 characters wide. Only the
+   * error message associated with the first integration point that
+   * failed is reported.
+   */
+  char* error_message;
+  //! \brief time increment
+  mfront_gb_real dt;
+  //! \brief number of integration points
+  mfront_gb_size_type n;
+  //! \brief sizes of the variables for one integration point
+  mfront_gb_BatchSizes sizes;
+  /*!
+   * \brief type of computation to be performed and behaviour's options.
+   *
+   * Those values are shared by all integration points and have the
+   * same meaning than the first values of the `K` member of the
+   * `mfront_gb_BehaviourData` structure. This array must contain at
+   * least three values.
+   */
+  const mfront_gb_real* options;
+  /*!
+   * \brief the tangent operators. This array must contain
+   * `sizes.tangent_operator * n` values. This pointer may be null if
+   * no tangent operator is requested.
+   */
+  mfront_gb_real* K;
+  /*!
+   * \brief proposed time step increment increase factors (one per
+   * integration point). On input, those values must be initialized to
+   * one.
+   */
+  mfront_gb_real* rdt;
+  /*!
+   * \brief status of the integration (one per integration point). The
+   * values have the same meaning than the value returned by the
+   * non-batched entry point.
+   */
+  int* status;
+  //! \brief speed of sound (only computed if requested)
+  mfront_gb_real* speed_of_sound;
+  //! \brief state at the beginning of the time step
+  mfront_gb_InitialState s0;
+  //! \brief state at the end of the time step
+  mfront_gb_State s1;
+};
+
+#ifdef __cplusplus
+
+namespace mfront::gb {
+
+  //! \brief a simple alias
+  using BatchBehaviourData = ::mfront_gb_BatchBehaviourData;
+
+}  // end of namespace mfront::gb
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H */
@@ -0,0 +1,196 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/BatchIntegrate.hxx
+ * \brief  This file implements the batched integration of behaviours
+ * generated by the `generic` interface.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_BATCHINTEGRATE_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_BATCHINTEGRATE_HXX
+
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include "MFront/GenericBehaviour/Types.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
+
+namespace mfront::gb {
+
+  /*!
+   * \brief a simple function to report errors
+   * \param[in] d: batched behaviour data
+   * \param[in] e: error message
+   */
+  inline void reportError(mfront_gb_BatchBehaviourData& d,
+                          const char* const e) {
+    constexpr std::size_t bsize = 511;
+    if (d.error_message == nullptr) {
+      return;
+    }
+    std::strncpy(d.error_message, e, bsize);
+    d.error_message[bsize] = '\0';
+  }  // end of reportError
+
+  /*!
+   * \brief integrate the behaviour over a time step on a set of
+   * integration points.
+   *
+   * The values of each integration point are gathered in a local
+   * buffer, which is allocated once, before calling the integrator.
+   * The outputs are then scattered back in the structures of arrays
+   * of the batched behaviour data.
+   *
+   * \tparam Integrator: callable object integrating the behaviour on one
+   * integration point. It takes a `mfront_gb_BehaviourData` object as
+   * argument and returns the status of the integration.
+   * \param[in,out] bd: batched behaviour data
+   * \param[in] integrator: integrator
+   * \return the minimal value of the status of the integration points.
+   * As for the non batched entry point, the integration on one
+   * integration point is successful only if its status is `1`: a status
+   * of `0` means that a smaller time step is requested and a status of
+   * `-1` reports a failure.
+   *
+   * \note the integration points are treated one after the other: this
+   * function only provides a single entry point for a set of integration
+   * points, which avoids one call through the behaviour interface per
+   * integration point.
+   */
+  template <typename Integrator>
+  int integrateBatch(mfront_gb_BatchBehaviourData& bd,
+                     const Integrator& integrator) {
+    using size_type = mfront_gb_size_type;
+    const auto n = bd.n;
+    const auto& sizes = bd.sizes;
+    if (n == 0) {
+      return 1;
+    }
+    if ((bd.options == nullptr) || (bd.rdt == nullptr) ||
+        (bd.status == nullptr)) {
+      reportError(bd, "invalid batched behaviour data");
+      return -1;
+    }
+    // the type of computation is shared by all integration points
+    const auto bs = bd.options[0] > 50;
+    const auto Ke = bs ? bd.options[0] - 100 : bd.options[0];
+    const auto export_K = (bd.K != nullptr) && ((Ke < -0.5) || (Ke > 0.5));
+    const auto Ksize = std::max(sizes.tangent_operator, size_type{3});
+    // local buffer
+    auto buffer = std::vector<real>{};
+    try {
+      buffer.resize(2 * (sizes.gradients + sizes.thermodynamic_forces +
+                         sizes.material_properties +
+                         sizes.internal_state_variables +
+                         sizes.external_state_variables) +
+                    Ksize);
+    } catch (...) {
+      reportError(bd, "memory allocation failed");
+      return -1;
+    }
+    auto* ptr = buffer.data();
+    auto allocate = [&ptr](const size_type s) {
+      auto* const r = ptr;
+      ptr += s;
+      return r;
+    };
+    auto* const g0 = allocate(sizes.gradients);
+    auto* const g1 = allocate(sizes.gradients);
+    auto* const th0 = allocate(sizes.thermodynamic_forces);
+    auto* const th1 = allocate(sizes.thermodynamic_forces);
+    auto* const mps0 = allocate(sizes.material_properties);
+    auto* const mps1 = allocate(sizes.material_properties);
+    auto* const isvs0 = allocate(sizes.internal_state_variables);
+    auto* const isvs1 = allocate(sizes.internal_state_variables);
+    auto* const esvs0 = allocate(sizes.external_state_variables);
+    auto* const esvs1 = allocate(sizes.external_state_variables);
+    auto* const K = allocate(Ksize);
+    // gather the values of the p-th integration point
+    auto gather = [n](real* const dest, const real* const src,
+                      const size_type s, const size_type p) -> real* {
+      if (src == nullptr) {
+        return nullptr;
+      }
+      for (size_type i = 0; i != s; ++i) {
+        dest[i] = src[i * n + p];
+      }
+      return dest;
+    };
+    // scatter the values of the p-th integration point
+    auto scatter = [n](real* const dest, const real* const src,
+                       const size_type s, const size_type p) {
+      if (dest == nullptr) {
+        return;
+      }
+      for (size_type i = 0; i != s; ++i) {
+        dest[i * n + p] = src[i];
+      }
+    };
+    auto shift = [](auto* const v, const size_type p) {
+      return v == nullptr ? v : v + p;
+    };
+    auto r = 1;
+    mfront_gb_BehaviourData d;
+    d.error_message = bd.error_message;
+    d.dt = bd.dt;
+    d.K = K;
+    for (size_type p = 0; p != n; ++p) {
+      std::copy(bd.options, bd.options + 3, K);
+      d.rdt = bd.rdt + p;
+      d.speed_of_sound = shift(bd.speed_of_sound, p);
+      d.s0.gradients = gather(g0, bd.s0.gradients, sizes.gradients, p);
+      d.s1.gradients = gather(g1, bd.s1.gradients, sizes.gradients, p);
+      d.s0.thermodynamic_forces = gather(th0, bd.s0.thermodynamic_forces,
+                                         sizes.thermodynamic_forces, p);
+      d.s1.thermodynamic_forces = gather(th1, bd.s1.thermodynamic_forces,
+                                         sizes.thermodynamic_forces, p);
+      d.s0.mass_density = shift(bd.s0.mass_density, p);
+      d.s1.mass_density = shift(bd.s1.mass_density, p);
+      d.s0.material_properties = gather(mps0, bd.s0.material_properties,
+                                        sizes.material_properties, p);
+      d.s1.material_properties = gather(mps1, bd.s1.material_properties,
+                                        sizes.material_properties, p);
+      d.s0.internal_state_variables =
+          gather(isvs0, bd.s0.internal_state_variables,
+                 sizes.internal_state_variables, p);
+      d.s1.internal_state_variables =
+          gather(isvs1, bd.s1.internal_state_variables,
+                 sizes.internal_state_variables, p);
+      d.s0.stored_energy = shift(bd.s0.stored_energy, p);
+      d.s1.stored_energy = shift(bd.s1.stored_energy, p);
+      d.s0.dissipated_energy = shift(bd.s0.dissipated_energy, p);
+      d.s1.dissipated_energy = shift(bd.s1.dissipated_energy, p);
+      d.s0.external_state_variables =
+          gather(esvs0, bd.s0.external_state_variables,
+                 sizes.external_state_variables, p);
+      d.s1.external_state_variables =
+          gather(esvs1, bd.s1.external_state_variables,
+                 sizes.external_state_variables, p);
+      const auto s = integrator(d);
+      bd.status[p] = s;
+      if (s != 1) {
+        // only the first error message is reported
+        d.error_message = nullptr;
+      }
+      r = std::min(r, s);
+      scatter(bd.s1.thermodynamic_forces, th1, sizes.thermodynamic_forces,
+              p);
+      scatter(bd.s1.internal_state_variables, isvs1,
+              sizes.internal_state_variables, p);
+      if (export_K) {
+        scatter(bd.K, K, sizes.tangent_operator, p);
+      }
+    }
+    return r;
+  }  // end of integrateBatch
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_BATCHINTEGRATE_HXX */
@@ -0,0 +1,53 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/ParametersBlock.hxx
+ * \brief  This file declares the `ScopedParametersBlock` class, used by
+ * the entry points of behaviours generated by the `generic` interface
+ * which take a caller-owned block of parameters.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_PARAMETERSBLOCK_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_PARAMETERSBLOCK_HXX
+
+#include "MFront/GenericBehaviour/Types.hxx"
+
+namespace mfront::gb {
+
+  /*!
+   * \brief an helper class which sets the parameters block used by the
+   * current thread and restores the previous one on destruction.
+   */
+  struct ScopedParametersBlock {
+    /*!
+     * \brief constructor
+     * \param[in] r: reference to the parameters block of the current thread
+     * \param[in] v: values of the parameters
+     */
+    ScopedParametersBlock(const real*& r, const real* const v) noexcept
+        : block(r), previous(r) {
+      this->block = v;
+    }  // end of ScopedParametersBlock
+    ScopedParametersBlock(ScopedParametersBlock&&) = delete;
+    ScopedParametersBlock(const ScopedParametersBlock&) = delete;
+    ScopedParametersBlock& operator=(ScopedParametersBlock&&) = delete;
+    ScopedParametersBlock& operator=(const ScopedParametersBlock&) = delete;
+    //! \brief destructor
+    ~ScopedParametersBlock() noexcept { this->block = this->previous; }
+
+   private:
+    //! \brief parameters block of the current thread
+    const real*& block;
+    //! \brief previous value of the parameters block
+    const real* const previous;
+  };  // end of struct ScopedParametersBlock
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_PARAMETERSBLOCK_HXX */
@@ -132,6 +132,12 @@ namespace mfront {
     virtual void treatMaximumIncrementValuePerIteration();
     //! \brief treat the `@NumericallyComputedJacobianBlocks` keyword
     virtual void treatNumericallyComputedJacobianBlocks();
+    //! \brief treat the `@BlockDiagonalJacobian` keyword
+    virtual void treatBlockDiagonalJacobian();
+    //! \brief treat the `@NumericalJacobianFiniteDifferenceScheme` keyword
+    virtual void treatNumericalJacobianFiniteDifferenceScheme();
+    //! \brief treat the `@NumericalJacobianUpdatePeriod` keyword
+    virtual void treatNumericalJacobianUpdatePeriod();
     /*!
      * \brief set the non linear solver
      * \param[in] s: non linear solver
@@ -83,6 +83,14 @@ namespace mfront {
     virtual void treatNoMelt();
     //! treat the --silent-build command line option
     virtual void treatSilentBuild();
+    //! treat the --jobs command line option
+    virtual void treatJobs();
+    /*!
+     * \return a string describing the options affecting the generated
+     * sources and their compilation, used to compute the keys of the
+     * build cache.
+     */
+    virtual std::string getBuildCacheOptions() const;
 
     virtual void treatNoDeps();
 
@@ -151,6 +159,10 @@ namespace mfront {
     bool buildLibs = false;
 
     bool cleanLibs = false;
+    //! \brief skip input files which are unchanged since the last session
+    bool useBuildCache = false;
+    //! \brief number of jobs used to build the libraries (0 means default)
+    unsigned short jobs = 0;
 
   };  // end of class MFront
 
@@ -14,36 +14,68 @@
 #ifndef LIB_MFRONT_MFRONTLOCK_HXX
 #define LIB_MFRONT_MFRONTLOCK_HXX
 
+#include <mutex>
+#include <string>
+#include <memory>
 #if defined _WIN32 || defined _WIN64 || defined __CYGWIN__
 #ifndef NOMINMAX
 #define NOMINMAX
 #endif
 #include <windows.h>
-#else
-#include <semaphore.h>
 #endif
 
 #include "MFront/MFrontConfig.hxx"
 
 namespace mfront {
 
-  //! The Great Mfront Lock
+  /*!
+   * \brief a lock protecting the files shared by the `MFront` sessions
+   * writing in the same directory (for instance, the `src/targets.lst`
+   * file or the generated `Makefile`).
+   *
+   * The lock is associated with a directory, so that sessions writing in
+   * unrelated directories do not wait for each other. On `POSIX` systems,
+   * the lock is implemented by calling `flock` on the `.mfront.lock` file
+   * of this directory. On `Windows`, a named mutex built from the
+   * absolute path of the directory is used.
+   *
+   * The lock also protects the files against concurrent accesses from
+   * threads of the same process.
+   */
   struct MFRONT_VISIBILITY_EXPORT MFrontLock {
+    //! \return the lock associated with the current directory
     static MFrontLock& getMFrontLock();
+    /*!
+     * \return the lock associated with the given directory
+     * \param[in] d: directory, which must exist
+     */
+    static MFrontLock& getMFrontLock(const std::string&);
+    //! \brief acquire the lock
     void lock();
+    //! \brief release the lock
     void unlock();
 
    private:
-    MFrontLock();
+    friend struct std::default_delete<MFrontLock>;
+    /*!
+     * \brief constructor
+     * \param[in] d: absolute path to the directory
+     */
+    MFrontLock(const std::string&);
     MFrontLock(const MFrontLock&) = delete;
     MFrontLock(MFrontLock&&) = delete;
     MFrontLock& operator=(const MFrontLock&) = delete;
     MFrontLock& operator=(MFrontLock&&) = delete;
     ~MFrontLock();
+    //! \brief directory associated with the lock
+    const std::string directory;
+    //! \brief mutex protecting the lock against concurrent threads
+    std::mutex m;
 #if defined _WIN32 || defined _WIN64 || defined __CYGWIN__
     HANDLE ghMutex;
 #else
-    sem_t* l;
+    //! \brief file descriptor of the lock file
+    int fd;
 #endif
   };  // end of struct MFrontLock
 
@@ -51,8 +83,13 @@ namespace mfront {
    * structure performing RAII on MFrontLock objects.
    */
   struct MFRONT_VISIBILITY_EXPORT MFrontLockGuard {
-    //! constructor
+    //! \brief lock the current directory
     MFrontLockGuard();
+    /*!
+     * \brief lock the given directory
+     * \param[in] d: directory
+     */
+    explicit MFrontLockGuard(const std::string&);
     //! destructor
     ~MFrontLockGuard();
 
@@ -61,6 +98,8 @@ namespace mfront {
     MFrontLockGuard(const MFrontLockGuard&) = delete;
     MFrontLockGuard& operator=(MFrontLockGuard&&) = delete;
     MFrontLockGuard& operator=(const MFrontLockGuard&) = delete;
+    //! \brief underlying lock
+    MFrontLock& l;
   };
 
 }  // end of namespace mfront
@@ -68,6 +68,37 @@ namespace mfront {
    * The user has to take care of it
    */
   MFRONTLOGSTREAM_VISIBILITY_EXPORT void setLogStream(std::ostream&);
+  /*!
+   * \brief set the logging stream used by the calling thread. This
+   * stream takes precedence over the stream set by `setLogStream`.
+   * \param[in] os: new logging stream. If null, the calling thread
+   * uses the stream set by `setLogStream`.
+   * \warning the stream is not handled by this function.
+   * The user has to take care of it
+   */
+  MFRONTLOGSTREAM_VISIBILITY_EXPORT void setThreadLogStream(std::ostream*);
+  /*!
+   * \brief an helper structure which sets the logging stream of the
+   * calling thread and restores the previous one when destroyed, even if
+   * an exception is thrown.
+   */
+  struct MFRONTLOGSTREAM_VISIBILITY_EXPORT ThreadLogStreamGuard {
+    /*!
+     * \brief constructor
+     * \param[in] os: logging stream of the calling thread
+     */
+    explicit ThreadLogStreamGuard(std::ostream&);
+    ThreadLogStreamGuard(ThreadLogStreamGuard&&) = delete;
+    ThreadLogStreamGuard(const ThreadLogStreamGuard&) = delete;
+    ThreadLogStreamGuard& operator=(ThreadLogStreamGuard&&) = delete;
+    ThreadLogStreamGuard& operator=(const ThreadLogStreamGuard&) = delete;
+    //! \brief destructor
+    ~ThreadLogStreamGuard();
+
+   private:
+    //! \brief previous logging stream of the calling thread
+    std::ostream* const previous;
+  };  // end of struct ThreadLogStreamGuard
 
   /*!
    * \brief set if MFront shall use unicode characters on output.
@@ -43,11 +43,14 @@ namespace mfront {
    * \param[in] t : target name
    * \param[in] d : directory
    * \param[in] f : file name
+   * \param[in] j : number of jobs. If null, `make` is called without
+   * the `-j` option.
    */
   MFRONT_VISIBILITY_EXPORT void callMake(
       const std::string&,
       const std::string& = "src",
-      const std::string& = "Makefile.mfront");
+      const std::string& = "Makefile.mfront",
+      const unsigned short = 0);
 
 }  // end of namespace mfront
 
@@ -55,6 +55,15 @@ namespace mfront {
                                        const SupportedTypes::TypeSize&,
                                        const std::string& = "this->jacobian",
                                        const std::string& = "");
+    /*!
+     * \return if forward finite differences, which reuse the residual at
+     * the current estimate, shall be used to compute a numerical
+     * approximation of the jacobian or of some of its blocks
+     * \param[in] mb  : mechanical behaviour description
+     * \param[in] h   : modelling hypothesis
+     */
+    static bool usesForwardFiniteDifferences(const BehaviourDescription&,
+                                             const Hypothesis);
     /*!
      * \return write the code comparing the jacobian to a numerical one
      * \param[in] out : output file
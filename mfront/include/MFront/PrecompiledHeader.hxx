@@ -0,0 +1,38 @@
+/*!
+ * \file   mfront/include/MFront/PrecompiledHeader.hxx
+ * \brief  This file declares the functions used by the generators to
+ * handle the precompiled header shared by the generated sources.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_PRECOMPILEDHEADER_HXX
+#define LIB_MFRONT_PRECOMPILEDHEADER_HXX
+
+#include <string>
+#include "MFront/MFrontConfig.hxx"
+
+namespace mfront {
+
+  //! \return the name of the header to be precompiled
+  MFRONT_VISIBILITY_EXPORT const char* getPrecompiledHeaderName();
+  /*!
+   * \brief write the header to be precompiled in the given directory.
+   *
+   * This header includes `MFront/BehaviourPrecompiledHeader.hxx`. The
+   * file is left untouched if it already exists with the same content,
+   * so that the precompiled header is not rebuilt needlessly.
+   *
+   * \param[in] d: directory
+   */
+  MFRONT_VISIBILITY_EXPORT void writePrecompiledHeader(const std::string&);
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_PRECOMPILEDHEADER_HXX */
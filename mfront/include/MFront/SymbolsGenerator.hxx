@@ -14,7 +14,10 @@
 #ifndef LIB_MFRONT_SYMBOLSGENERATOR_HXX
 #define LIB_MFRONT_SYMBOLSGENERATOR_HXX
 
+#include <map>
 #include <set>
+#include <vector>
+#include <string>
 #include <iosfwd>
 #include "TFEL/Material/ModellingHypothesis.hxx"
 #include "MFront/MFrontConfig.hxx"
@@ -36,6 +39,11 @@ namespace mfront {
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
     //! a simple alias
     using Hypothesis = ModellingHypothesis::Hypothesis;
+    /*!
+     * \brief content of a metadata record: values of the symbols, as
+     * strings, sorted by the name of the symbol without its prefix
+     */
+    using MetaData = std::map<std::string, std::vector<std::string>>;
     /*!
      * \return a name used to create symbols for the  interface
      * \param[in] i    : standard behaviour interface
@@ -93,6 +101,31 @@ namespace mfront {
     virtual void writeTFELVersionSymbol(std::ostream &,
                                         const BehaviourInterfaceBase &,
                                         const std::string &) const;
+    /*!
+     * \brief write the `_reentrant` symbol, which states if the
+     * behaviour can be called concurrently by several threads.
+     * \param[in] out: output file
+     * \param[in] i: standard behaviour interface
+     * \param[in] bd: behaviour description
+     * \param[in] n: name of the entry point
+     */
+    virtual void writeReentrantSymbol(std::ostream &,
+                                      const BehaviourInterfaceBase &,
+                                      const BehaviourDescription &,
+                                      const std::string &) const;
+    /*!
+     * \return if the code generated by the interface for the given
+     * behaviour is reentrant. The behaviours generated by the standard
+     * interfaces only use the data passed by the calling solver and
+     * read-only global data (parameters), and are thus reentrant unless
+     * the `reentrant` DSL option is set to false. Interfaces which rely
+     * on some global state modified during the behaviour integration
+     * must override this method.
+     * \param[in] i: standard behaviour interface
+     * \param[in] bd: behaviour description
+     */
+    virtual bool isReentrant(const BehaviourInterfaceBase &,
+                             const BehaviourDescription &) const;
     /*!
      * \param[in] out: output file
      * \param[in] i    : standard behaviour interface
@@ -182,6 +215,31 @@ namespace mfront {
                                  const FileDescription &,
                                  const std::string &,
                                  const Hypothesis) const;
+    /*!
+     * \brief write the metadata records describing the symbols generated
+     * by the `generateGeneralSymbols` and `generateSymbols` methods.
+     *
+     * One record is exported per prefix of those symbols, i.e. one for
+     * the general symbols (and the symbols shared by all the modelling
+     * hypotheses) and one per specialised modelling hypothesis. Those
+     * records allow the `ExternalLibraryManager` class to retrieve most
+     * information about a behaviour using a single look-up.
+     *
+     * \param[in] out  : output file
+     * \param[in] i: behaviour interface
+     * \param[in] mb   : behaviour description
+     * \param[in] fd   : file description
+     * \param[in] mhs  : modelling hypotheses
+     * \param[in] name : name of the behaviour as defined by the interface
+     *                   (generally taking into account the material
+     *                    and the behaviour name)
+     */
+    virtual void generateMetaDataSymbols(std::ostream &,
+                                         const BehaviourInterfaceBase &,
+                                         const BehaviourDescription &,
+                                         const FileDescription &,
+                                         const std::set<Hypothesis> &,
+                                         const std::string &) const;
     /*!
      * \param[in] out  : output file
      * \param[in] i: behaviour interface
@@ -546,6 +604,45 @@ namespace mfront {
     virtual void writeArrayOfIntsSymbol(std::ostream &,
                                         const std::string &,
                                         const std::vector<int> &) const;
+    /*!
+     * \brief add to a metadata record the values of the general symbols
+     * which do not depend on the interface.
+     *
+     * The symbols which may be specialised by the interfaces (behaviour
+     * type, kinematic, main variables, tangent operator blocks, etc.)
+     * are not described and are read individually.
+     *
+     * \param[out] md: metadata record
+     * \param[in]  i: behaviour interface
+     * \param[in]  bd: behaviour description
+     * \param[in]  mhs: modelling hypotheses
+     */
+    virtual void addGeneralMetaData(MetaData &,
+                                    const BehaviourInterfaceBase &,
+                                    const BehaviourDescription &,
+                                    const std::set<Hypothesis> &) const;
+    /*!
+     * \brief add to a metadata record the values of the symbols
+     * describing the variables of the behaviour for the given
+     * modelling hypothesis
+     * \param[out] md: metadata record
+     * \param[in]  i: behaviour interface
+     * \param[in]  bd: behaviour description
+     * \param[in]  h: modelling hypothesis
+     */
+    virtual void addMetaData(MetaData &,
+                             const BehaviourInterfaceBase &,
+                             const BehaviourDescription &,
+                             const Hypothesis) const;
+    /*!
+     * \brief write a metadata record
+     * \param[out] out: output stream
+     * \param[in]  p: prefix of the symbols described by the record
+     * \param[in]  md: metadata record
+     */
+    virtual void writeMetaDataSymbol(std::ostream &,
+                                     const std::string &,
+                                     const MetaData &) const;
 
   };  // end of struct SymbolsGenerator
 
@@ -372,7 +372,7 @@ namespace mfront {
     this->getExtraSrcIncludes(out, mb);
 
     if (ppolicy == "ThreadPool") {
-      out << "#include\"TFEL/System/ThreadPool.hxx\"\n";
+      out << "#include\"TFEL/System/ParallelizationSettings.hxx\"\n";
     }
     out << "#include\"TFEL/Material/OutOfBoundsPolicy.hxx\"\n"
         << "#include\"TFEL/Material/" << mb.getClassName() << ".hxx\"\n";
@@ -388,16 +388,6 @@ namespace mfront {
 
     this->writeGetOutOfBoundsPolicyFunctionImplementation(out, mb, name);
 
-    if (ppolicy == "ThreadPool") {
-      out << "static size_t getAbaqusExplicitNumberOfThreads(){\n"
-          << "const auto nthreads = ::getenv(\"ABAQUSEXPLICIT_NTHREADS\");\n"
-          << "if(nthreads==nullptr){\n"
-          << "return 4;\n"
-          << "}\n"
-          << "return std::stoi(nthreads);\n"
-          << "}\n\n";
-    }
-
     out << "extern \"C\"{\n\n";
     AbaqusExplicitSymbolsGenerator sg;
     sg.generateGeneralSymbols(out, *this, mb, fd, mhs, name);
@@ -410,6 +400,7 @@ namespace mfront {
         sg.generateSymbols(out, *this, mb, fd, name, h);
       }
     }
+    sg.generateMetaDataSymbols(out, *this, mb, fd, mhs, name);
 
     this->writeSetParametersFunctionsImplementations(out, mb, name);
     this->writeSetOutOfBoundsPolicyFunctionImplementation(out, mb, name);
@@ -453,10 +444,6 @@ namespace mfront {
               << "Profiler::getProfiler(),\n"
               << "BehaviourProfiler::TOTALTIME);\n";
         }
-        if (ppolicy == "ThreadPool") {
-          out << "static tfel::system::ThreadPool "
-                 "pool(getAbaqusExplicitNumberOfThreads());\n";
-        }
         this->writeChecks(out, mb, t, h);
         if (mb.getBehaviourType() ==
             BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
@@ -1022,21 +1009,18 @@ namespace mfront {
           << "integrate(i);\n"
           << "}\n";
     } else if (ppolicy == "ThreadPool") {
-      out << "auto integrate2 = [&integrate,nblock](const int b, const int "
-             "e){\n"
-          << "for(int i=b;i!=e;++i){\n"
-          << "integrate(i);\n"
-          << "}\n"
-          << "};\n"
-          << "const auto nthreads = pool.getNumberOfThreads();\n"
-          << "const auto ntasks   = nthreads/(*nblock);\n"
-          << "for(tfel::system::ThreadPool::size_type i=0;i!=nthreads;++i){\n"
-          << "pool.addTask(integrate2,i*ntasks,(i+1)*ntasks);\n"
-          << "}\n"
-          << "if(*nblock-ntasks*nthreads!=0){\n"
-          << "pool.addTask(integrate2,nthreads*ntasks,*nblock);\n"
-          << "}\n"
-          << "pool.wait();\n";
+      // the integration points are split in contiguous chunks which
+      // are treated by the threads of a pool shared by all the
+      // behaviours. The number of threads and the partitioning are
+      // defined at runtime (see `tfel::system::getParallelizationSettings`)
+      out << "using size_type = tfel::system::ThreadPool::size_type;\n"
+          << "const auto& settings = "
+             "tfel::system::getParallelizationSettings();\n"
+          << "tfel::system::getSharedThreadPool().parallel_for(\n"
+          << "settings.partitioning, 0, static_cast<size_type>(*nblock),\n"
+          << "settings.grain_size, [&integrate](const size_type i){\n"
+          << "integrate(static_cast<int>(i));\n"
+          << "});\n";
     } else {
       tfel::raise(
           "AbaqusExplicitInterface::writeIntegrateLoop: "
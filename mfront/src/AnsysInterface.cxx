@@ -923,6 +923,7 @@ namespace mfront {
         sg.generateSymbols(out, *this, mb, fd, name, h);
       }
     }
+    sg.generateMetaDataSymbols(out, *this, mb, fd, mhs, name);
 
     this->writeSetParametersFunctionsImplementations(out, mb, name);
     this->writeSetOutOfBoundsPolicyFunctionImplementation(out, mb, name);
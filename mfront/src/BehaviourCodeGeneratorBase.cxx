@@ -3226,6 +3226,38 @@ namespace mfront {
         areParametersTreatedAsStaticVariables(this->bd);
     this->checkBehaviourFile(os);
     const auto& d = this->bd.getBehaviourData(h);
+    const auto use_parameters_block =
+        (!use_static_variables) && (areParametersOwnedByTheCaller(this->bd)) &&
+        (!d.getParameters().empty());
+    if (use_parameters_block) {
+      // values given by the caller, stored in the order of the exported
+      // parameters
+      os << "if(const auto* const mfront_parameters_block = "
+         << this->bd.getClassName() << "ParametersBlock::get();\n"
+         << "mfront_parameters_block != nullptr){\n";
+      auto o = std::size_t{};
+      for (const auto& p : d.getParameters()) {
+        const auto value = [&p](const std::size_t i) {
+          const auto v = "mfront_parameters_block[" + std::to_string(i) + "]";
+          if (p.type == "int") {
+            return "static_cast<int>(" + v + ")";
+          } else if (p.type == "ushort") {
+            return "static_cast<unsigned short>(" + v + ")";
+          }
+          return p.type + "(static_cast<NumericType>(" + v + "))";
+        };
+        if (p.arraySize == 1u) {
+          os << "this->" << p.name << " = " << value(o) << ";\n";
+          ++o;
+        } else {
+          for (unsigned short i = 0; i != p.arraySize; ++i, ++o) {
+            os << "this->" << p.name << "[" << i << "] = " << value(o)
+               << ";\n";
+          }
+        }
+      }
+      os << "} else {\n";
+    }
     for (const auto& p : d.getParameters()) {
       if (use_static_variables) {
         if (!p.getAttribute<bool>(
@@ -3289,6 +3321,9 @@ namespace mfront {
         }
       }
     }
+    if (use_parameters_block) {
+      os << "}\n";
+    }
   }  // end of writeBehaviourParameterInitialisation
 
   void BehaviourCodeGeneratorBase::writeBehaviourDataMainVariablesSetters(
@@ -3982,6 +4017,25 @@ namespace mfront {
         this->writeBehaviourParametersInitializer(os, h);
       }
     }
+    if (areParametersOwnedByTheCaller(this->bd)) {
+      os << "/*!\n"
+         << " * \\brief structure giving access to the parameters block of "
+            "the current thread\n"
+         << " */\n"
+         << "struct " << this->bd.getClassName() << "ParametersBlock\n"
+         << "{\n"
+         << "/*!\n"
+         << " * \\return the parameters block of the current thread. If not "
+            "null,\n"
+         << " * the values of the parameters are read in this block, in the "
+            "order of\n"
+         << " * the parameters exported by the interfaces, rather than in the "
+            "parameters\n"
+         << " * initializers.\n"
+         << " */\n"
+         << "static const double*& get();\n"
+         << "};\n\n";
+    }
   }  // end of writeBehaviourParametersInitializers
 
   void BehaviourCodeGeneratorBase::writeBehaviourParametersInitializer(
@@ -5317,6 +5371,14 @@ namespace mfront {
         this->writeSrcFileParametersInitializer(os, h);
       }
     }
+    if (areParametersOwnedByTheCaller(this->bd)) {
+      const auto cname = this->bd.getClassName() + "ParametersBlock";
+      os << "const double*& " << cname << "::get()\n"
+         << "{\n"
+         << "static thread_local const double* b = nullptr;\n"
+         << "return b;\n"
+         << "}\n\n";
+    }
   }  // end of writeSrcFileParametersInitializer
 
   static void BehaviourCodeGeneratorBase_writeConverter(
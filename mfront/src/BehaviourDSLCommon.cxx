@@ -75,6 +75,8 @@ namespace mfront {
         .addDataTypeValidator<bool>(
             BehaviourDescription::
                 automaticDeclarationOfTheTemperatureAsFirstExternalStateVariable)
+        .addDataTypeValidator<bool>(BehaviourDescription::callerOwnedParameters)
+        .addDataTypeValidator<bool>(BehaviourDescription::reentrant)
         .addDataTypeValidator<std::string>(
             BehaviourDescription::modellingHypothesis)
         .addDataTypeValidator<std::vector<tfel::utilities::Data>>(
@@ -117,6 +119,8 @@ namespace mfront {
             {DSLBase::overridingParameters,
              BehaviourDescription::
                  automaticDeclarationOfTheTemperatureAsFirstExternalStateVariable,
+             BehaviourDescription::callerOwnedParameters,
+             BehaviourDescription::reentrant,
              BehaviourDescription::modellingHypothesis,
              BehaviourDescription::modellingHypotheses})),
         explicitlyDeclaredUsableInPurelyImplicitResolution(false) {
@@ -125,6 +129,13 @@ namespace mfront {
     constexpr auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
     //
     DSLBase::handleDSLOptions(this->mb, opts);
+    if ((areParametersOwnedByTheCaller(this->mb)) &&
+        (areParametersTreatedAsStaticVariables(this->mb))) {
+      this->throwRuntimeError(
+          "BehaviourDSLCommon::BehaviourDSLCommon",
+          "parameters can't be both owned by the caller and treated as static "
+          "variables");
+    }
     // By default, a behaviour can be used in a purely implicit resolution
     this->mb.setUsableInPurelyImplicitResolution(h, true);
     // reserve names
@@ -262,6 +273,17 @@ namespace mfront {
              automaticDeclarationOfTheTemperatureAsFirstExternalStateVariable,
          "boolean stating if the temperature shall be automatically declared "
          "as an external state variable"});
+    opts.push_back(
+        {BehaviourDescription::callerOwnedParameters,
+         "boolean stating if the values of the parameters may be given by the "
+         "caller, for each integration, in a parameters block. Those values "
+         "override the ones of the (global) parameters initializers"});
+    opts.push_back(
+        {BehaviourDescription::reentrant,
+         "boolean stating if the behaviour can be called concurrently by "
+         "several threads (true by default). This option shall be set to "
+         "false if the behaviour relies on some global state, for example "
+         "defined in external sources, modified during the integration"});
     return opts;
   }  // end of getDSLOptions
 
@@ -93,6 +93,10 @@ namespace mfront {
       "compareToNumericalJacobian";
   const char* const BehaviourData::numericallyComputedJacobianBlocks =
       "numericallyComputedJacobianBlocks";
+  const char* const BehaviourData::blockDiagonalJacobianVariables =
+      "blockDiagonalJacobianVariables";
+  const char* const BehaviourData::numericalJacobianFiniteDifferenceScheme =
+      "numericalJacobianFiniteDifferenceScheme";
   const char* const BehaviourData::allowsNewUserDefinedVariables =
       "allowsNewUserDefinedVariables";
   const char* const BehaviourData::algorithm = "algorithm";
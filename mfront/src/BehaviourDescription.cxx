@@ -38,6 +38,9 @@ namespace mfront {
       "modelling_hypothesis";
   const char* const BehaviourDescription::modellingHypotheses =
       "modelling_hypotheses";
+  const char* const BehaviourDescription::callerOwnedParameters =
+      "caller_owned_parameters";
+  const char* const BehaviourDescription::reentrant = "reentrant";
 
   static MaterialPropertyDescription buildMaterialPropertyDescription(
       const BehaviourDescription::ConstantMaterialProperty& mp,
@@ -465,6 +468,16 @@ namespace mfront {
       T.setGlossaryName("Temperature");
       this->addExternalStateVariable(uh, T, BehaviourData::UNREGISTRED);
     }
+    // parameters given by the caller
+    const auto* const Popt = BehaviourDescription::callerOwnedParameters;
+    if (tfel::utilities::get_if<bool>(opts, Popt, false)) {
+      this->setAttribute(Popt, true, false);
+    }
+    // reentrancy
+    const auto* const Ropt = BehaviourDescription::reentrant;
+    if (!tfel::utilities::get_if<bool>(opts, Ropt, true)) {
+      this->setAttribute(Ropt, false, false);
+    }
   }  // end of BehaviourDescription
 
   BehaviourDescription::BehaviourDescription(const BehaviourDescription&) =
@@ -3332,4 +3345,13 @@ namespace mfront {
     return bd.getClassName() + hn + "-parameters.txt";
   }  // end of getParametersFileName
 
+  bool areParametersOwnedByTheCaller(const BehaviourDescription& bd) {
+    return bd.getAttribute<bool>(BehaviourDescription::callerOwnedParameters,
+                                 false);
+  }  // end of areParametersOwnedByTheCaller
+
+  bool isBehaviourReentrant(const BehaviourDescription& bd) {
+    return bd.getAttribute<bool>(BehaviourDescription::reentrant, true);
+  }  // end of isBehaviourReentrant
+
 }  // end of namespace mfront
@@ -11,9 +11,13 @@
  * project under specific licensing conditions.
  */
 
+#include <bit>
 #include <ctime>
+#include <atomic>
 #include <string>
 #include <cstdint>
+#include <cstdlib>
+#include <fstream>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
@@ -26,14 +30,12 @@ namespace mfront {
 
 #if !(defined _WIN32 || defined _WIN64)
   /*!
-   * add a new measure
-   * t     : measure to which the new measure is added
+   * \return the duration, in nanoseconds, between two instants
    * start : start of the measure
    * end   : end of the measure
    */
-  static inline void add_measure(std::atomic<intmax_t>& t,
-                                 const timespec& start,
-                                 const timespec& end) {
+  static inline std::intmax_t get_duration(const timespec& start,
+                                           const timespec& end) {
     /* http://www.guyrutenberg.com/2007/09/22/profiling-code-using-clock_gettime
      */
     timespec temp;
@@ -44,10 +46,17 @@ namespace mfront {
       temp.tv_sec = end.tv_sec - start.tv_sec;
       temp.tv_nsec = end.tv_nsec - start.tv_nsec;
     }
-    t += 1000000000 * temp.tv_sec + temp.tv_nsec;
-  }  // end of add_measure
+    return 1000000000 * static_cast<std::intmax_t>(temp.tv_sec) +
+           temp.tv_nsec;
+  }  // end of get_duration
 #endif
 
+  //! \return a new identifier for a profiler
+  static std::size_t getNewProfilerIdentifier() {
+    static std::atomic<std::size_t> i{0};
+    return i++;
+  }  // end of getNewProfilerIdentifier
+
   /*!
    * print a time to the specified stream
    */
@@ -172,6 +181,30 @@ namespace mfront {
     return n;
   }
 
+  void BehaviourProfiler::CodeBlockMeasures::add(
+      const std::intmax_t d) noexcept {
+    const auto b = std::min(
+        static_cast<std::size_t>(std::bit_width(static_cast<std::uintmax_t>(
+            std::max(d, std::intmax_t{0})))),
+        this->histogram.size() - 1);
+    this->total += d;
+    ++(this->calls);
+    this->min = std::min(this->min, d);
+    this->max = std::max(this->max, d);
+    ++(this->histogram[b]);
+  }  // end of BehaviourProfiler::CodeBlockMeasures::add
+
+  void BehaviourProfiler::CodeBlockMeasures::merge(
+      const CodeBlockMeasures& src) noexcept {
+    this->total += src.total;
+    this->calls += src.calls;
+    this->min = std::min(this->min, src.min);
+    this->max = std::max(this->max, src.max);
+    for (std::size_t i = 0; i != this->histogram.size(); ++i) {
+      this->histogram[i] += src.histogram[i];
+    }
+  }  // end of BehaviourProfiler::CodeBlockMeasures::merge
+
   BehaviourProfiler::Timer::Timer(BehaviourProfiler& t, const unsigned short cn)
       : gtimer(t), c(cn) {
 #if !(defined _WIN32 || defined _WIN64)
@@ -182,34 +215,207 @@ namespace mfront {
   BehaviourProfiler::Timer::~Timer() {
 #if !(defined _WIN32 || defined _WIN64)
     ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(this->end));
-    add_measure(this->gtimer.measures[this->c], this->start, this->end);
+    auto& tm = this->gtimer.getThreadMeasures();
+    tm.measures[this->c].add(get_duration(this->start, this->end));
 #endif
   }  // end of BehaviourProfiler::~Timer
 
-  BehaviourProfiler::BehaviourProfiler(const std::string& n) : name(n) {
-    std::fill(begin(measures), end(measures), 0);
+  BehaviourProfiler::BehaviourProfiler(const std::string& n)
+      : name(n), identifier(getNewProfilerIdentifier()) {
   }  // end of BehaviourProfiler::BehaviourProfiler
 
+  BehaviourProfiler::ThreadMeasures& BehaviourProfiler::getThreadMeasures() {
+    // measures associated with the current thread, indexed by the
+    // identifiers of the profilers. Identifiers are used rather than
+    // addresses since they are never reused.
+    thread_local std::vector<std::pair<std::size_t, ThreadMeasures*>> cache;
+    for (const auto& c : cache) {
+      if (c.first == this->identifier) {
+        return *(c.second);
+      }
+    }
+    auto* tm = [this] {
+      auto lock = std::lock_guard<std::mutex>(this->m);
+      this->thread_measures.push_back(std::make_unique<ThreadMeasures>());
+      return this->thread_measures.back().get();
+    }();
+    cache.push_back({this->identifier, tm});
+    return *tm;
+  }  // end of BehaviourProfiler::getThreadMeasures
+
+  std::array<BehaviourProfiler::CodeBlockMeasures,
+             BehaviourProfiler::number_of_code_blocks>
+  BehaviourProfiler::getMeasures() const {
+    auto r = std::array<CodeBlockMeasures, number_of_code_blocks>{};
+    auto lock = std::lock_guard<std::mutex>(this->m);
+    for (const auto& tm : this->thread_measures) {
+      for (std::size_t i = 0; i != number_of_code_blocks; ++i) {
+        r[i].merge(tm->measures[i]);
+      }
+    }
+    return r;
+  }  // end of BehaviourProfiler::getMeasures
+
+  //! \return the upper bound of the given bin of an histogram
+  static std::uintmax_t getHistogramBinUpperBound(const std::size_t i) {
+    return std::uintmax_t{1} << i;
+  }  // end of getHistogramBinUpperBound
+
+  /*!
+   * \return the list of code blocks for which measures were performed,
+   * the total time being the last one
+   * \param[in] measures: measures
+   */
+  static std::vector<std::size_t> getMeasuredCodeBlocks(
+      const std::array<BehaviourProfiler::CodeBlockMeasures,
+                       BehaviourProfiler::number_of_code_blocks>& measures) {
+    auto r = std::vector<std::size_t>{};
+    for (std::size_t i = 0; i != measures.size(); ++i) {
+      if ((i != BehaviourProfiler::TOTALTIME) && (measures[i].calls != 0)) {
+        r.push_back(i);
+      }
+    }
+    if (measures[BehaviourProfiler::TOTALTIME].calls != 0) {
+      r.push_back(BehaviourProfiler::TOTALTIME);
+    }
+    return r;
+  }  // end of getMeasuredCodeBlocks
+
+  /*!
+   * \brief write the measures in the `JSON` format
+   * \param[in] f: file name
+   * \param[in] n: behaviour name
+   * \param[in] measures: measures
+   */
+  static void writeJSONProfilingReport(
+      const std::string& f,
+      const std::string& n,
+      const std::array<BehaviourProfiler::CodeBlockMeasures,
+                       BehaviourProfiler::number_of_code_blocks>& measures) {
+    std::ofstream out(f);
+    if (!out) {
+      std::cerr << "BehaviourProfiler: can't open file '" << f << "'\n";
+      return;
+    }
+    out << "{\n"
+        << "  \"behaviour\": \"" << n << "\",\n"
+        << "  \"unit\": \"ns\",\n"
+        << "  \"code_blocks\": [";
+    auto first = true;
+    for (const auto i : getMeasuredCodeBlocks(measures)) {
+      const auto& cm = measures[i];
+      out << (first ? "\n" : ",\n") << "    {\n"
+          << "      \"name\": \"" << getCodeBlockName(i) << "\",\n"
+          << "      \"total\": " << cm.total << ",\n"
+          << "      \"calls\": " << cm.calls << ",\n"
+          << "      \"min\": " << cm.min << ",\n"
+          << "      \"max\": " << cm.max << ",\n"
+          << "      \"histogram\": [";
+      auto first_bin = true;
+      for (std::size_t b = 0; b != cm.histogram.size(); ++b) {
+        if (cm.histogram[b] == 0) {
+          continue;
+        }
+        out << (first_bin ? "" : ", ") << "{\"upper_bound\": "
+            << getHistogramBinUpperBound(b) << ", \"calls\": "
+            << cm.histogram[b] << "}";
+        first_bin = false;
+      }
+      out << "]\n"
+          << "    }";
+      first = false;
+    }
+    out << "\n  ]\n"
+        << "}\n";
+  }  // end of writeJSONProfilingReport
+
+  /*!
+   * \brief write the measures in the `CSV` format. The histogram is
+   * described by the last columns, the name of each of those columns
+   * giving the upper bound of the associated bin.
+   * \param[in] f: file name
+   * \param[in] measures: measures
+   */
+  static void writeCSVProfilingReport(
+      const std::string& f,
+      const std::array<BehaviourProfiler::CodeBlockMeasures,
+                       BehaviourProfiler::number_of_code_blocks>& measures) {
+    std::ofstream out(f);
+    if (!out) {
+      std::cerr << "BehaviourProfiler: can't open file '" << f << "'\n";
+      return;
+    }
+    const auto blocks = getMeasuredCodeBlocks(measures);
+    auto nbins = std::size_t{};
+    for (const auto i : blocks) {
+      const auto& h = measures[i].histogram;
+      for (std::size_t b = 0; b != h.size(); ++b) {
+        if (h[b] != 0) {
+          nbins = std::max(nbins, b + 1);
+        }
+      }
+    }
+    out << "code block,total (ns),calls,min (ns),max (ns)";
+    for (std::size_t b = 0; b != nbins; ++b) {
+      out << ",<" << getHistogramBinUpperBound(b) << " ns";
+    }
+    out << '\n';
+    for (const auto i : blocks) {
+      const auto& cm = measures[i];
+      out << getCodeBlockName(i) << ',' << cm.total << ',' << cm.calls << ','
+          << cm.min << ',' << cm.max;
+      for (std::size_t b = 0; b != nbins; ++b) {
+        out << ',' << cm.histogram[b];
+      }
+      out << '\n';
+    }
+  }  // end of writeCSVProfilingReport
+
   BehaviourProfiler::~BehaviourProfiler() {
-    using size_type = std::array<std::atomic<std::intmax_t>, 23>::size_type;
+    const auto measures = this->getMeasures();
+    const auto blocks = getMeasuredCodeBlocks(measures);
     std::cout << "\nResults of " << this->name << " profiling : ";
-    print_time(std::cout, measures.back());
+    print_time(std::cout, measures[TOTALTIME].total);
     std::cout << '\n';
     std::string::size_type w{0};
-    for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
+    for (const auto i : blocks) {
+      if (i != TOTALTIME) {
         w = std::max(w, getCodeBlockName(i).size());
       }
     }
-    for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
-        std::cout << "- " << std::setw(w) << std::left << getCodeBlockName(i)
-                  << " : ";
-        print_time(std::cout, measures[i]);
-        std::cout << " (" << measures[i] << " ns)\n";
+    for (const auto i : blocks) {
+      if (i == TOTALTIME) {
+        continue;
       }
+      const auto& cm = measures[i];
+      std::cout << "- " << std::setw(w) << std::left << getCodeBlockName(i)
+                << " : ";
+      print_time(std::cout, cm.total);
+      std::cout << " (" << cm.total << " ns, " << cm.calls
+                << " calls, min: " << cm.min << " ns, max: " << cm.max
+                << " ns)\n";
     }
     std::cout << std::endl;
+    const auto* const formats = ::getenv("MFRONT_PROFILING_OUTPUT_FORMAT");
+    if (formats == nullptr) {
+      return;
+    }
+    auto fs = std::string{formats};
+    auto pos = std::string::size_type{};
+    while (pos <= fs.size()) {
+      const auto pe = std::min(fs.find(',', pos), fs.size());
+      const auto f = fs.substr(pos, pe - pos);
+      if (f == "json") {
+        writeJSONProfilingReport(this->name + "-profiling.json", this->name,
+                                 measures);
+      } else if (f == "csv") {
+        writeCSVProfilingReport(this->name + "-profiling.csv", measures);
+      } else if (!f.empty()) {
+        std::cerr << "BehaviourProfiler: unsupported output format '" << f
+                  << "'\n";
+      }
+      pos = pe + 1;
+    }
   }  // end of BehaviourProfiler::~BehaviourProfiler
 
 }  // end of namespace mfront
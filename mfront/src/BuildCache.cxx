@@ -0,0 +1,165 @@
+/*!
+ * \file   mfront/src/BuildCache.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/CxxTokenizer.hxx"
+#include "TFEL/System/System.hxx"
+#include "MFront/MFrontLock.hxx"
+#include "MFront/MFrontUtilities.hxx"
+#include "MFront/BuildCache.hxx"
+
+namespace mfront {
+
+  /*!
+   * \brief a minimal implementation of the 64 bits FNV-1a hash function
+   */
+  struct BuildCacheHash {
+    //! \brief add the given bytes to the hash
+    void update(const char* const b, const std::size_t n) noexcept {
+      for (std::size_t i = 0; i != n; ++i) {
+        this->value ^= static_cast<unsigned char>(b[i]);
+        this->value *= std::uint64_t{1099511628211u};
+      }
+    }  // end of update
+    //! \brief add the given string, and its size, to the hash
+    void update(const std::string& s) noexcept {
+      const auto n = std::to_string(s.size()) + ':';
+      this->update(n.data(), n.size());
+      this->update(s.data(), s.size());
+    }  // end of update
+    //! \return the hash as an hexadecimal string
+    std::string str() const {
+      std::ostringstream os;
+      os << std::hex << this->value;
+      return os.str();
+    }  // end of str
+    //! \brief current value
+    std::uint64_t value = std::uint64_t{14695981039346656037u};
+  };  // end of BuildCacheHash
+
+  static std::vector<std::string>& getDependencies() {
+    static std::vector<std::string> deps;
+    return deps;
+  }  // end of getDependencies
+
+  static std::string getBuildCacheDirectory() {
+    return "src" + tfel::system::dirStringSeparator() + "build-cache";
+  }  // end of getBuildCacheDirectory
+
+  static std::string getBuildCacheEntryPath(const std::string& f) {
+    auto h = BuildCacheHash{};
+    h.update(f);
+    return getBuildCacheDirectory() + tfel::system::dirStringSeparator() +
+           h.str() + ".cache";
+  }  // end of getBuildCacheEntryPath
+
+  static bool exists(const std::string& f) {
+    const std::ifstream file{f};
+    return static_cast<bool>(file);
+  }  // end of exists
+
+  void addBuildCacheDependency(const std::string& f) {
+    auto& deps = getDependencies();
+    deps.push_back(f);
+  }  // end of addBuildCacheDependency
+
+  const std::vector<std::string>& getBuildCacheDependencies() {
+    return getDependencies();
+  }  // end of getBuildCacheDependencies
+
+  std::string computeBuildCacheKey(const std::vector<std::string>& deps,
+                                   const std::string& opts) {
+    auto h = BuildCacheHash{};
+    h.update(opts);
+    for (const auto& d : deps) {
+      std::ifstream file{d, std::ios::binary};
+      if (!file) {
+        return "";
+      }
+      const auto content =
+          std::string{std::istreambuf_iterator<char>(file),
+                      std::istreambuf_iterator<char>()};
+      h.update(d);
+      h.update(content);
+    }
+    return h.str();
+  }  // end of computeBuildCacheKey
+
+  std::optional<BuildCacheEntry> getBuildCacheEntry(const std::string& f) {
+    using tfel::utilities::CxxTokenizer;
+    const auto m = "getBuildCacheEntry";
+    const auto fn = getBuildCacheEntryPath(f);
+    if (!exists(fn)) {
+      return {};
+    }
+    // the entries are protected by a lock distinct from the one of the
+    // current directory, so that reading the cache does not wait for
+    // sessions updating the shared files of the current directory
+    MFrontLockGuard lock(getBuildCacheDirectory());
+    try {
+      CxxTokenizer tokenizer{fn};
+      auto c = tokenizer.begin();
+      const auto pe = tokenizer.end();
+      CxxTokenizer::readSpecifiedToken(m, "key", c, pe);
+      CxxTokenizer::readSpecifiedToken(m, ":", c, pe);
+      auto key = read<std::string>(c, pe);
+      CxxTokenizer::readSpecifiedToken(m, ";", c, pe);
+      CxxTokenizer::readSpecifiedToken(m, "dependencies", c, pe);
+      CxxTokenizer::readSpecifiedToken(m, ":", c, pe);
+      auto dependencies = read<std::vector<std::string>>(c, pe);
+      CxxTokenizer::readSpecifiedToken(m, ";", c, pe);
+      CxxTokenizer::readSpecifiedToken(m, "targets", c, pe);
+      CxxTokenizer::readSpecifiedToken(m, ":", c, pe);
+      return BuildCacheEntry{std::move(key), std::move(dependencies),
+                             read<TargetsDescription>(c, pe)};
+    } catch (...) {
+      // a corrupted entry is simply ignored
+    }
+    return {};
+  }  // end of getBuildCacheEntry
+
+  void writeBuildCacheEntry(const std::string& f, const BuildCacheEntry& e) {
+    tfel::raise_if(e.dependencies.empty(),
+                   "writeBuildCacheEntry: no dependency given");
+    tfel::system::systemCall::mkdir(getBuildCacheDirectory());
+    MFrontLockGuard lock(getBuildCacheDirectory());
+    const auto fn = getBuildCacheEntryPath(f);
+    std::ofstream file{fn};
+    tfel::raise_if(!file, "writeBuildCacheEntry: can't open file '" + fn + "'");
+    file.exceptions(std::ios::badbit | std::ios::failbit);
+    file << "key : \"" << e.key << "\";\n";
+    write(file, e.dependencies, "dependencies");
+    file << "targets : " << e.targets;
+  }  // end of writeBuildCacheEntry
+
+  bool areGeneratedFilesAvailable(const TargetsDescription& t) {
+    using tfel::system::dirStringSeparator;
+    for (const auto& l : t.libraries) {
+      for (const auto& s : l.sources) {
+        if (!exists("src" + dirStringSeparator() + s)) {
+          return false;
+        }
+      }
+    }
+    return std::all_of(t.headers.begin(), t.headers.end(),
+                       [](const std::string& h) {
+                         return exists("include" + dirStringSeparator() + h);
+                       });
+  }  // end of areGeneratedFilesAvailable
+
+}  // end of namespace mfront
@@ -12,6 +12,7 @@
  */
 
 #include <set>
+#include <string>
 #include <cstring>
 #include <ostream>
 #include <sstream>
@@ -50,6 +51,7 @@
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/TargetsDescription.hxx"
 #include "MFront/GeneratorOptions.hxx"
+#include "MFront/PrecompiledHeader.hxx"
 #include "MFront/CMakeGenerator.hxx"
 
 namespace mfront {
@@ -113,6 +115,9 @@ namespace mfront {
     }
     //
     throw_if(!t.specific_targets.empty(), "specific targets are not supported");
+    if (o.precompiledHeaders) {
+      writePrecompiledHeader("src");
+    }
     m << "# CMakeList.txt generated by mfront.\n"
       << MFrontHeader::getHeader("# ") << "\n"
       << "\n"
@@ -312,6 +317,13 @@ namespace mfront {
       }
       m << "set_target_properties(" << l.name << '\n'
         << "PROPERTIES COMPILE_FLAGS \"${" << l.name << "_COMPILE_FLAGS}\")\n";
+      if (o.precompiledHeaders) {
+        m << "if(NOT (CMAKE_VERSION VERSION_LESS 3.16))\n"
+          << "  target_precompile_headers(" << l.name << " PRIVATE\n"
+          << "    \"$<$<COMPILE_LANGUAGE:CXX>:${CMAKE_CURRENT_SOURCE_DIR}/"
+          << getPrecompiledHeaderName() << ">\")\n"
+          << "endif()\n";
+      }
       if (l.suffix != LibraryDescription::getDefaultLibrarySuffix(
                           t.system, t.libraryType)) {
         m << "set_target_properties(" << l.name << '\n'
@@ -338,7 +350,9 @@ namespace mfront {
     }
   }
 
-  void callCMake(const std::string& t, const std::string& d) {
+  void callCMake(const std::string& t,
+                 const std::string& d,
+                 const unsigned short j) {
     using namespace tfel::system;
     using tfel::utilities::starts_with;
     const char* cmake = getCMakeCommand();
@@ -373,11 +387,19 @@ namespace mfront {
       tg1 = "--target";
       tg2 = t.c_str();
     }
+    const auto jobs = std::to_string(j);
+    const char* jb1 = nullptr;
+    const char* jb2 = nullptr;
+    if (j != 0) {
+      jb1 = "--parallel";
+      jb2 = jobs.c_str();
+    }
     const char* argv[] = {cmake, "-G", g.c_str(), ".", silent, nullptr};
-    const char* argv2[] = {cmake, "--build", ".",    tg1,    tg2,
-                           cfg1,  cfg2,      silent, nullptr};
-    std::remove_if(argv2, argv2 + 9,
-                   [](const char* ptr) { return ptr == nullptr; });
+    const char* argv2[] = {cmake, "--build", ".",  jb1,    jb2,    tg1,
+                           tg2,   cfg1,      cfg2, silent, nullptr};
+    // null arguments are removed. The remaining part of the array is
+    // filled with null pointers.
+    std::fill(std::remove(argv2, argv2 + 11, nullptr), argv2 + 11, nullptr);
     auto error = [&t](const std::string& e, const char* const* args) {
       auto msg = "callCmake: can't build target '" + t + "'\n";
       if (!e.empty()) {
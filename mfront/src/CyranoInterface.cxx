@@ -380,6 +380,7 @@ namespace mfront {
         sg.generateSymbols(out, *this, mb, fd, name, h);
       }
     }
+    sg.generateMetaDataSymbols(out, *this, mb, fd, mhs, name);
     exportUnsignedShortSymbol(
         out, "cyrano" + makeLowerCase(name) + "_Interface", 1u);
     this->writeSetParametersFunctionsImplementations(out, mb, name);
@@ -30,6 +30,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 
 #include "MFront/MFront.hxx"
+#include "MFront/BuildCache.hxx"
 #include "MFront/PedanticMode.hxx"
 #include "MFront/SupportedTypes.hxx"
 #include "MFront/DSLBase.hxx"
@@ -245,6 +246,7 @@ namespace mfront {
       const auto& name = std::get<3>(path);
       const auto impl = madnex::getMFrontImplementation(
           std::get<0>(path), std::get<1>(path), material, name);
+      addBuildCacheDependency(std::get<0>(path));
       this->overrideMaterialKnowledgeIdentifier(name);
       if (!material.empty()) {
         this->overrideMaterialName(material);
@@ -270,6 +272,7 @@ namespace mfront {
 #endif /* MFRONT_HAVE_MADNEX */
     } else {
       CxxTokenizer::openFile(f);
+      addBuildCacheDependency(f);
     }
     // substitutions
     const auto pe = s.end();
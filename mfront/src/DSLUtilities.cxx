@@ -117,6 +117,29 @@ namespace mfront {
     writePhysicalBoundsSymbols(os, n, mpd.parameters);
   }  // end of writeParametersSymbols
 
+  std::vector<int> getParametersTypes(
+      const VariableDescriptionContainer& parameters) {
+    auto types = std::vector<int>{};
+    for (const auto& p : parameters) {
+      const auto t = [&p] {
+        if (p.type == "int") {
+          return 1;
+        } else if (p.type == "ushort") {
+          return 2;
+        }
+        const auto f = SupportedTypes::getTypeFlag(p.type);
+        tfel::raise_if(f != SupportedTypes::SCALAR,
+                       "getParametersTypes: "
+                       "internal error, unsupported type "
+                       "for parameter '" +
+                           p.name + "'");
+        return 0;
+      }();
+      types.insert(types.end(), p.arraySize, t);
+    }
+    return types;
+  }  // end of getParametersTypes
+
   void writeParametersDeclarationSymbols(
       std::ostream& os,
       const std::string_view n,
@@ -125,44 +148,8 @@ namespace mfront {
                               parameters.getNumberOfVariables());
     exportArrayOfStringsSymbol(os, std::string{n} + "_Parameters",
                                parameters.getExternalNames());
-    if (parameters.empty()) {
-      exportSymbol(os, "const int *", std::string{n} + "_ParametersTypes",
-                   "nullptr");
-      return;
-    }
-    const auto size = [&parameters] {
-      auto s = std::size_t{};
-      for (const auto& p : parameters) {
-        s += p.arraySize;
-      }
-      return s;
-    }();
-    os << "MFRONT_EXPORT_ARRAY_OF_SYMBOLS(int, " << n << "_ParametersTypes, "
-       << size << ", MFRONT_EXPORT_ARRAY_ARGUMENTS(";
-    for (auto p = parameters.begin(); p != parameters.end();) {
-      for (unsigned short is = 0; is != p->arraySize;) {
-        if (p->type == "int") {
-          os << "1";
-        } else if (p->type == "ushort") {
-          os << "2";
-        } else {
-          const auto f = SupportedTypes::getTypeFlag(p->type);
-          tfel::raise_if(f != SupportedTypes::SCALAR,
-                         "SymbolsGenerator::writeParametersSymbols: "
-                         "internal error, unsupported type "
-                         "for parameter '" +
-                             p->name + "'");
-          os << "0";
-        }
-        if (++is != p->arraySize) {
-          os << ",";
-        }
-      }
-      if (++p != parameters.end()) {
-        os << ",";
-      }
-    }
-    os << "));\n\n";
+    exportArrayOfIntegersSymbol(os, std::string{n} + "_ParametersTypes",
+                                getParametersTypes(parameters));
   }  // end of writeParametersDeclarationSymbols
 
   void writeParametersDefaultValuesSymbols(
@@ -1127,6 +1127,9 @@ namespace mfront {
         (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) &&
         (bd.isStrainMeasureDefined()) &&
         (bd.getStrainMeasure() != BehaviourDescription::LINEARISED);
+    // entry points taking the values of the parameters
+    const auto with_parameters_block =
+        (areParametersOwnedByTheCaller(bd)) && (bd.hasParameters());
     std::ofstream out("include/MFront/GenericBehaviour/" + header);
     if (!out) {
       raise("could not open file '" + header + "'");
@@ -1143,7 +1146,8 @@ namespace mfront {
     out << "#ifndef " << hg << "\n"
         << "#define " << hg << "\n\n"
         << "#include\"TFEL/Config/TFELConfig.hxx\"\n"
-        << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n\n";
+        << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n"
+        << "#include\"MFront/GenericBehaviour/BatchBehaviourData.h\"\n\n";
 
     this->writeVisibilityDefines(out);
     out << "#ifdef __cplusplus\n"
@@ -1172,6 +1176,33 @@ namespace mfront {
           << " */\n"
           << "MFRONT_SHAREDOBJ int " << f
           << "(mfront_gb_BehaviourData* const);\n\n";
+      out << "/*!\n"
+          << " * \\brief integrate the behaviour on a set of integration "
+          << "points\n"
+          << " * \\param[in,out] d: material data\n"
+          << " */\n"
+          << "MFRONT_SHAREDOBJ int " << f
+          << "_batch(mfront_gb_BatchBehaviourData* const);\n\n";
+      if (with_parameters_block) {
+        out << "/*!\n"
+            << " * \\brief integrate the behaviour using the given values of "
+            << "the parameters\n"
+            << " * \\param[in,out] d: material data\n"
+            << " * \\param[in] p: values of the parameters\n"
+            << " */\n"
+            << "MFRONT_SHAREDOBJ int " << f
+            << "_with_parameters(mfront_gb_BehaviourData* const,\n"
+            << "const mfront_gb_real* const);\n\n";
+        out << "/*!\n"
+            << " * \\brief integrate the behaviour on a set of integration "
+            << "points using the given values of the parameters\n"
+            << " * \\param[in,out] d: material data\n"
+            << " * \\param[in] p: values of the parameters\n"
+            << " */\n"
+            << "MFRONT_SHAREDOBJ int " << f
+            << "_batch_with_parameters(mfront_gb_BatchBehaviourData* const,\n"
+            << "const mfront_gb_real* const);\n\n";
+      }
       // postprocessings
       for (const auto& p : d.getPostProcessings()) {
         out << "/*!\n"
@@ -1267,6 +1298,10 @@ namespace mfront {
       raise("unsupported behaviour type");
     }
 
+    out << "#include\"MFront/GenericBehaviour/BatchIntegrate.hxx\"\n";
+    if (with_parameters_block) {
+      out << "#include\"MFront/GenericBehaviour/ParametersBlock.hxx\"\n";
+    }
     out << "#include\"MFront/GenericBehaviour/" << header << "\"\n\n";
 
     this->writeGetOutOfBoundsPolicyFunctionImplementation(out, bd, name);
@@ -1344,11 +1379,42 @@ namespace mfront {
         sg.generateSymbols(out, *this, bd, fd, name, h);
       }
     }
+    sg.generateMetaDataSymbols(out, *this, bd, fd, mhs, name);
 
     writeRotationFunctionsImplementations(out, *this, bd, name);
     this->writeSetOutOfBoundsPolicyFunctionImplementation(out, bd, name);
     // parameters
     this->writeSetParametersFunctionsImplementations(out, bd, name);
+    // call to the integration of the behaviour on one integration point
+    auto get_integrate_call = [&bd, &raise, type,
+                               is_finite_strain_through_strain_measure](
+                                  const std::string& d,
+                                  const std::string& policy) -> std::string {
+      if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
+          (type == BehaviourDescription::COHESIVEZONEMODEL)) {
+        return "mfront::gb::integrate<Behaviour>(" + d +
+               ", Behaviour::STANDARDTANGENTOPERATOR, " + policy + ")";
+      } else if (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
+        if (is_finite_strain_through_strain_measure) {
+          const auto ms = bd.getStrainMeasure();
+          if (ms == BehaviourDescription::GREENLAGRANGE) {
+            return "mfront::gb::green_lagrange_strain::integrate<Behaviour>(" +
+                   d + ", " + policy + ")";
+          } else if (ms == BehaviourDescription::HENCKY) {
+            return "mfront::gb::logarithmic_strain::integrate<Behaviour>(" +
+                   d + ", " + policy + ")";
+          }
+          raise("unsupported strain measure");
+        }
+        return "mfront::gb::integrate<Behaviour>(" + d +
+               ", Behaviour::STANDARDTANGENTOPERATOR, " + policy + ")";
+      } else if (type == BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
+        return "mfront::gb::finite_strain::integrate<Behaviour>(" + d + ", " +
+               policy + ")";
+      }
+      raise("unsupported behaviour type");
+      return "";
+    };
     // behaviour implementations
     for (const auto h : mhs) {
       const auto& d = bd.getBehaviourData(h);
@@ -1425,37 +1491,9 @@ namespace mfront {
       if (this->shallGenerateMTestFileOnFailure(bd)) {
         out << "using mfront::SupportedTypes;\n";
       }
-      if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
-          (type == BehaviourDescription::COHESIVEZONEMODEL)) {
-        out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
-            << "Behaviour::STANDARDTANGENTOPERATOR, " << name
-            << "_getOutOfBoundsPolicy());\n";
-      } else if (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
-        if (is_finite_strain_through_strain_measure) {
-          const auto ms = bd.getStrainMeasure();
-          if (ms == BehaviourDescription::GREENLAGRANGE) {
-            out << "const auto r = "
-                << "mfront::gb::green_lagrange_strain::integrate<Behaviour>("
-                << "*d, " << name << "_getOutOfBoundsPolicy());\n";
-          } else if (ms == BehaviourDescription::HENCKY) {
-            out << "const auto r = "
-                << "mfront::gb::logarithmic_strain::integrate<Behaviour>("
-                << "*d, " << name << "_getOutOfBoundsPolicy());\n";
-          } else {
-            raise("unsupported strain measure");
-          }
-        } else {
-          out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
-              << "Behaviour::STANDARDTANGENTOPERATOR, " << name
-              << "_getOutOfBoundsPolicy());\n";
-        }
-      } else if (type == BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
-        out << "const auto r = "
-            << "mfront::gb::finite_strain::integrate<Behaviour>(*d, "  //
-            << name << "_getOutOfBoundsPolicy());\n";
-      } else {
-        raise("unsupported behaviour type");
-      }
+      out << "const auto r = "
+          << get_integrate_call("*d", name + "_getOutOfBoundsPolicy()")
+          << ";\n";
       if (this->shallGenerateMTestFileOnFailure(bd)) {
         out << "if(r!=1){\n";
         this->generateMTestFile(out, bd, h);
@@ -1463,6 +1501,43 @@ namespace mfront {
       }
       out << "return r;\n"
           << "} // end of " << f << "\n\n";
+      // batched behaviour integration
+      out << "MFRONT_SHAREDOBJ int " << f
+          << "_batch(mfront_gb_BatchBehaviourData* const d){\n"
+          << "using namespace tfel::material;\n"
+          << "using real = mfront::gb::real;\n"
+          << "constexpr auto h = ModellingHypothesis::"
+          << ModellingHypothesis::toUpperCaseString(h) << ";\n";
+      if (bd.useQt()) {
+        out << "using Behaviour = " << bd.getClassName() << "<h,real,true>;\n";
+      } else {
+        out << "using Behaviour = " << bd.getClassName() << "<h,real,false>;\n";
+      }
+      out << "const auto op = " << name << "_getOutOfBoundsPolicy();\n"
+          << "return mfront::gb::integrateBatch(*d, "
+          << "[op](mfront_gb_BehaviourData& pd){\n"
+          << "return " << get_integrate_call("pd", "op") << ";\n"
+          << "});\n"
+          << "} // end of " << f << "_batch\n\n";
+      // integration using a parameters block given by the caller
+      if (with_parameters_block) {
+        const auto block = "tfel::material::" + bd.getClassName() +
+                           "ParametersBlock::get()";
+        out << "MFRONT_SHAREDOBJ int " << f
+            << "_with_parameters(mfront_gb_BehaviourData* const d,\n"
+            << "const mfront_gb_real* const p){\n"
+            << "const auto g = mfront::gb::ScopedParametersBlock(" << block
+            << ", p);\n"
+            << "return " << f << "(d);\n"
+            << "} // end of " << f << "_with_parameters\n\n";
+        out << "MFRONT_SHAREDOBJ int " << f
+            << "_batch_with_parameters(mfront_gb_BatchBehaviourData* const d,\n"
+            << "const mfront_gb_real* const p){\n"
+            << "const auto g = mfront::gb::ScopedParametersBlock(" << block
+            << ", p);\n"
+            << "return " << f << "_batch(d);\n"
+            << "} // end of " << f << "_batch_with_parameters\n\n";
+      }
     }
     // postprocessings
     for (const auto h : mhs) {
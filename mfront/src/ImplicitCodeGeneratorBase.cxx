@@ -12,6 +12,7 @@
  */
 
 #include <ostream>
+#include <algorithm>
 #include <sstream>
 #include "TFEL/Glossary/Glossary.hxx"
 #include "TFEL/Glossary/GlossaryEntry.hxx"
@@ -37,6 +38,65 @@ namespace mfront {
     }
   }  // end of writeVariablesOffsets
 
+  /*!
+   * \brief write a permutation of the unknowns which gathers the unknowns
+   * associated with each block of a block diagonal jacobian, followed by
+   * the unknowns of the border.
+   * \return the size of a block
+   * \param[in] os: output stream
+   * \param[in] variables: integration variables
+   * \param[in] block_variables: variables split in blocks
+   * \param[in] nb: number of blocks
+   */
+  static SupportedTypes::TypeSize writeBlockDiagonalJacobianPermutation(
+      std::ostream& os,
+      const VariableDescriptionContainer& variables,
+      const std::vector<std::string>& block_variables,
+      const unsigned short nb) {
+    auto is_block_variable = [&block_variables](const VariableDescription& v) {
+      return std::find(block_variables.begin(), block_variables.end(),
+                       v.name) != block_variables.end();
+    };
+    const auto n = mfront::getTypeSize(variables);
+    auto bs = SupportedTypes::TypeSize();
+    os << "constexpr auto mfront_block_permutation = [] {\n"
+       << "auto mfront_p = std::array<unsigned short, " << n << ">{};\n"
+       << "auto mfront_pos = std::size_t{};\n"
+       << "for (unsigned short mfront_idx = 0; mfront_idx != " << nb
+       << "; ++mfront_idx) {\n";
+    auto o = SupportedTypes::TypeSize();
+    for (const auto& v : variables) {
+      if (is_block_variable(v)) {
+        const auto s = SupportedTypes::getTypeSize(v.type, v.arraySize / nb);
+        os << "for (unsigned short mfront_idx2 = 0; mfront_idx2 != (" << s
+           << "); ++mfront_idx2) {\n"
+           << "mfront_p[mfront_pos] = static_cast<unsigned short>((" << o
+           << ") + mfront_idx * (" << s << ") + mfront_idx2);\n"
+           << "++mfront_pos;\n"
+           << "}\n";
+        bs += s;
+      }
+      o += SupportedTypes::getTypeSize(v.type, v.arraySize);
+    }
+    os << "}\n";
+    o = SupportedTypes::TypeSize();
+    for (const auto& v : variables) {
+      const auto s = SupportedTypes::getTypeSize(v.type, v.arraySize);
+      if (!is_block_variable(v)) {
+        os << "for (unsigned short mfront_idx = 0; mfront_idx != (" << s
+           << "); ++mfront_idx) {\n"
+           << "mfront_p[mfront_pos] = static_cast<unsigned short>((" << o
+           << ") + mfront_idx);\n"
+           << "++mfront_pos;\n"
+           << "}\n";
+      }
+      o += s;
+    }
+    os << "return mfront_p;\n"
+       << "}();\n";
+    return bs;
+  }  // end of writeBlockDiagonalJacobianPermutation
+
   static void writeIgnoreVariablesOffsets(
       std::ostream& os, const VariableDescriptionContainer& variables) {
     for (const auto& v : variables) {
@@ -508,6 +568,17 @@ namespace mfront {
     n = n3;
     this->solver.writeSpecificMembers(os, this->bd, h);
     os << "SMType stiffness_matrix_type;\n";
+    if (this->bd.hasParameter(h, "numerical_jacobian_update_period")) {
+      os << "//! \\brief last evaluation of the numerical jacobian\n"
+         << "tfel::math::tmatrix<" << n << ", " << n
+         << ", NumericType> mfront_numerical_jacobian;\n"
+         << "//! \\brief number of iterations since the last evaluation of "
+            "the numerical jacobian\n"
+         << "ushort mfront_numerical_jacobian_age = 0;\n"
+         << "//! \\brief norm of the residual at the previous iteration\n"
+         << "NumericType mfront_numerical_jacobian_residual_norm = "
+            "NumericType(0);\n";
+    }
     //
     if (this->solver.usesJacobian()) {
       // compute the numerical part of the jacobian.  This method is
@@ -1002,23 +1073,35 @@ namespace mfront {
        << "tmatrix<" << n << "," << n
        << ", NumericType> tjacobian(this->jacobian);\n"
        << "for(ushort mfront_idx = 0; mfront_idx != " << n
-       << "; ++mfront_idx){\n"
-       << "this->zeros(mfront_idx) -= this->numerical_jacobian_epsilon;\n";
-    if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
-      os << "this->computeThermodynamicForces();\n";
-    }
-    os << "this->computeFdF(true);\n"
-       << "this->zeros = tzeros;\n"
-       << "tvector<" << n << ", NumericType> tfzeros2(this->fzeros);\n"
-       << "this->zeros(mfront_idx) += this->numerical_jacobian_epsilon;\n";
-    if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
-      os << "this->computeThermodynamicForces();\n";
+       << "; ++mfront_idx){\n";
+    if (NonLinearSystemSolverBase::usesForwardFiniteDifferences(this->bd, h)) {
+      // the residual at the current estimate, which is given by
+      // `fzeros` on entry, is reused
+      os << "this->zeros(mfront_idx) += this->numerical_jacobian_epsilon;\n";
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "this->fzeros = "
+            "(this->fzeros-tfzeros) / (this->numerical_jacobian_epsilon);\n";
+    } else {
+      os << "this->zeros(mfront_idx) -= this->numerical_jacobian_epsilon;\n";
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "this->zeros = tzeros;\n"
+         << "tvector<" << n << ", NumericType> tfzeros2(this->fzeros);\n"
+         << "this->zeros(mfront_idx) += this->numerical_jacobian_epsilon;\n";
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "this->fzeros = "
+            "(this->fzeros-tfzeros2) / (2 * "
+            "(this->numerical_jacobian_epsilon));\n";
     }
-    os << "this->computeFdF(true);\n"
-       << "this->fzeros = "
-          "(this->fzeros-tfzeros2) / (2 * "
-          "(this->numerical_jacobian_epsilon));\n"
-       << "for(ushort mfront_idx2 = 0; mfront_idx2!= " << n
+    os << "for(ushort mfront_idx2 = 0; mfront_idx2!= " << n
        << "; ++mfront_idx2){\n"
        << "njacobian(mfront_idx2,mfront_idx) = this->fzeros(mfront_idx2);\n"
        << "}\n"
@@ -1083,6 +1166,9 @@ namespace mfront {
                                              BehaviourData::Integrator);
     }
     this->solver.initializeNumericalParameters(os, this->bd, h);
+    if (this->bd.hasParameter(h, "numerical_jacobian_update_period")) {
+      os << "this->mfront_numerical_jacobian_age = 0;\n";
+    }
     os << "if(!this->solveNonLinearSystem()){\n";
     if (this->bd.useQt()) {
       os << "return MechanicalBehaviour<" << btype
@@ -1097,8 +1183,12 @@ namespace mfront {
     // using the partial jacobian invert. We consider very unlikely
     // that a user may use a numerical jacobian and provide an
     // analytic definition of the tangent operator
-    os << "if (this->stiffness_matrix_type != NOSTIFFNESSREQUESTED){\n"
-       << "this->updateOrCheckJacobian();\n"
+    os << "if (this->stiffness_matrix_type != NOSTIFFNESSREQUESTED){\n";
+    if (this->bd.hasParameter(h, "numerical_jacobian_update_period")) {
+      // the tangent operator requires an up-to-date jacobian
+      os << "this->mfront_numerical_jacobian_age = 0;\n";
+    }
+    os << "this->updateOrCheckJacobian();\n"
        << "}\n";
     if (this->bd.getAttribute(BehaviourData::profiling, false)) {
       writeStandardPerformanceProfilingEnd(os);
@@ -1198,7 +1288,28 @@ namespace mfront {
        << " */\n"
        << "TFEL_HOST_DEVICE void updateOrCheckJacobian(){\n";
     if (this->solver.requiresNumericalJacobian()) {
-      os << "this->computeNumericalJacobian(this->jacobian);\n";
+      if (this->bd.hasParameter(h, "numerical_jacobian_update_period")) {
+        // the last numerical jacobian is only reused as long as the
+        // residual decreases
+        os << "const auto mfront_residual_norm = "
+           << "tfel::math::norm(this->fzeros);\n"
+           << "if ((this->mfront_numerical_jacobian_age == 0) ||\n"
+           << "    (!(mfront_residual_norm < "
+           << "this->mfront_numerical_jacobian_residual_norm))) {\n"
+           << "this->computeNumericalJacobian(this->jacobian);\n"
+           << "this->mfront_numerical_jacobian = this->jacobian;\n"
+           << "this->mfront_numerical_jacobian_age = 0;\n"
+           << "} else {\n"
+           << "this->jacobian = this->mfront_numerical_jacobian;\n"
+           << "}\n"
+           << "this->mfront_numerical_jacobian_residual_norm = "
+           << "mfront_residual_norm;\n"
+           << "this->mfront_numerical_jacobian_age = static_cast<ushort>(\n"
+           << "(this->mfront_numerical_jacobian_age + 1) % "
+           << "(this->numerical_jacobian_update_period));\n";
+      } else {
+        os << "this->computeNumericalJacobian(this->jacobian);\n";
+      }
     } else {
       NonLinearSystemSolverBase::writeEvaluateNumericallyComputedBlocks(
           os, this->bd, h);
@@ -1348,13 +1459,36 @@ namespace mfront {
        << "tfel::math::tvector<" << n2 << ", NumericType>& mfront_vector)"
        << "const noexcept{\n"
        << "auto mfront_success = true;\n";
-    if (this->bd.getAttribute(BehaviourData::profiling, false)) {
-      writeStandardPerformanceProfilingBegin(os, this->bd.getClassName(),
-                                             "TinyMatrixSolve", "lu");
+    if (this->bd.hasAttribute(h,
+                              BehaviourData::blockDiagonalJacobianVariables)) {
+      const auto& ivs = d.getIntegrationVariables();
+      const auto& vars = this->bd.getAttribute<std::vector<std::string>>(
+          h, BehaviourData::blockDiagonalJacobianVariables);
+      // the number of blocks is the smallest array size
+      auto nb = ivs.getVariable(vars.front()).arraySize;
+      for (const auto& v : vars) {
+        nb = std::min(nb, ivs.getVariable(v).arraySize);
+      }
+      const auto bs =
+          writeBlockDiagonalJacobianPermutation(os, ivs, vars, nb);
+      if (this->bd.getAttribute(BehaviourData::profiling, false)) {
+        writeStandardPerformanceProfilingBegin(
+            os, this->bd.getClassName(), "TinyBorderedBlockDiagonalMatrixSolve",
+            "lu");
+      }
+      os << "mfront_success = "
+         << "tfel::math::TinyBorderedBlockDiagonalMatrixSolve<" << n2 << ", "
+         << nb << ", " << bs << ", NumericType, false>::exe("
+         << "mfront_matrix, mfront_vector, mfront_block_permutation);\n";
+    } else {
+      if (this->bd.getAttribute(BehaviourData::profiling, false)) {
+        writeStandardPerformanceProfilingBegin(os, this->bd.getClassName(),
+                                               "TinyMatrixSolve", "lu");
+      }
+      os << "mfront_success = "
+         << this->solver.getExternalAlgorithmClassName(this->bd, h)
+         << "::solveLinearSystem(mfront_matrix, mfront_vector);\n";
     }
-    os << "mfront_success = "
-       << this->solver.getExternalAlgorithmClassName(this->bd, h)
-       << "::solveLinearSystem(mfront_matrix, mfront_vector);\n";
     if (this->bd.getAttribute(BehaviourData::profiling, false)) {
       writeStandardPerformanceProfilingEnd(os);
     }
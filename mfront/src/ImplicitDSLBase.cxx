@@ -30,6 +30,7 @@
 #include "MFront/NonLinearSystemSolver.hxx"
 #include "MFront/NonLinearSystemSolverBase.hxx"
 #include "MFront/NonLinearSystemSolverFactory.hxx"
+#include "MFront/NewtonRaphsonSolvers.hxx"
 #include "MFront/UserDefinedNonLinearSystemSolver.hxx"
 #include "MFront/PerformanceProfiling.hxx"
 #include "MFront/AbstractBehaviourBrick.hxx"
@@ -51,6 +52,7 @@ namespace mfront {
     this->reserveName("\u03B8");
     this->reserveName("iterMax");
     this->reserveName("numerical_jacobian_epsilon");
+    this->reserveName("numerical_jacobian_update_period");
     this->reserveName("maximum_increment_value_per_iteration");
     this->reserveName("jacobianComparisonCriterion");
     this->reserveName("perturbatedSystemEvaluation");
@@ -137,6 +139,14 @@ namespace mfront {
     this->registerNewCallBack(
         "@NumericallyComputedJacobianBlocks",
         &ImplicitDSLBase::treatNumericallyComputedJacobianBlocks);
+    this->registerNewCallBack("@BlockDiagonalJacobian",
+                              &ImplicitDSLBase::treatBlockDiagonalJacobian);
+    this->registerNewCallBack(
+        "@NumericalJacobianFiniteDifferenceScheme",
+        &ImplicitDSLBase::treatNumericalJacobianFiniteDifferenceScheme);
+    this->registerNewCallBack(
+        "@NumericalJacobianUpdatePeriod",
+        &ImplicitDSLBase::treatNumericalJacobianUpdatePeriod);
     this->registerNewCallBack("@HillTensor", &ImplicitDSLBase::treatHillTensor);
     this->disableCallBack("@ComputedVar");
     //    this->disableCallBack("@UseQt");
@@ -1112,6 +1122,72 @@ namespace mfront {
     }
   }  // end of treatNumericallyComputedJacobianBlocks
 
+  void ImplicitDSLBase::treatBlockDiagonalJacobian() {
+    const std::string m = "ImplicitDSLBase::treatBlockDiagonalJacobian";
+    auto throw_if = [this, m](const bool b, const std::string& msg) {
+      if (b) {
+        this->throwRuntimeError(m, msg);
+      }
+    };
+    for (const auto& h : this->readHypothesesList()) {
+      const auto as = this->readList(m, "{", "}", false);
+      this->readSpecifiedToken(m, ";");
+      throw_if(as.empty(), "no variable given");
+      auto vars = std::vector<std::string>{};
+      for (const auto& t : as) {
+        throw_if(std::find(vars.begin(), vars.end(), t.value) != vars.end(),
+                 "variable '" + t.value + "' multiply declared");
+        vars.push_back(t.value);
+      }
+      throw_if(
+          this->mb.hasAttribute(h, BehaviourData::blockDiagonalJacobianVariables),
+          "the block structure of the jacobian has already been defined");
+      this->mb.setAttribute(h, BehaviourData::blockDiagonalJacobianVariables,
+                            vars);
+    }
+    this->mb.appendToIncludes(
+        "#include \"TFEL/Math/TinyBorderedBlockDiagonalMatrixSolve.hxx\"");
+  }  // end of treatBlockDiagonalJacobian
+
+  void ImplicitDSLBase::treatNumericalJacobianFiniteDifferenceScheme() {
+    const std::string m =
+        "ImplicitDSLBase::treatNumericalJacobianFiniteDifferenceScheme";
+    const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    this->checkNotEndOfFile(m, "Expected 'Centered' or 'Forward'.");
+    const auto s = this->current->value;
+    if ((s != "Centered") && (s != "Forward")) {
+      this->throwRuntimeError(m, "Expected to read 'Centered' or 'Forward' "
+                                 "instead of '" + s + "'.");
+    }
+    if (this->mb.hasAttribute(
+            h, BehaviourData::numericalJacobianFiniteDifferenceScheme)) {
+      this->throwRuntimeError(m, "finite difference scheme already defined");
+    }
+    ++(this->current);
+    this->readSpecifiedToken(m, ";");
+    this->mb.setAttribute(
+        h, BehaviourData::numericalJacobianFiniteDifferenceScheme, s);
+  }  // end of treatNumericalJacobianFiniteDifferenceScheme
+
+  void ImplicitDSLBase::treatNumericalJacobianUpdatePeriod() {
+    const std::string m =
+        "ImplicitDSLBase::treatNumericalJacobianUpdatePeriod";
+    const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    const auto p = this->readUnsignedShort(m);
+    if (p == 0) {
+      this->throwRuntimeError(m, "invalid update period");
+    }
+    this->readSpecifiedToken(m, ";");
+    VariableDescription v("ushort", "numerical_jacobian_update_period", 1u,
+                          0u);
+    v.description =
+        "number of iterations between two evaluations of the numerical "
+        "approximation of the jacobian";
+    this->mb.addParameter(h, v, BehaviourData::ALREADYREGISTRED);
+    this->mb.setParameterDefaultValue(h, "numerical_jacobian_update_period",
+                                      p);
+  }  // end of treatNumericalJacobianUpdatePeriod
+
   void ImplicitDSLBase::completeVariableDeclaration() {
     using namespace tfel::glossary;
     const auto uh = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
@@ -1350,6 +1426,11 @@ namespace mfront {
                "@CompareToNumericalJacobian can only be used with solver using "
                "an analytical jacobian (or an approximation of it");
     }
+    if (this->mb.hasParameter(uh, "numerical_jacobian_update_period")) {
+      throw_if(!this->solver->requiresNumericalJacobian(),
+               "@NumericalJacobianUpdatePeriod can only be used with solvers "
+               "based on a numerical approximation of the jacobian");
+    }
     // create the compute final stress code is necessary
     this->setComputeFinalThermodynamicForcesFromComputeFinalThermodynamicForcesCandidateIfNecessary();
     // correct prediction to take into account normalisation factors
@@ -1396,6 +1477,33 @@ namespace mfront {
                        nd.second + "' is not an integration variable");
         }
       }
+      if (this->mb.hasAttribute(
+              h, BehaviourData::blockDiagonalJacobianVariables)) {
+        throw_if(dynamic_cast<const NewtonRaphsonSolverBase*>(
+                     this->solver.get()) == nullptr,
+                 "a block diagonal jacobian can only be declared for "
+                 "solvers based on the Newton-Raphson algorithm");
+        const auto& vars = this->mb.getAttribute<std::vector<std::string>>(
+            h, BehaviourData::blockDiagonalJacobianVariables);
+        const auto& ivs = this->mb.getBehaviourData(h).getIntegrationVariables();
+        for (const auto& n : vars) {
+          throw_if(!this->mb.isIntegrationVariableName(h, n),
+                   "'" + n + "' is not an integration variable");
+          throw_if(ivs.getVariable(n).arraySize == 1u,
+                   "integration variable '" + n + "' is not an array");
+        }
+        // the number of blocks is the smallest array size
+        auto nb = ivs.getVariable(vars.front()).arraySize;
+        for (const auto& n : vars) {
+          nb = std::min(nb, ivs.getVariable(n).arraySize);
+        }
+        for (const auto& n : vars) {
+          throw_if(ivs.getVariable(n).arraySize % nb != 0,
+                   "the array size of the integration variable '" + n +
+                       "' is not a multiple of the number of blocks (" +
+                       std::to_string(nb) + ")");
+        }
+      }
       if (this->mb.hasCode(h, BehaviourData::ComputePredictor)) {
         CodeBlock predictor;
         const auto& d = this->mb.getBehaviourData(h);
@@ -415,7 +415,8 @@ namespace mfront {
     //     this->getExtraSrcIncludes(out, mb);
     //
     //     if (ppolicy == "ThreadPool") {
-    //       out << "#include\"TFEL/System/ThreadPool.hxx\"\n";
+    //       out <<
+    //       "#include\"TFEL/System/ParallelizationSettings.hxx\"\n";
     //     }
     //     out << "#include\"TFEL/Material/OutOfBoundsPolicy.hxx\"\n"
     //         << "#include\"TFEL/Material/" << mb.getClassName() <<
@@ -435,17 +436,6 @@ namespace mfront {
     //     this->writeGetOutOfBoundsPolicyFunctionImplementation(out, mb,
     //     name);
     //
-    //     if (ppolicy == "ThreadPool") {
-    //       out << "static size_t getLSDYNANumberOfThreads(){\n"
-    //           << "const auto nthreads =
-    //           ::getenv(\"LSDYNAEXPLICIT_NTHREADS\");\n"
-    //           << "if(nthreads==nullptr){\n"
-    //           << "return 4;\n"
-    //           << "}\n"
-    //           << "return std::stoi(nthreads);\n"
-    //           << "}\n\n";
-    //     }
-    //
     //     out << "extern \"C\"{\n\n";
     //
     //     this->generateGeneralSymbols(out, name, mb, fd);
@@ -507,10 +497,6 @@ namespace mfront {
     //               << "Profiler::getProfiler(),\n"
     //               << "BehaviourProfiler::TOTALTIME);\n";
     //         }
-    //         if (ppolicy == "ThreadPool") {
-    //           out << "static tfel::system::ThreadPool "
-    //                  "pool(getLSDYNANumberOfThreads());\n";
-    //         }
     //         this->writeChecks(out, mb, t, h);
     //         if (mb.getBehaviourType() ==
     //             BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
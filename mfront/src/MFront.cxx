@@ -25,6 +25,7 @@
 #include <memory>
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Config/GetTFELVersion.h"
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/Utilities/TerminalColors.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
@@ -47,6 +48,7 @@
 #include "MFront/MFrontLock.hxx"
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/MFrontUtilities.hxx"
+#include "MFront/BuildCache.hxx"
 #include "MFront/CMakeGenerator.hxx"
 #include "MFront/MakefileGenerator.hxx"
 #include "MFront/MFront.hxx"
@@ -284,6 +286,26 @@ namespace mfront {
     }
   }  // end of MFront::treatSilentBuild
 
+  void MFront::treatJobs() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MFront::treatJobs: "
+                   "no argument given to the "
+                   "--jobs option");
+    const auto n = [&o] {
+      try {
+        return std::stoi(o);
+      } catch (...) {
+        return 0;
+      }
+    }();
+    tfel::raise_if((n <= 0) || (n > 1024),
+                   "MFront::treatJobs: "
+                   "invalid argument '" +
+                       o + "' given to the --jobs option");
+    this->jobs = static_cast<unsigned short>(n);
+  }  // end of MFront::treatJobs
+
   void MFront::treatTarget() {
     using tfel::utilities::tokenize;
     const auto& t = tokenize(this->currentArgument->getOption(), ',');
@@ -454,6 +476,14 @@ namespace mfront {
 #endif
     this->registerNewCallBack("--silent-build", &MFront::treatSilentBuild,
                               "active or desactivate silent build", true);
+    this->registerNewCallBack("--jobs", "-j", &MFront::treatJobs,
+                              "number of jobs used to build the libraries",
+                              true);
+    this->registerCallBack(
+        "--build-cache",
+        CallBack("don't treat again the input files which did not change, "
+                 "nor their dependencies, since the last session",
+                 [this]() noexcept { this->useBuildCache = true; }, false));
     this->registerNewCallBack("--make", &MFront::treatMake,
                               "generate MakeFile (see also --build)");
     this->registerNewCallBack("--build", &MFront::treatBuild,
@@ -470,6 +500,12 @@ namespace mfront {
         "-g", CallBack(
                   "add debugging symbols",
                   [this]() noexcept { this->opts.debugFlags = true; }, false));
+    this->registerCallBack(
+        "--precompiled-headers",
+        CallBack("precompile the headers commonly included by the "
+                 "generated sources",
+                 [this]() noexcept { this->opts.precompiledHeaders = true; },
+                 false));
     this->registerNewCallBack(
         "--target", "-t", &MFront::treatTarget,
         "generate build file and build the specified target", true);
@@ -768,10 +804,42 @@ namespace mfront {
   }  // end of void MFront::treatDefFile
 #endif /* (defined _WIN32 || defined _WIN64 ||defined __CYGWIN__) */
 
+  std::string MFront::getBuildCacheOptions() const {
+    auto o = std::string{::getTFELVersion()};
+    for (const auto& a : this->args) {
+      const auto& n = a.as_string();
+      if ((n.empty()) || (n[0] != '-') || (n == "--verbose") ||
+          (n == "--jobs") || (n == "--silent-build") ||
+          (n == "--build-cache")) {
+        continue;
+      }
+      o += '\n' + n + '=' + a.getOption();
+    }
+    for (const auto v : {"CXX", "CXXFLAGS", "CPPFLAGS", "LDFLAGS"}) {
+      const auto* const e = ::getenv(v);
+      o += '\n' + std::string{v} + '=' + ((e != nullptr) ? e : "");
+    }
+    return o;
+  }  // end of MFront::getBuildCacheOptions
+
   TargetsDescription MFront::treatFile(const std::string& f) const {
+    const auto cache_options =
+        this->useBuildCache ? this->getBuildCacheOptions() : std::string{};
+    if (this->useBuildCache) {
+      const auto e = getBuildCacheEntry(f);
+      if ((e.has_value()) && (!e->key.empty()) &&
+          (computeBuildCacheKey(e->dependencies, cache_options) == e->key) &&
+          (areGeneratedFilesAvailable(e->targets))) {
+        if (getVerboseMode() >= VERBOSE_LEVEL2) {
+          getLogStream() << "File '" << f << "' is up to date" << std::endl;
+        }
+        return e->targets;
+      }
+    }
     if (getVerboseMode() >= VERBOSE_LEVEL2) {
       getLogStream() << "Treating file: '" << f << "'" << std::endl;
     }
+    const auto nbr_of_dependencies = getBuildCacheDependencies().size();
     auto dsl = MFrontBase::getDSL(f);
     if (!this->interfaces.empty()) {
       dsl->setInterfaces(this->interfaces);
@@ -788,6 +856,21 @@ namespace mfront {
 #endif /* _MSC_VER */
       }
     }
+    if (this->useBuildCache) {
+      // files read since the beginning of the treatment of the file
+      const auto& all_dependencies = getBuildCacheDependencies();
+      auto dependencies = std::vector<std::string>{};
+      for (auto p = all_dependencies.begin() + nbr_of_dependencies;
+           p != all_dependencies.end(); ++p) {
+        insert_if(dependencies, *p);
+      }
+      auto key = computeBuildCacheKey(dependencies, cache_options);
+      const auto e =
+          BuildCacheEntry{std::move(key), std::move(dependencies), td};
+      if ((!e.key.empty()) && (!e.dependencies.empty())) {
+        writeBuildCacheEntry(f, e);
+      }
+    }
     return td;
   }  // end of MFront::treatFile()
 
@@ -817,9 +900,9 @@ namespace mfront {
 
   void MFront::buildLibraries(const std::string& target) {
     if (this->generator == CMAKE) {
-      callCMake(target);
+      callCMake(target, "src", this->jobs);
     } else {
-      callMake(target);
+      callMake(target, "src", "Makefile.mfront", this->jobs);
     }
   }  // end of MFront::buildLibraries
 
@@ -11,14 +11,17 @@
  * project under specific licensing conditions.
  */
 
-#include <stdexcept>
+#include <map>
+#include <cstdint>
 #include <sstream>
+#include <stdexcept>
 
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
+#include <cerrno>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/file.h>
 #include <fcntl.h>
-#include <semaphore.h>
 #include <unistd.h>
 #endif
 
@@ -30,69 +33,113 @@
 namespace mfront {
 
   MFrontLock& MFrontLock::getMFrontLock() {
-    static MFrontLock lock;
-    return lock;
+    return MFrontLock::getMFrontLock(".");
+  }  // end of MFrontLock::getMFrontLock
+
+  MFrontLock& MFrontLock::getMFrontLock(const std::string& d) {
+    static std::mutex m;
+    static std::map<std::string, std::unique_ptr<MFrontLock>> locks;
+    const auto p = tfel::system::systemCall::getAbsolutePath(d);
+    std::lock_guard<std::mutex> lock(m);
+    auto pl = locks.find(p);
+    if (pl == locks.end()) {
+      pl = locks.emplace(p, std::unique_ptr<MFrontLock>(new MFrontLock(p)))
+               .first;
+    }
+    return *(pl->second);
   }  // end of MFrontLock::getMFrontLock
 
-  MFrontLock::MFrontLock() {
+  MFrontLock::MFrontLock(const std::string& d) : directory(d) {
 #if defined _WIN32 || defined _WIN64 || defined __CYGWIN__
-    this->ghMutex = CreateMutex(nullptr,    // default security attributes
-                                FALSE,      // initially not owned
-                                "mfront");  // named mutex
+    // backslashes are not allowed in the names of mutexes
+    auto h = std::uint64_t{14695981039346656037u};
+    for (const auto c : d) {
+      h ^= static_cast<unsigned char>(c);
+      h *= std::uint64_t{1099511628211u};
+    }
+    std::ostringstream n;
+    n << "mfront-" << std::hex << h;
+    this->ghMutex = CreateMutex(nullptr,  // default security attributes
+                                FALSE,    // initially not owned
+                                n.str().c_str());  // named mutex
     tfel::raise_if(this->ghMutex == nullptr,
                    "MFrontLock::MFrontLock: "
-                   "semaphore creation failed");
+                   "mutex creation failed");
 #else
-    std::ostringstream sn;
-    sn << "/mfront-" << ::geteuid();
-    this->l = ::sem_open(sn.str().c_str(), O_CREAT, S_IRUSR | S_IWUSR, 1);
-    tfel::raise_if(this->l == SEM_FAILED,
+    const auto f = d + "/.mfront.lock";
+    this->fd = ::open(f.c_str(), O_RDWR | O_CREAT | O_CLOEXEC,
+                      S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+    tfel::raise_if(this->fd == -1,
                    "MFrontLock::MFrontLock: "
-                   "semaphore creation failed");
+                   "can't open file '" +
+                       f + "'");
 #endif
   }  // end of MFrontLock::MFrontLock()
 
   void MFrontLock::lock() {
     if (getVerboseMode() >= VERBOSE_LEVEL2) {
       getLogStream() << "MFrontLock::lock: "
-                     << "trying to lock semaphore\n";
+                     << "trying to lock directory '" << this->directory
+                     << "'\n";
     }
+    this->m.lock();
 #if defined _WIN32 || defined _WIN64 || defined __CYGWIN__
     DWORD dwWaitResult;
     dwWaitResult = ::WaitForSingleObject(this->ghMutex,  // handle to mutex
                                          INFINITE);      // no time-out interval
-    tfel::raise_if(dwWaitResult == WAIT_ABANDONED,
-                   "MFrontLock::MFrontLock: "
-                   "semaphore can't be aquired");
+    if (dwWaitResult == WAIT_ABANDONED) {
+      this->m.unlock();
+      tfel::raise(
+          "MFrontLock::lock: "
+          "mutex can't be aquired");
+    }
 #else
-    tfel::raise_if(::sem_wait(this->l) == -1,
-                   "MFrontLock::MFrontLock: "
-                   "semaphore can't be aquired");
+    auto r = int{};
+    do {
+      r = ::flock(this->fd, LOCK_EX);
+    } while ((r == -1) && (errno == EINTR));
+    if (r == -1) {
+      this->m.unlock();
+      tfel::raise(
+          "MFrontLock::lock: "
+          "lock on directory '" +
+          this->directory + "' can't be aquired");
+    }
 #endif
   }  // end of MFrontLock::lock()
 
   void MFrontLock::unlock() {
     if (getVerboseMode() >= VERBOSE_LEVEL2) {
       getLogStream() << "MFrontLock::unlock: "
-                     << "unlocking semaphore\n";
+                     << "unlocking directory '" << this->directory << "'\n";
     }
 #if defined _WIN32 || defined _WIN64 || defined __CYGWIN__
     ::ReleaseMutex(this->ghMutex);
 #else
-    ::sem_post(this->l);
+    ::flock(this->fd, LOCK_UN);
 #endif
+    this->m.unlock();
   }  // end of MFrontLock::unlock()
 
   MFrontLock::~MFrontLock() {
-    this->unlock();
+#if defined _WIN32 || defined _WIN64 || defined __CYGWIN__
+    ::CloseHandle(this->ghMutex);
+#else
+    ::close(this->fd);
+#endif
   }  // end of MFrontLock::~MFrontLock()
 
-  MFrontLockGuard::MFrontLockGuard() {
-    MFrontLock::getMFrontLock().lock();
+  MFrontLockGuard::MFrontLockGuard() : l(MFrontLock::getMFrontLock()) {
+    this->l.lock();
+  }  // end of MFrontLockGuard::MFrontLockGuard
+
+  MFrontLockGuard::MFrontLockGuard(const std::string& d)
+      : l(MFrontLock::getMFrontLock(d)) {
+    this->l.lock();
   }  // end of MFrontLockGuard::MFrontLockGuard
 
   MFrontLockGuard::~MFrontLockGuard() {
-    MFrontLock::getMFrontLock().unlock();
+    this->l.unlock();
   }  // end of MFrontLockGuard::~MFrontLockGuard
 
 }  // end of namespace mfront
@@ -97,7 +97,16 @@ namespace mfront {
     }
   }  // end of setVerboseMode
 
+  //! \return the logging stream of the calling thread, if any
+  static std::ostream*& getThreadLogStream() {
+    static thread_local std::ostream* os = nullptr;
+    return os;
+  }  // end of getThreadLogStream
+
   std::ostream& getLogStream() {
+    if (auto* const os = getThreadLogStream(); os != nullptr) {
+      return *os;
+    }
     auto& log = LogStream::getLogStream();
     return log.getStream();
   }  // end of function getLogStream
@@ -112,6 +121,19 @@ namespace mfront {
     log.setLogStream(os);
   }  // end of function setLogStream
 
+  void setThreadLogStream(std::ostream* const os) {
+    getThreadLogStream() = os;
+  }  // end of function setThreadLogStream
+
+  ThreadLogStreamGuard::ThreadLogStreamGuard(std::ostream& os)
+      : previous(getThreadLogStream()) {
+    getThreadLogStream() = &os;
+  }  // end of ThreadLogStreamGuard
+
+  ThreadLogStreamGuard::~ThreadLogStreamGuard() {
+    getThreadLogStream() = this->previous;
+  }  // end of ~ThreadLogStreamGuard
+
   namespace internals {
 
     static bool& getUnicodeOutputOption() {
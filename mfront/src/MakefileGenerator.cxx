@@ -12,6 +12,8 @@
  */
 
 #include <set>
+#include <string>
+#include <vector>
 #include <cstring>
 #include <ostream>
 #include <sstream>
@@ -51,6 +53,7 @@
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/TargetsDescription.hxx"
 #include "MFront/GeneratorOptions.hxx"
+#include "MFront/PrecompiledHeader.hxx"
 #include "MFront/MakefileGenerator.hxx"
 
 namespace mfront {
@@ -212,6 +215,10 @@ namespace mfront {
         }
       }
     }
+    const auto pch = (o.precompiledHeaders) && (!cppSources.empty());
+    if (pch) {
+      writePrecompiledHeader(d);
+    }
     m << "# Makefile generated by mfront.\n"
       << MFrontHeader::getHeader("# ") << "\n";
     m << "export LD_LIBRARY_PATH:=$(PWD):$(LD_LIBRARY_PATH)\n\n";
@@ -344,6 +351,9 @@ namespace mfront {
       }
       m << "\n\n";
     }
+    if (pch) {
+      m << "PCH = " << getPrecompiledHeaderName() << "\n\n";
+    }
     if (!cSources.empty()) {
       m << "SRC = ";
       auto p4 = cSources.begin();
@@ -506,6 +516,9 @@ namespace mfront {
     } else {
       m << "\t" << sb << "rm -f *.o *.so *.d *.d.*\n";
     }
+    if (pch) {
+      m << "\t" << sb << "rm -f $(PCH).gch\n";
+    }
     if (p5 != t.specific_targets.end()) {
       for (const auto& cmd : p5->second.cmds) {
         m << "\t" << sb << cmd << '\n';
@@ -516,7 +529,16 @@ namespace mfront {
       m << "-include $(makefiles)\n\n";
     }
     // generic rules for objects file generation
-    if (!cppSources.empty()) {
+    if (pch) {
+      // if the precompiled header can't be used, the compiler silently
+      // falls back to the header itself
+      m << "$(PCH).gch:$(PCH)\n";
+      m << "\t" << sb << cxx << " $(CXXFLAGS) -x c++-header $< -o $@\n\n";
+      m << "%.o:%.cxx $(PCH).gch\n";
+      m << "\t" << sb << cxx << " -include $(PCH) $(CXXFLAGS) $< -o $@ -c\n\n";
+      m << "%.o:%.cpp $(PCH).gch\n";
+      m << "\t" << sb << cxx << " -include $(PCH) $(CXXFLAGS) $< -o $@ -c\n\n";
+    } else if (!cppSources.empty()) {
       m << "%.o:%.cxx\n";
       m << "\t" << sb << cxx << " $(CXXFLAGS) $< -o $@ -c\n\n";
       m << "%.o:%.cpp\n";
@@ -555,11 +577,20 @@ namespace mfront {
 
   void callMake(const std::string& t,
                 const std::string& d,
-                const std::string& f) {
+                const std::string& f,
+                const unsigned short j) {
     const char* make = getMakeCommand();
-    const char* silent = getDebugMode() ? nullptr : "-s";
-    const char* const argv[] = {make,      "-C",      d.c_str(), "-f",
-                                f.c_str(), t.c_str(), silent,    nullptr};
+    const auto jobs = "-j" + std::to_string(j);
+    auto args = std::vector<const char*>{make,      "-C",      d.c_str(),
+                                         "-f",      f.c_str(), t.c_str()};
+    if (j != 0) {
+      args.push_back(jobs.c_str());
+    }
+    if (!getDebugMode()) {
+      args.push_back("-s");
+    }
+    args.push_back(nullptr);
+    const char* const* const argv = args.data();
     auto error = [&argv, &t](const std::string& e) {
       auto msg = "callMake: can't build target '" + t + "'\n";
       if (!e.empty()) {
@@ -14,6 +14,8 @@
 #include <cmath>
 #include <limits>
 #include <sstream>
+#include <algorithm>
+#include <functional>
 #include "TFEL/Raise.hxx"
 #include "MFront/BehaviourDescription.hxx"
 #include "MFront/NonLinearSystemSolverBase.hxx"
@@ -75,6 +77,17 @@ namespace mfront {
     return d.str();
   }  // end of NonLinearSystemSolverBase::getJacobianPart
 
+  bool NonLinearSystemSolverBase::usesForwardFiniteDifferences(
+      const BehaviourDescription& mb, const Hypothesis h) {
+    if (!mb.hasAttribute(
+            h, BehaviourData::numericalJacobianFiniteDifferenceScheme)) {
+      return false;
+    }
+    return mb.getAttribute<std::string>(
+               h, BehaviourData::numericalJacobianFiniteDifferenceScheme) ==
+           "Forward";
+  }  // end of usesForwardFiniteDifferences
+
   void NonLinearSystemSolverBase::writeEvaluateNumericallyComputedBlocks(
       std::ostream& out, const BehaviourDescription& mb, const Hypothesis h) {
     auto throw_if = [](const bool c, const std::string& m) {
@@ -127,24 +140,127 @@ namespace mfront {
     }();
     const auto& ivs = d.getIntegrationVariables();
     const auto n = ivs.getTypeSize();
+    const auto forward = usesForwardFiniteDifferences(mb, h);
+    // variables whose jacobian is block diagonal
+    const auto bvars = [&d] {
+      if (!d.hasAttribute(BehaviourData::blockDiagonalJacobianVariables)) {
+        return std::vector<std::string>{};
+      }
+      return d.getAttribute<std::vector<std::string>>(
+          BehaviourData::blockDiagonalJacobianVariables);
+    }();
+    auto is_block_variable = [&bvars](const std::string& v) {
+      return std::find(bvars.begin(), bvars.end(), v) != bvars.end();
+    };
+    // number of blocks
+    const auto nb = [&ivs, &bvars] {
+      auto r = std::numeric_limits<unsigned short>::max();
+      for (const auto& v : bvars) {
+        r = std::min(r, ivs.getVariable(v).arraySize);
+      }
+      return r;
+    }();
     out << "tfel::math::tmatrix<" << n << "," << n
         << ",real> tjacobian(this->jacobian);\n"
         << "tfel::math::tvector<" << n << ",real> tfzeros(this->fzeros);\n"
         << "tfel::math::tvector<" << n << ",real> zeros_safe(this->zeros);\n";
+    auto getPositionAndSize = [&ivs](const std::string& v)
+        -> std::pair<SupportedTypes::TypeSize, SupportedTypes::TypeSize> {
+      auto ns = SupportedTypes::TypeSize{};
+      for (const auto& iv : ivs) {
+        const auto s = SupportedTypes::getTypeSize(iv.type, iv.arraySize);
+        if (iv.name == v) {
+          return {ns, s};
+        }
+        ns += s;
+      }
+      tfel::raise("no integration variable named '" + v + "'");
+    };
+    // position of the variable and size of the part of the variable
+    // associated with one block
+    auto getPositionAndBlockSize = [&ivs, &nb, getPositionAndSize](
+                                       const std::string& v) {
+      const auto& iv = ivs.getVariable(v);
+      return std::make_pair(
+          getPositionAndSize(v).first,
+          SupportedTypes::getTypeSize(iv.type, iv.arraySize / nb));
+    };
+    // evaluation of the residual at the perturbated estimate. `perturb`
+    // writes the code incrementing the integration variables by the given
+    // value. On output, `fzeros` contains the columns of the jacobian.
+    auto compute_perturbation =
+        [&out, &d, &n,
+         forward](const std::function<void(const std::string&)>& perturb) {
+          if (forward) {
+            perturb("this->numerical_jacobian_epsilon");
+            if (d.hasCode(BehaviourData::ComputeThermodynamicForces)) {
+              out << "this->computeThermodynamicForces();\n";
+            }
+            out << "this->computeFdF(true);\n"
+                << "this->zeros  = zeros_safe;\n"
+                << "this->fzeros = "
+                   "(this->fzeros-tfzeros)/"
+                   "(this->numerical_jacobian_epsilon);\n";
+            return;
+          }
+          perturb("-(this->numerical_jacobian_epsilon)");
+          if (d.hasCode(BehaviourData::ComputeThermodynamicForces)) {
+            out << "this->computeThermodynamicForces();\n";
+          }
+          out << "this->computeFdF(true);\n"
+              << "this->zeros = zeros_safe;\n"
+              << "tfel::math::tvector<" << n
+              << ",real> tfzeros2(this->fzeros);\n";
+          perturb("this->numerical_jacobian_epsilon");
+          if (d.hasCode(BehaviourData::ComputeThermodynamicForces)) {
+            out << "this->computeThermodynamicForces();\n";
+          }
+          out << "this->computeFdF(true);\n"
+              << "this->zeros  = zeros_safe;\n"
+              << "this->fzeros = "
+                 "(this->fzeros-tfzeros2)/"
+                 "(2*(this->numerical_jacobian_epsilon));\n";
+        };
     bool first = true;
     for (const auto& b : blocs) {
-      auto getPositionAndSize = [&ivs](const std::string& v)
-          -> std::pair<SupportedTypes::TypeSize, SupportedTypes::TypeSize> {
-        auto ns = SupportedTypes::TypeSize{};
-        for (const auto& iv : ivs) {
-          const auto s = SupportedTypes::getTypeSize(iv.type, iv.arraySize);
-          if (iv.name == v) {
-            return {ns, s};
-          }
-          ns += s;
+      if (!first) {
+        out << "// restore residual values\n"
+            << "this->fzeros = tfzeros;\n";
+      }
+      first = false;
+      const auto colored =
+          is_block_variable(b.first) &&
+          std::all_of(b.second.begin(), b.second.end(), is_block_variable);
+      if (colored) {
+        // the residuals of a block only depend on the integration
+        // variables of this block: the same column of all the blocks is
+        // evaluated by a single perturbation
+        const auto pd = getPositionAndBlockSize(b.first);
+        out << "for(unsigned short idx = 0; idx!= " << pd.second
+            << ";++idx){\n";
+        compute_perturbation([&out, &pd, &nb](const std::string& e) {
+          out << "for(unsigned short idx3 = 0; idx3!= " << nb
+              << ";++idx3){\n"
+              << "this->zeros((" << pd.first << ") + idx3 * (" << pd.second
+              << ") + idx) += " << e << ";\n"
+              << "}\n";
+        });
+        out << "// update jacobian\n"
+            << "for(unsigned short idx3 = 0; idx3!= " << nb << ";++idx3){\n";
+        for (const auto& v : b.second) {
+          const auto pn = getPositionAndBlockSize(v);
+          const auto i = "(" + to_string(pn.first) + ") + idx3 * (" +
+                         to_string(pn.second) + ") + idx2";
+          out << "for(unsigned short idx2 = 0; idx2!= " << pn.second
+              << ";++idx2){\n"
+              << "tjacobian(" << i << ", (" << pd.first << ") + idx3 * ("
+              << pd.second << ") + idx) = this->fzeros[" << i << "];\n"
+              << "}\n";
         }
-        tfel::raise("no integration variable named '" + v + "'");
-      };
+        out << "}\n"
+            << "}\n";
+        continue;
+      }
       const auto pd = getPositionAndSize(b.first);
       auto update_jacobian = [&out, &b,
                               getPositionAndSize](const std::string& j) {
@@ -169,48 +285,28 @@ namespace mfront {
           }
         }
       };
-      auto compute_perturbation = [&out, &update_jacobian, &d,
-                                   &n](const std::string& j) {
-        out << "this->zeros(" << j
-            << ") -= this->numerical_jacobian_epsilon;\n";
-        if (d.hasCode(BehaviourData::ComputeThermodynamicForces)) {
-          out << "this->computeThermodynamicForces();\n";
-        }
-        out << "this->computeFdF(true);\n"
-            << "this->zeros = zeros_safe;\n"
-            << "tfel::math::tvector<" << n << ",real> tfzeros2(this->fzeros);\n"
-            << "this->zeros(" << j
-            << ") += this->numerical_jacobian_epsilon;\n";
-        if (d.hasCode(BehaviourData::ComputeThermodynamicForces)) {
-          out << "this->computeThermodynamicForces();\n";
-        }
-        out << "this->computeFdF(true);\n"
-            << "this->zeros  = zeros_safe;\n"
-            << "this->fzeros = "
-               "(this->fzeros-tfzeros2)/"
-               "(2*(this->numerical_jacobian_epsilon));\n"
-            << "// update jacobian\n";
+      auto compute_column = [&out, &update_jacobian,
+                             &compute_perturbation](const std::string& j) {
+        compute_perturbation([&out, &j](const std::string& e) {
+          out << "this->zeros(" << j << ") += " << e << ";\n";
+        });
+        out << "// update jacobian\n";
         update_jacobian(j);
       };
-      if (!first) {
-        out << "// restore residual values\n"
-            << "this->fzeros = tfzeros;\n";
-      }
       if (pd.second.isOne()) {
         out << "{\n";
-        compute_perturbation(to_string(pd.first));
+        compute_column(to_string(pd.first));
         out << "}\n";
       } else {
         out << "for(unsigned short idx = 0; idx!= " << pd.second
             << ";++idx){\n";
         if (!pd.first.isNull()) {
-          compute_perturbation(to_string(pd.first) + "+idx");
+          compute_column(to_string(pd.first) + "+idx");
         } else {
-          compute_perturbation("idx");
+          compute_column("idx");
         }
         out << "}\n";
       }
-      first = false;
     }
     out << "// update jacobian\n"
         << "this->jacobian = tjacobian;\n"
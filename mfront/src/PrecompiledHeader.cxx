@@ -0,0 +1,59 @@
+/*!
+ * \file   mfront/src/PrecompiledHeader.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <fstream>
+#include <iterator>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Config/GetTFELVersion.h"
+#include "TFEL/System/System.hxx"
+#include "MFront/PrecompiledHeader.hxx"
+
+namespace mfront {
+
+  const char* getPrecompiledHeaderName() {
+    return "mfront-pch.hxx";
+  }  // end of getPrecompiledHeaderName
+
+  void writePrecompiledHeader(const std::string& d) {
+    const auto f = d + tfel::system::dirStringSeparator() +
+                   getPrecompiledHeaderName();
+    // the version of TFEL is mentioned so that the precompiled header
+    // is rebuilt when TFEL is updated
+    const auto c = std::string{"/*!\n"
+                               " * \\file   "} +
+                   getPrecompiledHeaderName() +
+                   "\n"
+                   " * \\brief  header precompiled by the build files "
+                   "generated by mfront\n"
+                   " * \\note   TFEL version: " +
+                   ::getTFELVersion() +
+                   "\n"
+                   " */\n\n"
+                   "#include \"MFront/BehaviourPrecompiledHeader.hxx\"\n";
+    {
+      std::ifstream in{f};
+      if (in) {
+        const auto previous = std::string{std::istreambuf_iterator<char>(in),
+                                          std::istreambuf_iterator<char>()};
+        if (previous == c) {
+          return;
+        }
+      }
+    }
+    std::ofstream out{f};
+    tfel::raise_if(!out, "writePrecompiledHeader: can't open file '" + f + "'");
+    out.exceptions(std::ios::badbit | std::ios::failbit);
+    out << c;
+  }  // end of writePrecompiledHeader
+
+}  // end of namespace mfront
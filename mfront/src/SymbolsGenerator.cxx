@@ -12,6 +12,7 @@
  */
 
 #include <sstream>
+#include <algorithm>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetTFELVersion.h"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
@@ -30,6 +31,133 @@ namespace mfront {
     return bd.isTemperatureDefinedAsTheFirstExternalStateVariable();
   }  // end of shallRemoveTemperatureFromExternalStateVariables
 
+  /*!
+   * \return the number of material properties and the names of the
+   * material properties which are not imposed by the interface
+   * \param[in] i: behaviour interface
+   * \param[in] bd: behaviour description
+   * \param[in] h: modelling hypothesis
+   */
+  static std::pair<unsigned short, std::vector<std::string>>
+  getMaterialPropertiesNames(const BehaviourInterfaceBase& i,
+                             const BehaviourDescription& bd,
+                             const SymbolsGenerator::Hypothesis h) {
+    const auto mprops = i.buildMaterialPropertiesList(bd, h);
+    for (const auto& mp : mprops.first) {
+      if (SupportedTypes::getTypeFlag(mp.type) != SupportedTypes::SCALAR) {
+        tfel::raise(
+            "SymbolsGenerator::writeMaterialPropertiesSymbols: "
+            "internal error: the material properties shall all be scalars");
+      }
+    }
+    if (mprops.first.empty()) {
+      return {};
+    }
+    const auto& last = mprops.first.back();
+    SupportedTypes::TypeSize s;
+    s = last.offset;
+    s += SupportedTypes::getTypeSize(last.type, last.arraySize);
+    s -= mprops.second;
+    // index of the first element which is not imposed by the material
+    // properties
+    auto ib = std::vector<BehaviourMaterialProperty>::size_type{};
+    bool found = false;
+    for (decltype(mprops.first.size()) idx = 0;
+         (idx != mprops.first.size()) && (!found); ++idx) {
+      if (mprops.first[idx].offset == mprops.second) {
+        ib = idx;
+        found = true;
+      }
+    }
+    if (!found) {
+      return {};
+    }
+    auto mps = std::vector<std::string>{};
+    for (auto idx = ib; idx != mprops.first.size(); ++idx) {
+      const auto& m = mprops.first[idx];
+      if (m.arraySize == 1u) {
+        mps.push_back(m.getExternalName());
+      } else {
+        for (unsigned short j = 0; j != m.arraySize; ++j) {
+          mps.push_back(m.getExternalName() + '[' + std::to_string(j) + ']');
+        }
+      }
+    }
+    return {static_cast<unsigned short>(s.getValueForDimension(1)),
+            std::move(mps)};
+  }  // end of getMaterialPropertiesNames
+
+  /*!
+   * \return the type identifiers of a list of variables, arrays of
+   * variables being expanded
+   * \param[in] variables: variables
+   */
+  static std::vector<int> getVariablesTypes(
+      const VariableDescriptionContainer& variables) {
+    auto types = std::vector<int>{};
+    for (const auto& v : variables) {
+      types.insert(types.end(), v.arraySize, v.getVariableTypeIdentifier());
+    }
+    return types;
+  }  // end of getVariablesTypes
+
+  /*!
+   * \return the external state variables exported for the given
+   * modelling hypothesis
+   * \param[in] bd: behaviour description
+   * \param[in] h: modelling hypothesis
+   */
+  static VariableDescriptionContainer getExportedExternalStateVariables(
+      const BehaviourDescription& bd, const SymbolsGenerator::Hypothesis h) {
+    auto esvs = bd.getBehaviourData(h).getExternalStateVariables();
+    if (shallRemoveTemperatureFromExternalStateVariables(bd)) {
+      // removing the temperature
+      esvs.erase(esvs.begin());
+    }
+    return esvs;
+  }  // end of getExportedExternalStateVariables
+
+  /*!
+   * \return the parameters exported for the given modelling hypothesis
+   * \param[in] bd: behaviour description
+   * \param[in] h: modelling hypothesis
+   */
+  static VariableDescriptionContainer getExportedParameters(
+      const BehaviourDescription& bd, const SymbolsGenerator::Hypothesis h) {
+    if (areParametersTreatedAsStaticVariables(bd)) {
+      return {};
+    }
+    return bd.getBehaviourData(h).getParameters();
+  }  // end of getExportedParameters
+
+  //! \return the names of the given modelling hypotheses
+  static std::vector<std::string> getModellingHypothesesNames(
+      const std::set<SymbolsGenerator::Hypothesis>& mhs) {
+    auto hs = std::vector<std::string>{};
+    for (const auto h : mhs) {
+      hs.push_back(SymbolsGenerator::ModellingHypothesis::toString(h));
+    }
+    return hs;
+  }  // end of getModellingHypothesesNames
+
+  /*!
+   * \return the identifier of a symmetry type
+   * \param[in] st: symmetry type
+   * \param[in] m: calling method
+   */
+  static unsigned short getSymmetryTypeIdentifier(const BehaviourSymmetryType st,
+                                                  const char* const m) {
+    if (st == mfront::ISOTROPIC) {
+      return 0u;
+    } else if (st != mfront::ORTHOTROPIC) {
+      tfel::raise("SymbolsGenerator::" + std::string{m} +
+                  ": unsupported behaviour type.\n"
+                  "only isotropic or orthotropic behaviours "
+                  "are supported at this time.");
+    }
+    return 1u;
+  }  // end of getSymmetryTypeIdentifier
+
   std::string SymbolsGenerator::getSymbolName(const BehaviourInterfaceBase& i,
                                               const std::string& n,
                                               const Hypothesis h) const {
@@ -50,6 +178,7 @@ namespace mfront {
     this->writeBuildIdentifierSymbol(out, i, bd, name);
     this->writeEntryPointSymbol(out, i, name);
     this->writeTFELVersionSymbol(out, i, name);
+    this->writeReentrantSymbol(out, i, bd, name);
     this->writeUnitSystemSymbol(out, i, name, bd);
     this->writeMaterialSymbol(out, i, bd, name);
     this->writeMaterialKnowledgeTypeSymbol(out, i, name);
@@ -102,6 +231,19 @@ namespace mfront {
     mfront::writeTFELVersionSymbol(out, i.getFunctionNameBasis(n));
   }  // end of writeTFELVersionSymbol
 
+  void SymbolsGenerator::writeReentrantSymbol(std::ostream& out,
+                                              const BehaviourInterfaceBase& i,
+                                              const BehaviourDescription& bd,
+                                              const std::string& n) const {
+    exportUnsignedShortSymbol(out, i.getFunctionNameBasis(n) + "_reentrant",
+                              this->isReentrant(i, bd) ? 1u : 0u);
+  }  // end of writeReentrantSymbol
+
+  bool SymbolsGenerator::isReentrant(const BehaviourInterfaceBase&,
+                                     const BehaviourDescription& bd) const {
+    return isBehaviourReentrant(bd);
+  }  // end of isReentrant
+
   void SymbolsGenerator::writeUnitSystemSymbol(
       std::ostream& out,
       const BehaviourInterfaceBase& i,
@@ -381,13 +523,7 @@ namespace mfront {
     exportUnsignedShortSymbol(
         out, i.getFunctionNameBasis(name) + "_nModellingHypotheses",
         mhs.size());
-    const auto hypotheses = [&mhs] {
-      auto hs = std::vector<std::string>{};
-      std::for_each(mhs.begin(), mhs.end(), [&hs](const auto h) {
-        hs.push_back(ModellingHypothesis::toString(h));
-      });
-      return hs;
-    }();
+    const auto hypotheses = getModellingHypothesesNames(mhs);
     this->writeArrayOfStringsSymbol(
         out, i.getFunctionNameBasis(name) + "_ModellingHypotheses", hypotheses);
   }  // end of writeSupportedModellingHypothesis
@@ -398,61 +534,9 @@ namespace mfront {
       const BehaviourDescription& mb,
       const std::string& name,
       const Hypothesis h) const {
-    const auto mprops = i.buildMaterialPropertiesList(mb, h);
-    for (const auto& mp : mprops.first) {
-      if (SupportedTypes::getTypeFlag(mp.type) != SupportedTypes::SCALAR) {
-        tfel::raise(
-            "SymbolsGenerator::writeMaterialPropertiesSymbols: "
-            "internal error: the material properties shall all be scalars");
-      }
-    }
-    auto empty_case = [this, &out, &i, &name, h] {
-      exportUnsignedShortSymbol(
-          out, this->getSymbolName(i, name, h) + "_nMaterialProperties", 0u);
-      this->writeArrayOfStringsSymbol(
-          out, this->getSymbolName(i, name, h) + "_MaterialProperties", {});
-    };
-    if (mprops.first.empty()) {
-      empty_case();
-      return;
-    }
-    const auto& last = mprops.first.back();
-    SupportedTypes::TypeSize s;
-    s = last.offset;
-    s += SupportedTypes::getTypeSize(last.type, last.arraySize);
-    s -= mprops.second;
-    // index of the first element which is not imposed by the material
-    // properties
-    auto ib = std::vector<BehaviourMaterialProperty>::size_type{};
-    bool found = false;
-    for (decltype(mprops.first.size()) idx = 0;
-         (idx != mprops.first.size()) && (!found); ++idx) {
-      if (mprops.first[idx].offset == mprops.second) {
-        ib = idx;
-        found = true;
-      }
-    }
-    if (!found) {
-      empty_case();
-      return;
-    }
-    const auto mpnames = [&mprops, &ib] {
-      auto mps = std::vector<std::string>{};
-      for (auto idx = ib; idx != mprops.first.size(); ++idx) {
-        const auto& m = mprops.first[idx];
-        if (m.arraySize == 1u) {
-          mps.push_back(m.getExternalName());
-        } else {
-          for (unsigned short j = 0; j != m.arraySize; ++j) {
-            mps.push_back(m.getExternalName() + '[' + std::to_string(j) + ']');
-          }
-        }
-      }
-      return mps;
-    }();
+    const auto [nmps, mpnames] = getMaterialPropertiesNames(i, mb, h);
     exportUnsignedShortSymbol(
-        out, this->getSymbolName(i, name, h) + "_nMaterialProperties",
-        static_cast<unsigned short>(s.getValueForDimension(1)));
+        out, this->getSymbolName(i, name, h) + "_nMaterialProperties", nmps);
     this->writeArrayOfStringsSymbol(
         out, this->getSymbolName(i, name, h) + "_MaterialProperties", mpnames);
   }  // end of writeMaterialPropertiesSymbol
@@ -464,35 +548,10 @@ namespace mfront {
       const Hypothesis h,
       const VariableDescriptionContainer& variables,
       const std::string& variables_identifier) const {
-    if (!variables.empty()) {
-      const auto size = [&variables] {
-        auto s = std::size_t{};
-        for (const auto& p : variables) {
-          s += p.arraySize;
-        }
-        return s;
-      }();
-      out << "MFRONT_EXPORT_ARRAY_OF_SYMBOLS(int, "
-          << this->getSymbolName(i, name, h) << "_" << variables_identifier
-          << "Types, " << size << ", MFRONT_EXPORT_ARRAY_ARGUMENTS(";
-      for (auto p = variables.begin(); p != variables.end();) {
-        const auto t = p->getVariableTypeIdentifier();
-        for (unsigned short is = 0; is != p->arraySize;) {
-          out << t;
-          if (++is != p->arraySize) {
-            out << ",";
-          }
-        }
-        if (++p != variables.end()) {
-          out << ",";
-        }
-      }
-      out << "));\n\n";
-    } else {
-      out << "MFRONT_EXPORT_SYMBOL(const int *, "
-          << this->getSymbolName(i, name, h) << "_" << variables_identifier
-          << "Types, nullptr);\n\n";
-    }
+    this->writeArrayOfIntsSymbol(out,
+                                 this->getSymbolName(i, name, h) + "_" +
+                                     variables_identifier + "Types",
+                                 getVariablesTypes(variables));
   }  // end of writeVariablesTypesSymbol
 
   void SymbolsGenerator::writeStateVariablesSymbols(
@@ -522,12 +581,7 @@ namespace mfront {
       const BehaviourDescription& mb,
       const std::string& name,
       const Hypothesis h) const {
-    const auto& d = mb.getBehaviourData(h);
-    auto esvs = d.getExternalStateVariables();
-    if (shallRemoveTemperatureFromExternalStateVariables(mb)) {
-      // removing the temperature
-      esvs.erase(esvs.begin());
-    }
+    const auto esvs = getExportedExternalStateVariables(mb, h);
     out << "MFRONT_EXPORT_SYMBOL(unsigned short, "
         << this->getSymbolName(i, name, h) << "_nExternalStateVariables, "
         << esvs.getNumberOfVariables() << "u);\n";
@@ -556,14 +610,8 @@ namespace mfront {
                                                 const BehaviourDescription& mb,
                                                 const std::string& name,
                                                 const Hypothesis h) const {
-    if (!areParametersTreatedAsStaticVariables(mb)) {
-      mfront::writeParametersDeclarationSymbols(
-          out, this->getSymbolName(i, name, h),
-          mb.getBehaviourData(h).getParameters());
-    } else {
-      mfront::writeParametersDeclarationSymbols(
-          out, this->getSymbolName(i, name, h), {});
-    }
+    mfront::writeParametersDeclarationSymbols(
+        out, this->getSymbolName(i, name, h), getExportedParameters(mb, h));
   }  // end of writeParametersSymbols
 
   void SymbolsGenerator::writeParameterDefaultValueSymbols(
@@ -687,18 +735,8 @@ namespace mfront {
       const BehaviourInterfaceBase& i,
       const BehaviourDescription& mb,
       const std::string& name) const {
-    const auto st = [&mb]() -> unsigned short {
-      if (mb.getSymmetryType() == mfront::ISOTROPIC) {
-        return 0u;
-      } else if (mb.getSymmetryType() == mfront::ORTHOTROPIC) {
-        return 1u;
-      }
-      tfel::raise(
-          "SymbolsGenerator::writeSymmetryTypeSymbols: "
-          "unsupported behaviour type.\n"
-          "only isotropic or orthotropic behaviours "
-          "are supported at this time.");
-    }();
+    const auto st = getSymmetryTypeIdentifier(mb.getSymmetryType(),
+                                              "writeSymmetryTypeSymbols");
     exportUnsignedShortSymbol(
         out, i.getFunctionNameBasis(name) + "_SymmetryType", st);
   }  // end of writeSymmetryTypeSymbols
@@ -708,18 +746,8 @@ namespace mfront {
       const BehaviourInterfaceBase& i,
       const BehaviourDescription& mb,
       const std::string& name) const {
-    const auto est = [&mb]() -> unsigned short {
-      if (mb.getElasticSymmetryType() == mfront::ISOTROPIC) {
-        return 0u;
-      } else if (mb.getElasticSymmetryType() == mfront::ORTHOTROPIC) {
-        return 1u;
-      }
-      tfel::raise(
-          "SymbolsGenerator::writeElasticSymmetryTypeSymbols: "
-          "unsupported behaviour type.\n"
-          "only isotropic or orthotropic behaviours are "
-          "supported at this time.");
-    }();
+    const auto est = getSymmetryTypeIdentifier(
+        mb.getElasticSymmetryType(), "writeElasticSymmetryTypeSymbols");
     exportUnsignedShortSymbol(
         out, i.getFunctionNameBasis(name) + "_ElasticSymmetryType", est);
   }  // end of writeElasticSymmetryTypeSymbols
@@ -768,6 +796,119 @@ namespace mfront {
     mfront::exportArrayOfIntegersSymbol(os, s, v);
   }  // end of writeArrayOfIntsSymbol
 
+  void SymbolsGenerator::generateMetaDataSymbols(
+      std::ostream& out,
+      const BehaviourInterfaceBase& i,
+      const BehaviourDescription& bd,
+      const FileDescription&,
+      const std::set<Hypothesis>& mhs,
+      const std::string& name) const {
+    // the symbols shared by all the modelling hypotheses have the same
+    // prefix than the general symbols
+    auto md = MetaData{};
+    this->addGeneralMetaData(md, i, bd, mhs);
+    if (!bd.areAllMechanicalDataSpecialised(mhs)) {
+      this->addMetaData(md, i, bd, ModellingHypothesis::UNDEFINEDHYPOTHESIS);
+    }
+    this->writeMetaDataSymbol(out, i.getFunctionNameBasis(name), md);
+    for (const auto& h : mhs) {
+      if (bd.hasSpecialisedMechanicalData(h)) {
+        auto hmd = MetaData{};
+        this->addMetaData(hmd, i, bd, h);
+        this->writeMetaDataSymbol(out, this->getSymbolName(i, name, h), hmd);
+      }
+    }
+  }  // end of generateMetaDataSymbols
+
+  void SymbolsGenerator::addGeneralMetaData(
+      MetaData& md,
+      const BehaviourInterfaceBase& i,
+      const BehaviourDescription& bd,
+      const std::set<Hypothesis>& mhs) const {
+    auto as_string = [](const bool b) { return b ? "1" : "0"; };
+    md["reentrant"] = {as_string(this->isReentrant(i, bd))};
+    md["nModellingHypotheses"] = {std::to_string(mhs.size())};
+    md["ModellingHypotheses"] = getModellingHypothesesNames(mhs);
+    md["SymmetryType"] = {std::to_string(getSymmetryTypeIdentifier(
+        bd.getSymmetryType(), "addGeneralMetaData"))};
+    md["ElasticSymmetryType"] = {std::to_string(getSymmetryTypeIdentifier(
+        bd.getElasticSymmetryType(), "addGeneralMetaData"))};
+    md["TemperatureRemovedFromExternalStateVariables"] = {
+        as_string(shallRemoveTemperatureFromExternalStateVariables(bd))};
+  }  // end of addGeneralMetaData
+
+  void SymbolsGenerator::addMetaData(MetaData& md,
+                                     const BehaviourInterfaceBase& i,
+                                     const BehaviourDescription& bd,
+                                     const Hypothesis h) const {
+    auto as_string = [](const bool b) { return b ? "1" : "0"; };
+    auto as_strings = [](const std::vector<int>& values) {
+      auto r = std::vector<std::string>{};
+      for (const auto v : values) {
+        r.push_back(std::to_string(v));
+      }
+      return r;
+    };
+    const auto& d = bd.getBehaviourData(h);
+    md["UsableInPurelyImplicitResolution"] = {
+        as_string(d.isUsableInPurelyImplicitResolution())};
+    // material properties
+    auto [nmps, mpnames] = getMaterialPropertiesNames(i, bd, h);
+    md["nMaterialProperties"] = {std::to_string(nmps)};
+    md["MaterialProperties"] = std::move(mpnames);
+    // internal state variables
+    const auto& isvs = d.getPersistentVariables();
+    md["nInternalStateVariables"] = {
+        std::to_string(isvs.getNumberOfVariables())};
+    md["InternalStateVariables"] = bd.getExternalNames(h, isvs);
+    md["InternalStateVariablesTypes"] = as_strings(getVariablesTypes(isvs));
+    // external state variables
+    const auto esvs = getExportedExternalStateVariables(bd, h);
+    md["nExternalStateVariables"] = {
+        std::to_string(esvs.getNumberOfVariables())};
+    md["ExternalStateVariables"] = bd.getExternalNames(h, esvs);
+    md["ExternalStateVariablesTypes"] = as_strings(getVariablesTypes(esvs));
+    // parameters
+    const auto parameters = getExportedParameters(bd, h);
+    md["nParameters"] = {std::to_string(parameters.getNumberOfVariables())};
+    md["Parameters"] = parameters.getExternalNames();
+    md["ParametersTypes"] = as_strings(getParametersTypes(parameters));
+    // requirements and energies
+    md["requiresStiffnessTensor"] = {as_string(
+        bd.getAttribute(BehaviourDescription::requiresStiffnessTensor, false))};
+    md["requiresThermalExpansionCoefficientTensor"] = {
+        as_string(bd.getAttribute(
+            BehaviourDescription::requiresThermalExpansionCoefficientTensor,
+            false))};
+    md["ComputesInternalEnergy"] = {
+        as_string(bd.hasCode(h, BehaviourData::ComputeInternalEnergy))};
+    md["ComputesDissipatedEnergy"] = {
+        as_string(bd.hasCode(h, BehaviourData::ComputeDissipatedEnergy))};
+  }  // end of addMetaData
+
+  void SymbolsGenerator::writeMetaDataSymbol(std::ostream& out,
+                                             const std::string& p,
+                                             const MetaData& md) const {
+    // the format of the record is described in the
+    // `ExternalLibraryManager` class
+    auto check = [](const std::string& v) {
+      tfel::raise_if(v.find_first_of("\"\\\n") != std::string::npos,
+                     "SymbolsGenerator::writeMetaDataSymbol: "
+                     "invalid value '" +
+                         v + "'");
+      return v;
+    };
+    out << "MFRONT_EXPORT_SYMBOL(const char*, " << p << "_mfront_metadata,\n"
+        << "\"mfront_metadata 1\\n\"";
+    for (const auto& [n, values] : md) {
+      out << "\n\"" << n << ' ' << values.size() << "\\n\"";
+      for (const auto& v : values) {
+        out << "\n\"" << check(v) << "\\n\"";
+      }
+    }
+    out << ");\n\n";
+  }  // end of writeMetaDataSymbol
+
   SymbolsGenerator::~SymbolsGenerator() = default;
 
 }  // end of namespace mfront
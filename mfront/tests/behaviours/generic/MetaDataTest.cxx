@@ -0,0 +1,155 @@
+/*!
+ * \file   MetaDataTest.cxx
+ * \brief  This file checks that the metadata records exported by the
+ * `generic` interface are consistent with the individual symbols
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <sstream>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/getFunction.h"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+
+//! \brief path to the library containing the behaviours
+static std::string library;
+
+struct MetaDataTest final : public tfel::tests::TestCase {
+  MetaDataTest() : tfel::tests::TestCase("MFront", "MetaDataTest") {
+  }  // end of MetaDataTest
+
+  tfel::tests::TestResult execute() override {
+    for (const auto& b :
+         {"DSLOptionsTest", "ElasticityParametersAsStaticVariables",
+          "RungeKuttaElasticityParametersAsStaticVariables",
+          "ImplicitElasticityParametersAsStaticVariables",
+          "CallerOwnedParametersElasticity"}) {
+      this->check(b);
+    }
+    return this->result;
+  }  // end of execute()
+
+ private:
+  //! \brief values of the symbols described by a record
+  using MetaData = std::map<std::string, std::vector<std::string>>;
+  //! \brief check the records associated with the given behaviour
+  void check(const std::string& b) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    auto* const lib = elm.loadLibrary(library);
+    const auto md = this->read(lib, b);
+    TFEL_TESTS_ASSERT(!md.empty());
+    this->compare(lib, b, md);
+    // the variables are described by the record of the behaviour or by
+    // the records of the specialised modelling hypotheses
+    for (const auto& h : elm.getSupportedModellingHypotheses(library, b)) {
+      const auto hmd = this->read(lib, b + "_" + h);
+      if (hmd.empty()) {
+        TFEL_TESTS_ASSERT(md.count("MaterialProperties") == 1);
+        continue;
+      }
+      TFEL_TESTS_ASSERT(hmd.count("MaterialProperties") == 1);
+      this->compare(lib, b + "_" + h, hmd);
+    }
+  }  // end of check
+  //! \brief read the record associated with the given prefix, if any
+  MetaData read(const LibraryHandlerPtr lib,
+                const std::string& p) {
+    auto md = MetaData{};
+    const auto* const r =
+        ::tfel_getArrayOfStrings(lib, (p + "_mfront_metadata").c_str());
+    if (r == nullptr) {
+      return md;
+    }
+    auto in = std::istringstream{r[0]};
+    auto line = std::string{};
+    TFEL_TESTS_ASSERT(std::getline(in, line) && line == "mfront_metadata 1");
+    while (std::getline(in, line)) {
+      const auto pos = line.rfind(' ');
+      TFEL_TESTS_ASSERT(pos != std::string::npos);
+      auto values = std::vector<std::string>(std::stoul(line.substr(pos + 1)));
+      for (auto& v : values) {
+        TFEL_TESTS_ASSERT(static_cast<bool>(std::getline(in, v)));
+      }
+      md[line.substr(0, pos)] = std::move(values);
+    }
+    return md;
+  }  // end of read
+  //! \brief compare the values of a record to the individual symbols
+  void compare(const LibraryHandlerPtr lib,
+               const std::string& p,
+               const MetaData& md) {
+    auto ends_with = [](const std::string& s, const std::string& e) {
+      return (s.size() >= e.size()) &&
+             (s.compare(s.size() - e.size(), e.size(), e) == 0);
+    };
+    for (const auto& [n, values] : md) {
+      const auto s = p + "_" + n;
+      if (md.count("n" + n) == 1) {
+        // arrays, whose sizes are given by another symbol
+        TFEL_TESTS_ASSERT(std::to_string(values.size()) ==
+                          md.at("n" + n).front());
+      }
+      if ((ends_with(n, "Types")) || (n == "ModellingHypotheses") ||
+          (md.count("n" + n) == 1)) {
+        if (values.empty()) {
+          continue;
+        }
+        if (ends_with(n, "Types")) {
+          const auto* const v = ::tfel_getArrayOfInts(lib, s.c_str());
+          TFEL_TESTS_ASSERT(v != nullptr);
+          for (std::size_t i = 0; i != values.size(); ++i) {
+            TFEL_TESTS_ASSERT(std::to_string(v[i]) == values[i]);
+          }
+        } else {
+          const auto* const v = ::tfel_getArrayOfStrings(lib, s.c_str());
+          TFEL_TESTS_ASSERT(v != nullptr);
+          for (std::size_t i = 0; i != values.size(); ++i) {
+            TFEL_TESTS_ASSERT(std::string{v[i]} == values[i]);
+          }
+        }
+      } else {
+        // unsigned short integers
+        TFEL_TESTS_ASSERT(values.size() == 1u);
+        TFEL_TESTS_ASSERT(std::to_string(::tfel_getUnsignedShort(
+                              lib, s.c_str())) == values.front());
+      }
+    }
+  }  // end of compare
+};
+
+TFEL_TESTS_GENERATE_PROXY(MetaDataTest, "MetaDataTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  using namespace tfel::tests;
+  if (argc != 2) {
+    std::cerr << "MetaDataTest: invalid number of arguments\n"
+              << "usage: MetaDataTest library\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("MetaDataTest.xml");
+  const auto r = m.execute();
+  return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
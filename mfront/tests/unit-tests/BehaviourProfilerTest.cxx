@@ -0,0 +1,102 @@
+/*!
+ * \file   mfront/tests/unit-tests/BehaviourProfilerTest.cxx
+ * \brief  This file tests the `BehaviourProfiler` class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <thread>
+#include <vector>
+#include <numeric>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "MFront/BehaviourProfiler.hxx"
+
+struct BehaviourProfilerTest final : public tfel::tests::TestCase {
+  BehaviourProfilerTest()
+      : tfel::tests::TestCase("MFront", "BehaviourProfilerTest") {
+  }  // end of BehaviourProfilerTest
+
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute
+
+ private:
+  void test1() {
+    using mfront::BehaviourProfiler;
+    auto m = BehaviourProfiler::CodeBlockMeasures{};
+    for (const auto d : {0, 1, 3, 4, 1000}) {
+      m.add(d);
+    }
+    TFEL_TESTS_ASSERT(m.calls == 5);
+    TFEL_TESTS_ASSERT(m.total == 1008);
+    TFEL_TESTS_ASSERT(m.min == 0);
+    TFEL_TESTS_ASSERT(m.max == 1000);
+    TFEL_TESTS_ASSERT(m.histogram[0] == 1);
+    TFEL_TESTS_ASSERT(m.histogram[1] == 1);
+    TFEL_TESTS_ASSERT(m.histogram[2] == 1);
+    TFEL_TESTS_ASSERT(m.histogram[3] == 1);
+    TFEL_TESTS_ASSERT(m.histogram[10] == 1);
+    auto m2 = BehaviourProfiler::CodeBlockMeasures{};
+    m2.add(2);
+    m2.merge(m);
+    TFEL_TESTS_ASSERT(m2.calls == 6);
+    TFEL_TESTS_ASSERT(m2.total == 1010);
+    TFEL_TESTS_ASSERT(m2.min == 0);
+    TFEL_TESTS_ASSERT(m2.max == 1000);
+    TFEL_TESTS_ASSERT(m2.histogram[2] == 2);
+  }  // end of test1
+  void test2() {
+    using mfront::BehaviourProfiler;
+    constexpr auto nthreads = std::size_t{4};
+    constexpr auto ncalls = std::intmax_t{1000};
+    BehaviourProfiler p("BehaviourProfilerTest");
+    auto threads = std::vector<std::thread>{};
+    for (std::size_t i = 0; i != nthreads; ++i) {
+      threads.emplace_back([&p] {
+        for (std::intmax_t c = 0; c != ncalls; ++c) {
+          BehaviourProfiler::Timer t(p, BehaviourProfiler::INTEGRATOR);
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    const auto measures = p.getMeasures();
+    const auto& m = measures[BehaviourProfiler::INTEGRATOR];
+#if !(defined _WIN32 || defined _WIN64)
+    TFEL_TESTS_ASSERT(m.calls == ncalls * static_cast<std::intmax_t>(nthreads));
+    TFEL_TESTS_ASSERT(std::accumulate(m.histogram.begin(), m.histogram.end(),
+                                      std::intmax_t{0}) == m.calls);
+    TFEL_TESTS_ASSERT(m.min <= m.max);
+#endif
+    TFEL_TESTS_ASSERT(measures[BehaviourProfiler::FLOWRULE].calls == 0);
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(BehaviourProfilerTest, "BehaviourProfilerTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BehaviourProfilerTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
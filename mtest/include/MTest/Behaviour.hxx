@@ -14,6 +14,8 @@
 #ifndef LIB_MTEST_MTESTBEHAVIOUR_HXX
 #define LIB_MTEST_MTESTBEHAVIOUR_HXX
 
+#include <map>
+#include <span>
 #include <vector>
 #include <string>
 #include <memory>
@@ -294,6 +296,26 @@ namespace mtest {
      */
     virtual void setUnsignedIntegerParameter(const std::string&,
                                              const unsigned short) const = 0;
+    /*!
+     * \return if the behaviour can be used concurrently by many
+     * threads. By default, a behaviour is not considered thread-safe.
+     */
+    virtual bool isThreadSafe() const;
+    /*!
+     * \return if the values of the parameters can be given for each
+     * integration through the `parameters` member of the
+     * `BehaviourWorkSpace` structure, rather than being shared by all the
+     * instances of the behaviour. By default, this is not the case.
+     */
+    virtual bool allowsParametersBlock() const;
+    /*!
+     * \return a parameters block, i.e. the values of all the parameters
+     * in the order expected by the behaviour. The values of the parameters
+     * which are not given are the current ones.
+     * \param[in] values: values of some parameters
+     */
+    virtual std::vector<real> buildParametersBlock(
+        const std::map<std::string, real>&) const;
     /*!
      * \brief allocate workspace
      * \param[out] wk : behaviour workspace
@@ -355,6 +377,26 @@ namespace mtest {
         BehaviourWorkSpace&,
         const real,
         const StiffnessMatrixType) const = 0;
+    /*!
+     * \brief integrate the mechanical behaviour over the time step on a
+     * set of integration points
+     * \return a pair for each integration point. The first member is
+     * true if the integration was successfull, false otherwise. The
+     * second member contains a time step scaling factor.
+     * \param[out]    Kt    : tangent operators
+     * \param[out/in] s     : current states
+     * \param[out]    wk    : behaviour workspace
+     * \param[in]     dt    : time increment
+     * \param[in]     ktype : type of the stiffness matrix
+     * \note the default implementation calls the `integrate` method on
+     * each integration point.
+     */
+    virtual std::vector<std::pair<bool, real>> integrateBatch(
+        std::span<tfel::math::matrix<real>>,
+        std::span<CurrentState>,
+        BehaviourWorkSpace&,
+        const real,
+        const StiffnessMatrixType) const;
     //! \brief destructor
     virtual ~Behaviour();
   };  // end of struct Behaviour
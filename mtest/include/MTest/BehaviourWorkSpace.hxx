@@ -14,6 +14,7 @@
 #ifndef LIB_MTEST_BEHAVIOURWORKSPACE_HXX
 #define LIB_MTEST_BEHAVIOURWORKSPACE_HXX
 
+#include <vector>
 #include "TFEL/Math/matrix.hxx"
 #include "TFEL/Math/vector.hxx"
 
@@ -102,6 +103,22 @@ namespace mtest {
      * of the time step (for internal use by the behaviour)
      */
     tfel::math::vector<real> pk1;
+    /*!
+     * \brief values of all the parameters, if not empty (see the
+     * `Behaviour::allowsParametersBlock` method). Otherwise, the values
+     * shared by all the instances of the behaviour are used.
+     */
+    std::vector<real> parameters;
+    /*!
+     * \brief buffer storing the values of the integration points passed
+     * to the batched entry point of the behaviour, if any. This buffer is
+     * kept from one call to the other to avoid memory allocations, which
+     * are a source of contention when several threads integrate the
+     * behaviour, each thread having its own workspace.
+     */
+    std::vector<real> batch_values;
+    //! \brief buffer storing the status of the integration points
+    std::vector<int> batch_status;
   };  // end of struct BehaviourWorkSpace
 
 }  // end of namespace mtest
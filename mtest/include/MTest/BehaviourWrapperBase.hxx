@@ -64,6 +64,10 @@ namespace mtest {
     void setIntegerParameter(const std::string&, const int) const override;
     void setUnsignedIntegerParameter(const std::string&,
                                      const unsigned short) const override;
+    bool isThreadSafe() const override;
+    bool allowsParametersBlock() const override;
+    std::vector<real> buildParametersBlock(
+        const std::map<std::string, real>&) const override;
     //! \brief destructor
     ~BehaviourWrapperBase() override;
 
@@ -141,6 +141,12 @@ namespace mtest {
         const real,
         const real,
         const real) const = 0;
+    /*!
+     * \return true if the constraint uses the evolution of the given name
+     * \param[in] n: name of the evolution
+     * \note the default implementation returns false
+     */
+    virtual bool dependsOn(const std::string&) const;
     //! destructor
     virtual ~Constraint();
   };  // end of struct Constraint
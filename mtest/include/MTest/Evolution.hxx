@@ -15,7 +15,9 @@
 #define LIB_MTEST_MTESTEVOLUTION_HXX
 
 #include <map>
+#include <atomic>
 #include <vector>
+#include <string>
 #include <memory>
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
@@ -55,6 +57,20 @@ namespace mtest {
      * method does not makes sense for constant evolutions)
      */
     virtual void setValue(const real, const real) = 0;
+    /*!
+     * \brief evaluate the evolution at several times
+     * \param[out] r: values of the evolution
+     * \param[in] t: times
+     * \note the default implementation calls `operator()` for each time
+     */
+    virtual void evaluate(std::vector<real>&, const std::vector<real>&) const;
+    /*!
+     * \return true if the evolution is computed using the evolution of
+     * the given name
+     * \param[in] n: name of the evolution
+     * \note the default implementation returns false
+     */
+    virtual bool dependsOn(const std::string&) const;
     //! \brief destructor
     virtual ~Evolution();
   };
@@ -108,6 +124,68 @@ namespace mtest {
     std::map<real, real> values;
   };  // end of struct LPIEvolution
 
+  /*!
+   * \brief a linear per interval evolution stored in two contiguous
+   * arrays of sorted times and values.
+   *
+   * The interval found by the last evaluation is cached: evaluations at
+   * increasing times, which is the common case during a simulation,
+   * only compare the given time to the bounds of this interval and of
+   * the next one. A binary search is only performed when the cache
+   * misses. This evolution is meant for long loading histories, for
+   * which it is much faster and much more compact than `LPIEvolution`.
+   *
+   * The interpolation rules are the ones of `LPIEvolution`.
+   */
+  struct MTEST_VISIBILITY_EXPORT TabulatedEvolution final : public Evolution {
+    //! \brief a simple alias
+    using size_type = std::vector<real>::size_type;
+    /*!
+     * \brief constructor
+     * \param[in] t: times
+     * \param[in] v: values
+     * \note the times are sorted if required. If a time is given
+     * several times, only the first value is kept.
+     */
+    TabulatedEvolution(std::vector<real>, std::vector<real>);
+    TabulatedEvolution(TabulatedEvolution&&) = delete;
+    TabulatedEvolution(const TabulatedEvolution&) = delete;
+    TabulatedEvolution& operator=(TabulatedEvolution&&) = delete;
+    TabulatedEvolution& operator=(const TabulatedEvolution&) = delete;
+    //! \return the times
+    const std::vector<real>& getTimes() const noexcept;
+    //! \return the values
+    const std::vector<real>& getValues() const noexcept;
+    //
+    real operator()(const real) const override;
+    bool isConstant() const override;
+    void setValue(const real) override;
+    void setValue(const real, const real) override;
+    void evaluate(std::vector<real>&, const std::vector<real>&) const override;
+    //! \brief destructor
+    ~TabulatedEvolution() override;
+
+   private:
+    /*!
+     * \return the value of the evolution at the given time
+     * \param[in,out] i: index of the interval containing the time. The
+     * given value is used as an hint.
+     * \param[in] t: time
+     */
+    real interpolate(size_type&, const real) const;
+    //! \brief times
+    std::vector<real> times;
+    //! \brief values
+    std::vector<real> values;
+    /*!
+     * \brief index of the interval found by the last evaluation.
+     * \note this member is only an hint: it is accessed using relaxed
+     * atomic operations so that the evolution can be evaluated
+     * concurrently.
+     */
+    mutable std::atomic<size_type> cursor{0};
+  };  // end of struct TabulatedEvolution
+
   /*!
    * \brief build a constant evolution from a real value
    * \param[in] v: value
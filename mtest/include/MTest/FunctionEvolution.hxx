@@ -14,6 +14,7 @@
 #ifndef LIB_MTEST_MTESTFUNCTIONEVOLUTION_HXX
 #define LIB_MTEST_MTESTFUNCTIONEVOLUTION_HXX
 
+#include <mutex>
 #include "TFEL/Math/Evaluator.hxx"
 
 #include "MTest/Config.hxx"
@@ -33,6 +34,7 @@ namespace mtest {
     bool isConstant() const override;
     void setValue(const real) override;
     void setValue(const real, const real) override;
+    bool dependsOn(const std::string&) const override;
     //! \brief destructor
     ~FunctionEvolution() override;
 
@@ -41,6 +43,8 @@ namespace mtest {
     const EvolutionManager& evm;
     //! \brief Evaluator
     mutable tfel::math::Evaluator f;
+    //! \brief mutex protecting the evaluator
+    mutable std::mutex m;
   };
 
 }  // end of namespace mtest
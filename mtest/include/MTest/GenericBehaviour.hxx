@@ -14,6 +14,7 @@
 #ifndef LIB_MTEST_GENERICBEHAVIOUR_HXX
 #define LIB_MTEST_GENERICBEHAVIOUR_HXX
 
+#include <vector>
 #include "TFEL/System/ExternalFunctionsPrototypes.hxx"
 #include "MFront/GenericBehaviour/BehaviourData.hxx"
 #include "MTest/StandardBehaviourBase.hxx"
@@ -54,6 +55,32 @@ namespace mtest {
                                     BehaviourWorkSpace&,
                                     const real,
                                     const StiffnessMatrixType) const override;
+    /*!
+     * \brief integrate the mechanical behaviour over the time step on a
+     * set of integration points.
+     *
+     * The batched entry point generated by the `generic` interface is
+     * used if it is available and if the behaviour is neither
+     * orthotropic nor a finite strain behaviour. Otherwise, the
+     * behaviour is integrated on each integration point.
+     *
+     * \return a pair for each integration point. The first member is
+     * true if the integration was successfull, false otherwise. The
+     * second member contains a time step scaling factor.
+     * \param[out]    Kt:    tangent operators
+     * \param[in,out] s:     current states
+     * \param[out]    wk:    workspace
+     * \param[in]     dt:    time increment
+     * \param[in]     ktype: type of the stiffness matrix
+     */
+    std::vector<std::pair<bool, real>> integrateBatch(
+        std::span<tfel::math::matrix<real>>,
+        std::span<CurrentState>,
+        BehaviourWorkSpace&,
+        const real,
+        const StiffnessMatrixType) const override;
+    //! \return true if the batched entry point is available
+    virtual bool hasBatchFunction() const;
 
     std::vector<std::string> getOptionalMaterialProperties() const override;
     void setOptionalMaterialPropertiesDefaultValues(
@@ -66,6 +93,19 @@ namespace mtest {
         const tfel::math::tmatrix<3u, 3u, real>&) const override;
 
     void allocateWorkSpace(BehaviourWorkSpace&) const override;
+    void setParameter(const std::string&, const real) const override;
+    void setIntegerParameter(const std::string&, const int) const override;
+    void setUnsignedIntegerParameter(const std::string&,
+                                     const unsigned short) const override;
+    /*!
+     * \return true if the entry point taking the values of the
+     * parameters is available. This entry point is generated if the
+     * behaviour has been compiled with the `caller_owned_parameters` DSL
+     * option.
+     */
+    bool allowsParametersBlock() const override;
+    std::vector<real> buildParametersBlock(
+        const std::map<std::string, real>&) const override;
     //! destructor
     ~GenericBehaviour() override;
 
@@ -90,6 +130,15 @@ namespace mtest {
                                                  const StiffnessMatrixType,
                                                  const bool) const;
 
+    /*!
+     * \brief convert the tangent operator returned by the behaviour to
+     * the stiffness matrix used by `MTest`
+     * \param[out] Kt: stiffness matrix
+     * \param[in]  D: tangent operator returned by the behaviour
+     */
+    virtual void convertTangentOperator(tfel::math::matrix<real>&,
+                                        const tfel::math::matrix<real>&) const;
+
     virtual void executeFiniteStrainBehaviourStressPreProcessing(
         BehaviourWorkSpace&, mfront::gb::BehaviourData&) const;
 
@@ -102,8 +151,30 @@ namespace mtest {
     virtual void executeFiniteStrainBehaviourTangentOperatorPostProcessing(
         mfront::gb::BehaviourData&) const;
 
+    /*!
+     * \brief update the current value of a parameter in a parameters
+     * block, if the entry point taking the values of the parameters is
+     * available. In this case, the values of the parameters shared by
+     * all the instances of the behaviour are left unchanged.
+     * \return true if the parameter belongs to the parameters block
+     * \param[in] n: name of the parameter
+     * \param[in] v: value
+     */
+    bool updateParametersBlockValue(const std::string&, const real) const;
     //! \brief pointer to the function
     tfel::system::GenericBehaviourFctPtr fct;
+    //! \brief pointer to the batched entry point, if available
+    tfel::system::GenericBehaviourBatchFctPtr batch_fct = nullptr;
+    //! \brief pointer to the entry point taking the values of the parameters
+    tfel::system::GenericBehaviourWithParametersFctPtr
+        fct_with_parameters = nullptr;
+    //! \brief names of all the parameters, in the order of a parameters block
+    std::vector<std::string> parameters_block_names;
+    /*!
+     * \brief current values of all the parameters, in the order of a
+     * parameters block
+     */
+    mutable std::vector<real> parameters_block_values;
     /*!
      * \brief pointer to the function in charge of rotating the gradients from
      * the global frame to the material frame
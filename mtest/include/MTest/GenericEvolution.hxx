@@ -17,6 +17,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <mutex>
 #include <memory>
 #include "MFront/GenericMaterialProperty/MaterialProperty.h"
 #include "MTest/Config.hxx"
@@ -41,6 +42,7 @@ namespace mtest {
     bool isConstant() const override;
     void setValue(const real) override;
     void setValue(const real, const real) override;
+    bool dependsOn(const std::string&) const override;
     //! \brief destructor
     ~GenericEvolution() override;
 
@@ -53,6 +55,8 @@ namespace mtest {
     std::vector<std::string> vnames;
     //! \brief arguments send to the generic function
     mutable std::vector<real> args;
+    //! \brief mutex protecting the arguments
+    mutable std::mutex m;
   };
 
 }  // end of namespace mtest
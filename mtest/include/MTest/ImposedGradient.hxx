@@ -111,6 +111,7 @@ namespace mtest {
                                             const real,
                                             const real,
                                             const real) const override;
+    bool dependsOn(const std::string&) const override;
     //! destructor
     ~ImposedGradient() override;
 
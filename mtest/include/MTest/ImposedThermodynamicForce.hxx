@@ -113,6 +113,7 @@ namespace mtest {
                                             const real,
                                             const real,
                                             const real) const override;
+    bool dependsOn(const std::string&) const override;
     //! destructor
     ~ImposedThermodynamicForce() override;
 
@@ -69,6 +69,37 @@ namespace mtest {
       //! desctructor
       virtual ~UTest();
     };
+    /*!
+     * \brief results of a parametric sweep.
+     *
+     * The outputs are the components of the gradients, the components
+     * of the thermodynamic forces, the internal state variables and
+     * the stored and dissipated energies, evaluated at the times
+     * defined by the user.
+     */
+    struct MTEST_VISIBILITY_EXPORT SweepResults {
+      /*!
+       * \return the values of the given output
+       * \param[in] n: name of the output
+       */
+      const std::vector<real>& getOutput(const std::string&) const;
+      //! \brief times at which the outputs are evaluated
+      std::vector<real> times;
+      //! \brief names of the outputs
+      std::vector<std::string> names;
+      /*!
+       * \brief values of the outputs. The value of the `i`-th output
+       * for the `j`-th variant at the `k`-th time is stored in
+       * `values[i][j * times.size() + k]`. The values following a
+       * failure of the computation are set to `NaN`.
+       */
+      std::vector<std::vector<real>> values;
+      /*!
+       * \brief error message associated with each variant. This
+       * message is empty if the computation succeeded.
+       */
+      std::vector<std::string> errors;
+    };
     /*!
      * default constructor
      */
@@ -113,6 +144,9 @@ namespace mtest {
                                                 const real,
                                                 const real) const override;
     void makeLinearPrediction(StudyCurrentState&, const real) const override;
+    // skyline and sparse storages of the stiffness matrix are not supported
+    using SingleStructureScheme::computePredictionStiffnessAndResidual;
+    using SingleStructureScheme::computeStiffnessMatrixAndResidual;
     [[nodiscard]] std::pair<bool, real> computePredictionStiffnessAndResidual(
         StudyCurrentState&,
         tfel::math::matrix<real>&,
@@ -163,6 +197,38 @@ namespace mtest {
                          SolverWorkSpace&,
                          const real,
                          const real);
+    /*!
+     * \brief treat variants of the test sharing the same initialisation
+     *
+     * Each variant is defined by the values of some material
+     * properties, external state variables or real parameters of the
+     * behaviour. Material properties and external state variables are
+     * replaced by constant evolutions.
+     *
+     * The variants are spread over a pool of threads if the behaviour
+     * is thread-safe, if no real parameter is modified and if no
+     * acceleration algorithm is used. Otherwise, the variants are
+     * treated sequentially.
+     *
+     * The tests, the user defined post-processings and the output
+     * files are not considered when treating the variants.
+     *
+     * \param[in] v: values of the variables defining each variant
+     * \param[in] n: number of threads
+     */
+    virtual SweepResults sweep(const std::map<std::string, std::vector<real>>&,
+                               const std::size_t = 1);
+    /*!
+     * \brief define variants to be treated after the nominal
+     * computation by the `execute` method.
+     * \param[in] v: values of the variables defining each variant
+     * \param[in] n: number of threads
+     * \param[in] f: file where the results are written. If empty, the
+     * results are not written.
+     */
+    virtual void setSweep(const std::map<std::string, std::vector<real>>&,
+                          const std::size_t,
+                          const std::string&);
     /*!
      * \brief ask the comparison to the numerical tangent operator
      * \param[in] bo : boolean
@@ -281,8 +347,26 @@ namespace mtest {
     real pv = -1;
     //! compare to numerical jacobian
     bool cto = false;
+    //! \brief variants treated by the `execute` method
+    std::map<std::string, std::vector<real>> sweep_values;
+    //! \brief number of threads used to treat the variants
+    std::size_t sweep_number_of_threads = 1;
+    //! \brief file where the results of the variants are written
+    std::string sweep_output_file;
   };  // end of struct MTest
 
+  /*!
+   * \brief write the results of a parametric sweep in a text file. Each
+   * line contains the index of the variant, the time and the values of
+   * the outputs.
+   * \param[in] f: file name
+   * \param[in] r: results
+   * \param[in] p: precision. If negative, the default precision is used.
+   */
+  MTEST_VISIBILITY_EXPORT void writeSweepResults(const std::string&,
+                                                 const MTest::SweepResults&,
+                                                 const int = -1);
+
 }  // end of namespace mtest
 
 #endif /* LIB_MTEST_MTEST_HXX */
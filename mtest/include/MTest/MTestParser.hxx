@@ -261,6 +261,12 @@ namespace mtest {
      * \param[in,out] p: position in the input file
      */
     virtual void handleUserDefinedPostProcessing(MTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@Sweep` keyword
+     * \param[in,out] t: `MTest` object to be configured
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleSweep(MTest&, tokens_iterator&);
     /*!
      * \brief read the options associated with a constraint
      * \param[in] m: calling method
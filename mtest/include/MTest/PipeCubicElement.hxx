@@ -15,9 +15,11 @@
 #define LIB_MTEST_PIPECUBICELEMENT_HXX
 
 #include <iosfwd>
+#include <vector>
 
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/tmatrix.hxx"
 #include "TFEL/Math/General/ConstExprMathFunctions.hxx"
 #include "MTest/Types.hxx"
 #include "MTest/SolverOptions.hxx"
@@ -29,6 +31,8 @@ namespace mtest {
   struct Behaviour;
   // forward declaration
   struct StructureCurrentState;
+  // forward declaration
+  struct BehaviourWorkSpace;
 
   /*!
    * \brief structure describing a cubic element for pipes
@@ -81,6 +85,13 @@ namespace mtest {
                               const size_t,
                               const bool);
     /*!
+     * \brief compute the strain at the end of the time step and
+     * integrate the behaviour at each Gauss point of an element.
+     *
+     * The stiffness matrix and the residual are not modified, so that
+     * distinct elements can be treated concurrently provided that
+     * distinct behaviour workspaces are used.
+     *
      * \return a pair containing:
      * - a boolean syaing if the behaviour integration shall be
      *   performed
@@ -88,26 +99,48 @@ namespace mtest {
      *     - increase the time step if the integration was successfull
      *     - decrease the time step if the integration failed or if the
      *       results were not reliable (time step too large).
-     * \param[out] k:   stiffness matrix
-     * \param[out] r:   residual
      * \param[out] scs: structure current state
+     * \param[out] K:   tangent operators at each integration point
+     * \param[out] bwk: behaviour workspace
+     * \param[in]  b:   behaviour
      * \param[in]  u1:  current displacement estimation
      * \param[in]  m:   pipe mesh
-     * \param[in]  b:   behaviour
      * \param[in]  dt:  time increment
      * \param[in]  mt:  stiffness matrix type
      * \param[in]  i:   element number
      */
-    static std::pair<bool, real> updateStiffnessMatrixAndInnerForces(
-        tfel::math::matrix<real>&,
-        tfel::math::vector<real>&,
+    static std::pair<bool, real> integrate(
         StructureCurrentState&,
+        std::vector<tfel::math::tmatrix<3u, 3u, real>>&,
+        BehaviourWorkSpace&,
         const Behaviour&,
         const tfel::math::vector<real>&,
         const PipeMesh&,
         const real,
         const StiffnessMatrixType,
         const size_t);
+    /*!
+     * \brief add the contribution of an element to the stiffness
+     * matrix and the residual, using the stresses and the tangent
+     * operators computed by the `integrate` method.
+     * \param[out] k:   stiffness matrix. The stiffness matrix may be
+     * either a dense matrix or a matrix stored in skyline format.
+     * \param[out] r:   residual
+     * \param[in]  scs: structure current state
+     * \param[in]  K:   tangent operators at each integration point
+     * \param[in]  m:   pipe mesh
+     * \param[in]  mt:  stiffness matrix type
+     * \param[in]  i:   element number
+     */
+    template <typename StiffnessMatrix>
+    static void updateStiffnessMatrixAndInnerForces(
+        StiffnessMatrix&,
+        tfel::math::vector<real>&,
+        const StructureCurrentState&,
+        const std::vector<tfel::math::tmatrix<3u, 3u, real>>&,
+        const PipeMesh&,
+        const StiffnessMatrixType,
+        const size_t);
 
    private:
     static constexpr real one_third = real{1} / real{3};
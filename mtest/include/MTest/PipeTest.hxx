@@ -16,12 +16,15 @@
 
 #include <string>
 #include <vector>
+#include <memory>
 #include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
 #include "TFEL/Material/ModellingHypothesis.hxx"
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
 #include "MTest/PipeProfileHandler.hxx"
 #include "MTest/PipeMesh.hxx"
+#include "MTest/SolverWorkSpace.hxx"
 #include "MTest/SingleStructureScheme.hxx"
 
 namespace tfel::utilities {
@@ -29,6 +32,11 @@ namespace tfel::utilities {
   struct TextData;
 }  // namespace tfel::utilities
 
+namespace tfel::system {
+  // forward declaration
+  struct ThreadPool;
+}  // namespace tfel::system
+
 namespace mtest {
 
   // forward declarations
@@ -154,6 +162,33 @@ namespace mtest {
      * \param[in] e: element type
      */
     virtual void setElementType(const PipeMesh::ElementType);
+    /*!
+     * \brief set how the global stiffness matrix is stored. By
+     * default, the stiffness matrix is stored in skyline format, which
+     * exploits its banded structure: the cost of the LU decomposition
+     * is then proportional to the number of nodes rather than to its
+     * cube. The dense storage is kept as a fallback. The sparse
+     * storage solves the linear system with a preconditioned iterative
+     * solver and does not store the fill-in of the factorisation.
+     * \param[in] s: storage of the stiffness matrix
+     */
+    virtual void setStiffnessMatrixStorage(
+        const SolverWorkSpace::StiffnessMatrixStorage);
+    /*!
+     * \brief set the number of threads used to integrate the behaviour
+     * at the Gauss points. By default, the integration is sequential.
+     *
+     * If more than one thread is used, the elements are split in
+     * contiguous ranges which are treated concurrently, each thread
+     * using its own behaviour workspace. The stiffness matrix and the
+     * residual are then assembled sequentially, in the order of the
+     * elements, so that the results do not depend on the number of
+     * threads.
+     *
+     * \note the behaviour must be thread-safe.
+     * \param[in] n: number of threads
+     */
+    virtual void setNumberOfThreads(const size_type);
     /*!
      * \brief set the pipe axial loading
      * \param[in] al: axial loading
@@ -259,6 +294,34 @@ namespace mtest {
         const real,
         const real,
         const StiffnessMatrixType) const override;
+    [[nodiscard]] std::pair<bool, real> computePredictionStiffnessAndResidual(
+        StudyCurrentState&,
+        tfel::math::SkylineMatrix<real>&,
+        tfel::math::vector<real>&,
+        const real&,
+        const real&,
+        const StiffnessMatrixType) const override;
+    [[nodiscard]] std::pair<bool, real> computeStiffnessMatrixAndResidual(
+        StudyCurrentState&,
+        tfel::math::SkylineMatrix<real>&,
+        tfel::math::vector<real>&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const override;
+    [[nodiscard]] std::pair<bool, real> computePredictionStiffnessAndResidual(
+        StudyCurrentState&,
+        tfel::math::CSRMatrix<real>&,
+        tfel::math::vector<real>&,
+        const real&,
+        const real&,
+        const StiffnessMatrixType) const override;
+    [[nodiscard]] std::pair<bool, real> computeStiffnessMatrixAndResidual(
+        StudyCurrentState&,
+        tfel::math::CSRMatrix<real>&,
+        tfel::math::vector<real>&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const override;
     [[nodiscard]] real getErrorNorm(
         const tfel::math::vector<real>&) const override;
     [[nodiscard]] bool checkConvergence(StudyCurrentState&,
@@ -305,6 +368,8 @@ namespace mtest {
     void printOutput(const real,
                      const StudyCurrentState&,
                      const bool) const override;
+    //! \return the names of the columns of the output file
+    virtual std::vector<std::string> getOutputFileColumns() const;
     /*!
      * \brief compute the minium and maximum values of a scalar
      * variable
@@ -490,12 +555,31 @@ namespace mtest {
      */
     void setGaussPointPositionForEvolutionsEvaluation(
         const CurrentState&) const override;
+    /*!
+     * \brief compute the stiffness matrix and the residual
+     * \param[out] s: current structure state
+     * \param[out] K:   tangent operator
+     * \param[out] r:   residual
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  smt: type of tangent operator
+     */
+    template <typename StiffnessMatrix>
+    std::pair<bool, real> assembleStiffnessMatrixAndResidual(
+        StudyCurrentState&,
+        StiffnessMatrix&,
+        tfel::math::vector<real>&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const;
     //! \brief description of an additional
     struct AdditionalOutput {
       //! \brief description
       std::string d;
+      //! \brief name of the column in the output file
+      std::string n;
       //! \brief functor
-      std::function<void(std::ostream&, const StudyCurrentState&)> f;
+      std::function<real(const StudyCurrentState&)> f;
     };
     //! \brief additional outputs
     std::vector<AdditionalOutput> aoutputs;
@@ -543,6 +627,20 @@ namespace mtest {
     AxialLoading al = DEFAULTAXIALLOADING;
     //! \brief failure policy
     FailurePolicy failure_policy = REPORTONLY;
+    //! \brief storage of the stiffness matrix
+    SolverWorkSpace::StiffnessMatrixStorage kstorage =
+        SolverWorkSpace::SKYLINESTORAGE;
+    //! \brief number of threads used to integrate the behaviour
+    size_type number_of_threads = 1;
+    //! \brief thread pool used to integrate the behaviour
+    std::unique_ptr<tfel::system::ThreadPool> pool;
+    //! \brief tangent operators at the Gauss points
+    mutable std::vector<tfel::math::tmatrix<3u, 3u, real>> tangent_operators;
+    /*!
+     * \brief tangent operators returned by the behaviour at the Gauss
+     * points (see `Behaviour::integrateBatch`)
+     */
+    mutable std::vector<tfel::math::matrix<real>> behaviour_tangent_operators;
     //! \brief element type
     //! \brief small strain hypothesis
     bool hpp = false;
@@ -101,6 +101,18 @@ namespace mtest {
      * \param[in,out] p: position in the input file
      */
     virtual void handleElementType(PipeTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@StiffnessMatrixStorage` keyword
+     * \param[out]    t: test
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleStiffnessMatrixStorage(PipeTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@NumberOfThreads` keyword
+     * \param[out]    t: test
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleNumberOfThreads(PipeTest&, tokens_iterator&);
     /*!
      * \brief handle the `@PerformSmallStrainAnalysis` keyword
      * \param[out]    t: test
@@ -21,6 +21,7 @@
 
 #include "TFEL/Material/ModellingHypothesis.hxx"
 #include "TFEL/Material/MechanicalBehaviour.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
 
 #include "MTest/Types.hxx"
 #include "MTest/Config.hxx"
@@ -39,6 +40,13 @@ namespace mtest {
       USERDEFINEDTIMES,
       EVERYPERIOD
     };  // end of enum OutputFrequency
+    //! \brief format of the output file
+    enum OutputFileFormat {
+      //! \brief text file, one line per output time
+      TEXTFORMAT,
+      //! \brief binary file following the `npy` format of `numpy`
+      BINARYFORMAT
+    };  // end of enum OutputFileFormat
     //! a simple alias
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
     //! a simple alias
@@ -80,6 +88,11 @@ namespace mtest {
      * \param[in] p : precision
      */
     virtual void setOutputFilePrecision(const unsigned int);
+    /*!
+     * \brief set the format of the output file
+     * \param[in] f: format
+     */
+    virtual void setOutputFileFormat(const OutputFileFormat);
     /*!
      * \brief set the residual file
      * \param[in] f : file name
@@ -126,7 +139,8 @@ namespace mtest {
      * \param[in] t  : time
      * \param[in] v  : value
      *
-     * \note the evolution *must* be of type LPIEvolution
+     * \note the evolution *must* be of type `LPIEvolution` or
+     * `TabulatedEvolution`
      */
     virtual void setEvolutionValue(const std::string&, const real, const real);
     /*!
@@ -249,6 +263,16 @@ namespace mtest {
      * \param[in] v : variable names
      */
     void declareVariables(const std::vector<std::string>&, const bool);
+    /*!
+     * \brief set the names of the columns of the output file. In binary
+     * format, the output file is opened.
+     * \param[in] c: names of the columns
+     * \note this method must be called by the derived class once the
+     * output file has been reset.
+     */
+    void setOutputFileColumns(const std::vector<std::string>&);
+    //! \brief flush the output file
+    void flushOutputFile() const;
     //! declared variable names
     std::vector<std::string> vnames;
     //! initilisation stage
@@ -272,6 +296,12 @@ namespace mtest {
     std::string output;
     //! output file
     mutable std::ofstream out;
+    //! \brief output file in binary format
+    mutable std::unique_ptr<tfel::utilities::BinaryDataWriter> bout;
+    //! \brief names of the columns of the output file
+    std::vector<std::string> output_columns;
+    //! \brief format of the output file
+    OutputFileFormat output_format = TEXTFORMAT;
     //! residual file name
     std::string residualFileName;
     //! xml file name
@@ -17,6 +17,9 @@
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Math/matrix.hxx"
 #include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/SkylineMatrix.hxx"
+#include "TFEL/Math/CSRMatrix.hxx"
+#include "TFEL/Math/GMRESSolve.hxx"
 
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
@@ -29,8 +32,28 @@ namespace mtest {
   struct SolverWorkSpace {
     //! a simple alias
     using size_type = tfel::math::matrix<real>::size_type;
+    //! \brief storage of the stiffness matrix
+    enum StiffnessMatrixStorage {
+      //! \brief the stiffness matrix is stored in `K`
+      DENSESTORAGE,
+      //! \brief the stiffness matrix is stored in `sK`
+      SKYLINESTORAGE,
+      /*!
+       * \brief the stiffness matrix is stored in `csK` and the linear
+       * system is solved iteratively
+       */
+      SPARSESTORAGE
+    };
+    //! \brief storage of the stiffness matrix
+    StiffnessMatrixStorage storage = DENSESTORAGE;
     //! stiffness matrix
     tfel::math::matrix<real> K;
+    //! stiffness matrix stored in skyline format
+    tfel::math::SkylineMatrix<real> sK;
+    //! stiffness matrix stored in compressed sparse row format
+    tfel::math::CSRMatrix<real> csK;
+    //! preconditioner associated with `csK`
+    tfel::math::ILU0Preconditioner<real> ilu;
     // residual
     tfel::math::vector<real> r;
     // unknowns correction
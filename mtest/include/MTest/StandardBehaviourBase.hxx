@@ -122,6 +122,7 @@ namespace mtest {
     void setIntegerParameter(const std::string&, const int) const override;
     void setUnsignedIntegerParameter(const std::string&,
                                      const unsigned short) const override;
+    bool isThreadSafe() const override;
     std::vector<std::string> getOptionalMaterialProperties() const override;
     void setOptionalMaterialPropertiesDefaultValues(
         EvolutionManager&, const EvolutionManager&) const override;
@@ -56,7 +56,8 @@ namespace mtest {
      * \brief make a deep copy of the object
      * Contrary to standard copy which shares pointers to the current
      * states of each models with the original object,
-     * those states are duplicated in a deep copy.
+     * those states are duplicated in a deep copy. The workspaces are
+     * not copied.
      */
     StructureCurrentState makeDeepCopy() const;
     /*!
@@ -71,6 +72,14 @@ namespace mtest {
     void setModellingHypothesis(const Hypothesis);
     //! \return the behaviour workspace associated to the current thread.
     BehaviourWorkSpace &getBehaviourWorkSpace() const;
+    /*!
+     * \return the i-th behaviour workspace. Workspaces are allocated
+     * on demand, so this method must not be called concurrently.
+     * However, distinct workspaces can be used concurrently by
+     * distinct threads.
+     * \param[in] i: index of the workspace
+     */
+    BehaviourWorkSpace &getBehaviourWorkSpace(const std::size_t) const;
     //! \return the behaviour associated to the structure
     const Behaviour &getBehaviour() const;
     /*!
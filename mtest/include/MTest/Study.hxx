@@ -18,6 +18,8 @@
 
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/SkylineMatrix.hxx"
+#include "TFEL/Math/CSRMatrix.hxx"
 #include "TFEL/Material/ModellingHypothesis.hxx"
 
 #include "MTest/Config.hxx"
@@ -102,6 +104,46 @@ namespace mtest {
                                           const real&,
                                           const real&,
                                           const StiffnessMatrixType) const = 0;
+    /*!
+     * \brief compute the prediction stiffness matrix, stored in skyline
+     * format, and the residual. This method is only called if the
+     * `initializeWorkSpace` method selected the skyline storage of the
+     * stiffness matrix.
+     * \param[out] s: current structure state
+     * \param[out] K:   tangent operator
+     * \param[out] r:   residual
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  smt: type of tangent operator
+     * \note the default implementation throws an exception
+     */
+    [[nodiscard]] virtual std::pair<bool, real>
+    computePredictionStiffnessAndResidual(StudyCurrentState&,
+                                          tfel::math::SkylineMatrix<real>&,
+                                          tfel::math::vector<real>&,
+                                          const real&,
+                                          const real&,
+                                          const StiffnessMatrixType) const;
+    /*!
+     * \brief compute the prediction stiffness matrix, stored in
+     * compressed sparse row format, and the residual. This method is
+     * only called if the `initializeWorkSpace` method selected the
+     * sparse storage of the stiffness matrix.
+     * \param[out] s: current structure state
+     * \param[out] K:   tangent operator
+     * \param[out] r:   residual
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  smt: type of tangent operator
+     * \note the default implementation throws an exception
+     */
+    [[nodiscard]] virtual std::pair<bool, real>
+    computePredictionStiffnessAndResidual(StudyCurrentState&,
+                                          tfel::math::CSRMatrix<real>&,
+                                          tfel::math::vector<real>&,
+                                          const real&,
+                                          const real&,
+                                          const StiffnessMatrixType) const;
     /*!
      * \brief compute the stiffness matrix and the residual
      * \return a pair containing:
@@ -126,6 +168,52 @@ namespace mtest {
                                       const real,
                                       const real,
                                       const StiffnessMatrixType) const = 0;
+    /*!
+     * \brief compute the stiffness matrix, stored in skyline format,
+     * and the residual. This method is only called if the
+     * `initializeWorkSpace` method selected the skyline storage of the
+     * stiffness matrix.
+     *
+     * \return a pair containing a boolean stating if the computation
+     * succeeded and a time step scaling factor.
+     * \param[out] s: current structure state
+     * \param[out] K:   tangent operator
+     * \param[out] r:   residual
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  smt: type of tangent operator
+     * \note the default implementation throws an exception
+     */
+    [[nodiscard]] virtual std::pair<bool, real>
+    computeStiffnessMatrixAndResidual(StudyCurrentState&,
+                                      tfel::math::SkylineMatrix<real>&,
+                                      tfel::math::vector<real>&,
+                                      const real,
+                                      const real,
+                                      const StiffnessMatrixType) const;
+    /*!
+     * \brief compute the stiffness matrix, stored in compressed sparse
+     * row format, and the residual. This method is only called if the
+     * `initializeWorkSpace` method selected the sparse storage of the
+     * stiffness matrix.
+     *
+     * \return a pair containing a boolean stating if the computation
+     * succeeded and a time step scaling factor.
+     * \param[out] s: current structure state
+     * \param[out] K:   tangent operator
+     * \param[out] r:   residual
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  smt: type of tangent operator
+     * \note the default implementation throws an exception
+     */
+    [[nodiscard]] virtual std::pair<bool, real>
+    computeStiffnessMatrixAndResidual(StudyCurrentState&,
+                                      tfel::math::CSRMatrix<real>&,
+                                      tfel::math::vector<real>&,
+                                      const real,
+                                      const real,
+                                      const StiffnessMatrixType) const;
     /*!
      * \param[in] : du unknows increment difference between two iterations
      */
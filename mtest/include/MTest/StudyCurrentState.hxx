@@ -185,6 +185,12 @@ namespace mtest {
     unsigned int subSteps = 0u;
     // previous time step
     real dt_1 = real{};
+    /*!
+     * \brief if not null, evolutions used in place of the ones of the
+     * study. This allows to treat variants of a study sharing the same
+     * initialisation (see `MTest::sweep`).
+     */
+    std::shared_ptr<const EvolutionManager> evm;
 
    protected:
     /*!
@@ -19,6 +19,7 @@
 #include "TFEL/System/ExternalLibraryManager.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/CurrentState.hxx"
+#include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/Behaviour.hxx"
 #include "MTest/GenericBehaviour.hxx"
@@ -515,6 +516,37 @@ namespace mtest {
     }
   }  // end of Behaviour::setOptionalMaterialPropertyDefaultValue
 
+  bool Behaviour::isThreadSafe() const { return false; }
+
+  bool Behaviour::allowsParametersBlock() const { return false; }
+
+  std::vector<real> Behaviour::buildParametersBlock(
+      const std::map<std::string, real>&) const {
+    tfel::raise(
+        "Behaviour::buildParametersBlock: "
+        "parameters blocks are not supported by this behaviour");
+  }  // end of buildParametersBlock
+
+  std::vector<std::pair<bool, real>> Behaviour::integrateBatch(
+      std::span<tfel::math::matrix<real>> Kt,
+      std::span<CurrentState> s,
+      BehaviourWorkSpace& wk,
+      const real dt,
+      const StiffnessMatrixType ktype) const {
+    tfel::raise_if(Kt.size() != s.size(),
+                   "Behaviour::integrateBatch: "
+                   "unmatched number of states");
+    auto r = std::vector<std::pair<bool, real>>{};
+    r.reserve(s.size());
+    for (std::size_t p = 0; p != s.size(); ++p) {
+      r.push_back(this->integrate(s[p], wk, dt, ktype));
+      if ((r.back().first) && (ktype != StiffnessMatrixType::NOSTIFFNESS)) {
+        Kt[p] = wk.k;
+      }
+    }
+    return r;
+  }  // end of integrateBatch
+
   Behaviour::~Behaviour() = default;
 
   bool isBehaviourVariable(const Behaviour& b, const std::string& n) {
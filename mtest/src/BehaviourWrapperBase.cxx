@@ -153,6 +153,19 @@ namespace mtest {
     this->b->setUnsignedIntegerParameter(n, v);
   }  // end of setUnsignedIntegerParameter
 
+  bool BehaviourWrapperBase::isThreadSafe() const {
+    return this->b->isThreadSafe();
+  }  // end of isThreadSafe
+
+  bool BehaviourWrapperBase::allowsParametersBlock() const {
+    return this->b->allowsParametersBlock();
+  }  // end of allowsParametersBlock
+
+  std::vector<real> BehaviourWrapperBase::buildParametersBlock(
+      const std::map<std::string, real>& values) const {
+    return this->b->buildParametersBlock(values);
+  }  // end of buildParametersBlock
+
   BehaviourWrapperBase::~BehaviourWrapperBase() = default;
 
 }  // end of namespace mtest
@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <algorithm>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
@@ -32,6 +33,7 @@ namespace mtest {
   }  // end of CastemEvolution::CastemEvolution
 
   real CastemEvolution::operator()(const real t) const {
+    std::lock_guard<std::mutex> lock(this->m);
     std::vector<std::string>::size_type i;
     for (i = 0; i != this->vnames.size(); ++i) {
       auto pev = this->evm.find(vnames[i]);
@@ -75,6 +77,11 @@ namespace mtest {
         "sense for castem evolution");
   }
 
+  bool CastemEvolution::dependsOn(const std::string& n) const {
+    return std::find(this->vnames.begin(), this->vnames.end(), n) !=
+           this->vnames.end();
+  }  // end of CastemEvolution::dependsOn
+
   CastemEvolution::~CastemEvolution() = default;
 
 }  // end of namespace mtest
@@ -23,6 +23,10 @@ namespace mtest {
   ConstraintOptions& ConstraintOptions::operator=(const ConstraintOptions&) =
       default;
 
+  bool Constraint::dependsOn(const std::string&) const {
+    return false;
+  }  // end of Constraint::dependsOn
+
   Constraint::~Constraint() = default;
 
   void applyConstraintOptions(Constraint& c, const ConstraintOptions& o) {
@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <algorithm>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
@@ -33,6 +34,7 @@ namespace mtest {
   }  // end of CyranoEvolution::CyranoEvolution
 
   real CyranoEvolution::operator()(const real t) const {
+    std::lock_guard<std::mutex> lock(this->m);
     for (std::vector<std::string>::size_type i = 0; i != this->vnames.size();
          ++i) {
       auto pev = this->evm.find(vnames[i]);
@@ -85,6 +87,11 @@ namespace mtest {
         "sense for evolution evolution");
   }
 
+  bool CyranoEvolution::dependsOn(const std::string& n) const {
+    return std::find(this->vnames.begin(), this->vnames.end(), n) !=
+           this->vnames.end();
+  }  // end of CyranoEvolution::dependsOn
+
   CyranoEvolution::~CyranoEvolution() = default;
 
 }  // end of namespace mtest
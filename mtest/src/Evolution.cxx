@@ -11,7 +11,11 @@
  * project under specific licensing conditions.
  */
 
+#include <cmath>
 #include <string>
+#include <numeric>
+#include <utility>
+#include <algorithm>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Math/Parser/ExternalFunctionManager.hxx"
@@ -20,6 +24,18 @@
 
 namespace mtest {
 
+  void Evolution::evaluate(std::vector<real>& r,
+                           const std::vector<real>& t) const {
+    r.resize(t.size());
+    for (std::vector<real>::size_type i = 0; i != t.size(); ++i) {
+      r[i] = (*this)(t[i]);
+    }
+  }  // end of Evolution::evaluate
+
+  bool Evolution::dependsOn(const std::string&) const {
+    return false;
+  }  // end of Evolution::dependsOn
+
   Evolution::~Evolution() = default;
 
   ConstantEvolution::ConstantEvolution(const real v) : value(v) {}
@@ -102,6 +118,139 @@ namespace mtest {
 
   LPIEvolution::~LPIEvolution() = default;
 
+  TabulatedEvolution::TabulatedEvolution(std::vector<real> t,
+                                         std::vector<real> v)
+      : times(std::move(t)), values(std::move(v)) {
+    tfel::raise_if(this->times.size() != this->values.size(),
+                   "TabulatedEvolution::TabulatedEvolution: "
+                   "the number of values of the times don't match "
+                   "the number of values of the evolution");
+    tfel::raise_if(!std::all_of(this->times.begin(), this->times.end(),
+                                [](const real t) { return std::isfinite(t); }),
+                   "TabulatedEvolution::TabulatedEvolution: "
+                   "invalid time");
+    if (std::is_sorted(this->times.begin(), this->times.end()) &&
+        std::adjacent_find(this->times.begin(), this->times.end()) ==
+            this->times.end()) {
+      return;
+    }
+    // sort the times, keeping the first value of duplicated times as
+    // `LPIEvolution` does
+    auto idx = std::vector<size_type>(this->times.size());
+    std::iota(idx.begin(), idx.end(), size_type{0});
+    std::stable_sort(idx.begin(), idx.end(),
+                     [this](const size_type i, const size_type j) {
+                       return this->times[i] < this->times[j];
+                     });
+    auto nt = std::vector<real>{};
+    auto nv = std::vector<real>{};
+    nt.reserve(idx.size());
+    nv.reserve(idx.size());
+    for (const auto i : idx) {
+      if ((!nt.empty()) && (!(nt.back() < this->times[i]))) {
+        continue;
+      }
+      nt.push_back(this->times[i]);
+      nv.push_back(this->values[i]);
+    }
+    this->times = std::move(nt);
+    this->values = std::move(nv);
+  }  // end of TabulatedEvolution::TabulatedEvolution
+
+  const std::vector<real>& TabulatedEvolution::getTimes() const noexcept {
+    return this->times;
+  }  // end of TabulatedEvolution::getTimes
+
+  const std::vector<real>& TabulatedEvolution::getValues() const noexcept {
+    return this->values;
+  }  // end of TabulatedEvolution::getValues
+
+  void TabulatedEvolution::setValue(const real) {
+    tfel::raise(
+        "TabulatedEvolution::setValue: "
+        "this method does not makes sense "
+        "for tabulated evolution");
+  }  // end of TabulatedEvolution::setValue
+
+  void TabulatedEvolution::setValue(const real t, const real v) {
+    tfel::raise_if(!std::isfinite(t), "TabulatedEvolution::setValue: "
+                   "invalid time (" + std::to_string(t) + ")");
+    // appending a new time is the most common case
+    if ((this->times.empty()) || (t > this->times.back())) {
+      this->times.push_back(t);
+      this->values.push_back(v);
+      return;
+    }
+    const auto p = std::lower_bound(this->times.begin(), this->times.end(), t);
+    const auto i = static_cast<size_type>(p - this->times.begin());
+    if (!(t < *p)) {
+      this->values[i] = v;
+      return;
+    }
+    this->times.insert(p, t);
+    this->values.insert(this->values.begin() + i, v);
+  }  // end of TabulatedEvolution::setValue
+
+  real TabulatedEvolution::interpolate(size_type& i, const real t) const {
+    const auto n = this->times.size();
+    tfel::raise_if(n == 0, "TabulatedEvolution::interpolate: "
+                   "no values specified");
+    // comparisons with a NaN are always false, so that such a time
+    // would not be located in any interval
+    tfel::raise_if(!std::isfinite(t), "TabulatedEvolution::interpolate: "
+                   "invalid time (" + std::to_string(t) + ")");
+    if ((n == 1) || (t <= this->times.front())) {
+      return this->values.front();
+    }
+    if (t >= this->times.back()) {
+      return this->values.back();
+    }
+    // here, x_{0} < t < x_{n-1}, so the interval [x_{i},x_{i+1}[
+    // containing t satisfies i < n-1
+    auto in = [this, t](const size_type j) {
+      return (this->times[j] <= t) && (t < this->times[j + 1]);
+    };
+    if (!((i + 1 < n) && in(i))) {
+      if ((i + 2 < n) && in(i + 1)) {
+        ++i;
+      } else {
+        const auto p =
+            std::upper_bound(this->times.begin(), this->times.end(), t);
+        i = static_cast<size_type>(p - this->times.begin()) - 1;
+      }
+    }
+    const auto x0 = this->times[i];
+    const auto y0 = this->values[i];
+    const auto x1 = this->times[i + 1];
+    const auto y1 = this->values[i + 1];
+    return (y1 - y0) / (x1 - x0) * (t - x0) + y0;
+  }  // end of TabulatedEvolution::interpolate
+
+  real TabulatedEvolution::operator()(const real t) const {
+    auto i = this->cursor.load(std::memory_order_relaxed);
+    const auto r = this->interpolate(i, t);
+    this->cursor.store(i, std::memory_order_relaxed);
+    return r;
+  }  // end of TabulatedEvolution::operator()
+
+  void TabulatedEvolution::evaluate(std::vector<real>& r,
+                                    const std::vector<real>& t) const {
+    r.resize(t.size());
+    // the interval is tracked locally: for sorted times, the whole
+    // evaluation is a single pass over the data
+    auto i = this->cursor.load(std::memory_order_relaxed);
+    for (std::vector<real>::size_type j = 0; j != t.size(); ++j) {
+      r[j] = this->interpolate(i, t[j]);
+    }
+    this->cursor.store(i, std::memory_order_relaxed);
+  }  // end of TabulatedEvolution::evaluate
+
+  bool TabulatedEvolution::isConstant() const {
+    return this->times.size() == 1;
+  }  // end of TabulatedEvolution::isConstant
+
+  TabulatedEvolution::~TabulatedEvolution() = default;
+
   std::shared_ptr<Evolution> make_evolution(const real v) {
     return std::shared_ptr<Evolution>{new ConstantEvolution(v)};
   }
@@ -115,7 +264,8 @@ namespace mtest {
       ev[i] = mv.second;
       ++i;
     }
-    return std::shared_ptr<Evolution>{new LPIEvolution(tv, ev)};
+    return std::shared_ptr<Evolution>{
+        new TabulatedEvolution(std::move(tv), std::move(ev))};
   }
 
   std::shared_ptr<tfel::math::parser::ExternalFunctionManager>
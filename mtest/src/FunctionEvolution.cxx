@@ -11,6 +11,8 @@
  * project under specific licensing conditions.
  */
 
+#include <set>
+#include <algorithm>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MTest/FunctionEvolution.hxx"
@@ -21,9 +23,11 @@ namespace mtest {
                                        const EvolutionManager& evm_)
       : evm(evm_),
         f(f_, buildExternalFunctionManagerFromConstantEvolutions(evm_)) {
+    this->f.compile();
   }  // end of FunctionEvolution::FunctionEvolution
 
   real FunctionEvolution::operator()(const real t) const {
+    std::lock_guard<std::mutex> lock(this->m);
     const auto& args = this->f.getVariablesNames();
     std::vector<std::string>::size_type i;
     for (i = 0; i != args.size(); ++i) {
@@ -77,6 +81,17 @@ namespace mtest {
         "for function evolution");
   }
 
+  bool FunctionEvolution::dependsOn(const std::string& n) const {
+    const auto& args = this->f.getVariablesNames();
+    if (std::find(args.begin(), args.end(), n) != args.end()) {
+      return true;
+    }
+    // constant evolutions are treated as external functions
+    auto params = std::set<std::string>{};
+    this->f.getParametersNames(params);
+    return params.count(n) != 0;
+  }  // end of FunctionEvolution::dependsOn
+
   FunctionEvolution::~FunctionEvolution() = default;
 
 }  // end of namespace mtest
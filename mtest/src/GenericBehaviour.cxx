@@ -30,6 +30,7 @@
 #include "MTest/CurrentState.hxx"
 #include "MTest/BehaviourWorkSpace.hxx"
 #include "MFront/GenericBehaviour/BehaviourData.hxx"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
 #include "MTest/GenericBehaviour.hxx"
 
 namespace mtest {
@@ -139,6 +140,29 @@ namespace mtest {
     auto& elm = ExternalLibraryManager::getExternalLibraryManager();
     const auto f = b + "_" + ModellingHypothesis::toString(h);
     this->fct = elm.getGenericBehaviourFunction(l, f);
+    if (elm.hasGenericBehaviourBatchFunction(l, f)) {
+      this->batch_fct = elm.getGenericBehaviourBatchFunction(l, f);
+    }
+    if (elm.hasGenericBehaviourFunctionWithParameters(l, f)) {
+      const auto hn = ModellingHypothesis::toString(h);
+      this->fct_with_parameters =
+          elm.getGenericBehaviourFunctionWithParameters(l, f);
+      this->parameters_block_names = elm.getUMATParametersNames(l, b, hn);
+      const auto ptypes = elm.getUMATParametersTypes(l, b, hn);
+      for (std::size_t i = 0; i != ptypes.size(); ++i) {
+        const auto& p = this->parameters_block_names[i];
+        if (ptypes[i] == 0) {
+          this->parameters_block_values.push_back(
+              elm.getRealParameterDefaultValue(l, b, hn, p));
+        } else if (ptypes[i] == 1) {
+          this->parameters_block_values.push_back(
+              elm.getIntegerParameterDefaultValue(l, b, hn, p));
+        } else {
+          this->parameters_block_values.push_back(
+              elm.getUnsignedShortParameterDefaultValue(l, b, hn, p));
+        }
+      }
+    }
     if (this->stype == 1u) {
       // load the rotation functions
       this->rg_fct = elm.getGenericBehaviourRotateGradientsFunction(
@@ -544,7 +568,17 @@ namespace mtest {
       this->executeFiniteStrainBehaviourTangentOperatorPreProcessing(d, ktype);
     }
     // calling the behaviour
-    const auto r = (this->fct)(&d);
+    // if the behaviour allows it, the values of the parameters are
+    // passed in a parameters block owned by the caller: the one of the
+    // workspace if defined, the one of this object otherwise.
+    const auto r = [this, &wk, &d] {
+      if (this->fct_with_parameters == nullptr) {
+        return (this->fct)(&d);
+      }
+      const auto& p = wk.parameters.empty() ? this->parameters_block_values
+                                            : wk.parameters;
+      return (this->fct_with_parameters)(&d, p.data());
+    }();
     if (r != 1) {
       mfront::getLogStream() << error_message << '\n';
       return {false, rdt};
@@ -581,93 +615,327 @@ namespace mtest {
     }
     // tangent operator (...)
     if (ktype != StiffnessMatrixType::NOSTIFFNESS) {
-      const auto ndv = this->getGradientsSize();
-      const auto nth = this->getThermodynamicForcesSize();
       if (this->btype == 2u) {
         this->executeFiniteStrainBehaviourTangentOperatorPostProcessing(d);
       }
       if (this->stype == 1u) {
         this->rto_fct(&(wk.D(0, 0)), &(wk.D(0, 0)), s.r.begin());
       }
-      if (this->btype != 0u) {
-        for (unsigned short i = 0; i != nth; ++i) {
-          for (unsigned short j = 0; j != ndv; ++j) {
-            Kt(i, j) = wk.D(i, j);
-          }
+      this->convertTangentOperator(Kt, wk.D);
+      if (b && (this->stype == 1u)) {
+        this->rtf_fct(&s.s1[0], &s.s1[0], s.r.begin());
+      }
+    }
+    return {true, rdt};
+  }  // end of call_behaviour
+
+  void GenericBehaviour::convertTangentOperator(
+      tfel::math::matrix<real>& Kt, const tfel::math::matrix<real>& D) const {
+    using size_type = tfel::math::matrix<real>::size_type;
+    const auto ndv = this->getGradientsSize();
+    const auto nth = this->getThermodynamicForcesSize();
+    if (this->btype != 0u) {
+      for (unsigned short i = 0; i != nth; ++i) {
+        for (unsigned short j = 0; j != ndv; ++j) {
+          Kt(i, j) = D(i, j);
         }
-      } else {
-        const auto h = this->getHypothesis();
-        auto to_offset = size_type{};
-        for (const auto& to : this->getTangentOperatorBlocks()) {
-          auto getVariableOffset = [&h](const size_type pos,
-                                        const std::vector<int>& types) {
-            auto o = size_type{};
-            for (size_type p = 0; p != pos; ++p) {
-              o += mtest::getVariableSize(types[p], h);
-            }
-            return o;
-          };
-          const auto ptf =
-              std::find(this->thnames.begin(), this->thnames.end(), to.first);
-          const auto piv =
-              std::find(this->ivnames.begin(), this->ivnames.end(), to.first);
-          const auto pg =
-              std::find(this->gnames.begin(), this->gnames.end(), to.second);
-          const auto pev =
-              std::find(this->evnames.begin(), this->evnames.end(), to.second);
-          const auto to_ro = [&, this]() -> size_type {
-            if (pev != this->evnames.end()) {
-              return mtest::getVariableSize(
-                  this->evtypes[pev - this->evnames.begin()], h);
-            }
-            if (pg == this->gnames.end()) {
-              tfel::raise(
-                  "GenericBehaviour::call_behaviour(1): "
-                  "invalid tangent operator block ('" +
-                  to.first + "'" + " vs '" + to.second + "')");
-            }
+      }
+    } else {
+      const auto h = this->getHypothesis();
+      auto to_offset = size_type{};
+      for (const auto& to : this->getTangentOperatorBlocks()) {
+        auto getVariableOffset = [&h](const size_type pos,
+                                      const std::vector<int>& types) {
+          auto o = size_type{};
+          for (size_type p = 0; p != pos; ++p) {
+            o += mtest::getVariableSize(types[p], h);
+          }
+          return o;
+        };
+        const auto ptf =
+            std::find(this->thnames.begin(), this->thnames.end(), to.first);
+        const auto piv =
+            std::find(this->ivnames.begin(), this->ivnames.end(), to.first);
+        const auto pg =
+            std::find(this->gnames.begin(), this->gnames.end(), to.second);
+        const auto pev =
+            std::find(this->evnames.begin(), this->evnames.end(), to.second);
+        const auto to_ro = [&, this]() -> size_type {
+          if (pev != this->evnames.end()) {
             return mtest::getVariableSize(
-                this->gtypes[pg - this->gnames.begin()], h);
-          }();
-          const auto to_co = [&, this]() -> size_type {
-            if (piv != this->ivnames.end()) {
-              return mtest::getVariableSize(
-                  this->ivtypes[piv - this->ivnames.begin()], h);
-            }
-            if (ptf == this->thnames.end()) {
-              tfel::raise(
-                  "GenericBehaviour::call_behaviour(2): "
-                  "invalid tangent operator block ('" +
-                  to.first + "'" + " vs '" + to.second + "')");
-            }
+                this->evtypes[pev - this->evnames.begin()], h);
+          }
+          if (pg == this->gnames.end()) {
+            tfel::raise(
+                "GenericBehaviour::convertTangentOperator(1): "
+                "invalid tangent operator block ('" +
+                to.first + "'" + " vs '" + to.second + "')");
+          }
+          return mtest::getVariableSize(
+              this->gtypes[pg - this->gnames.begin()], h);
+        }();
+        const auto to_co = [&, this]() -> size_type {
+          if (piv != this->ivnames.end()) {
             return mtest::getVariableSize(
-                this->thtypes[ptf - this->thnames.begin()], h);
-          }();
-          if ((ptf == this->thnames.end()) || (pg == this->gnames.end())) {
-            to_offset += to_ro * to_co;
-            continue;
+                this->ivtypes[piv - this->ivnames.begin()], h);
           }
-          const auto tfpos = ptf - this->thnames.begin();
-          const auto gpos = pg - this->gnames.begin();
-          const auto og = getVariableOffset(gpos, this->gtypes);
-          const auto otf = getVariableOffset(tfpos, this->thtypes);
-          const auto g_size = mtest::getVariableSize(this->gtypes[gpos], h);
-          const auto th_size = mtest::getVariableSize(this->thtypes[tfpos], h);
-          const auto p = wk.D.begin();
-          for (size_type i = 0; i != th_size; ++i) {
-            for (size_type j = 0; j != g_size; ++j) {
-              Kt(otf + i, og + j) = p[to_offset + i * g_size + j];
-            }
+          if (ptf == this->thnames.end()) {
+            tfel::raise(
+                "GenericBehaviour::convertTangentOperator(2): "
+                "invalid tangent operator block ('" +
+                to.first + "'" + " vs '" + to.second + "')");
           }
+          return mtest::getVariableSize(
+              this->thtypes[ptf - this->thnames.begin()], h);
+        }();
+        if ((ptf == this->thnames.end()) || (pg == this->gnames.end())) {
           to_offset += to_ro * to_co;
+          continue;
+        }
+        const auto tfpos = ptf - this->thnames.begin();
+        const auto gpos = pg - this->gnames.begin();
+        const auto og = getVariableOffset(gpos, this->gtypes);
+        const auto otf = getVariableOffset(tfpos, this->thtypes);
+        const auto g_size = mtest::getVariableSize(this->gtypes[gpos], h);
+        const auto th_size = mtest::getVariableSize(this->thtypes[tfpos], h);
+        const auto p = D.begin();
+        for (size_type i = 0; i != th_size; ++i) {
+          for (size_type j = 0; j != g_size; ++j) {
+            Kt(otf + i, og + j) = p[to_offset + i * g_size + j];
+          }
         }
+        to_offset += to_ro * to_co;
       }
-      if (b && (this->stype == 1u)) {
-        this->rtf_fct(&s.s1[0], &s.s1[0], s.r.begin());
+    }
+  }  // end of convertTangentOperator
+
+  void GenericBehaviour::setParameter(const std::string& n,
+                                      const real v) const {
+    if (!this->updateParametersBlockValue(n, v)) {
+      StandardBehaviourBase::setParameter(n, v);
+    }
+  }  // end of setParameter
+
+  void GenericBehaviour::setIntegerParameter(const std::string& n,
+                                             const int v) const {
+    if (!this->updateParametersBlockValue(n, v)) {
+      StandardBehaviourBase::setIntegerParameter(n, v);
+    }
+  }  // end of setIntegerParameter
+
+  void GenericBehaviour::setUnsignedIntegerParameter(
+      const std::string& n, const unsigned short v) const {
+    if (!this->updateParametersBlockValue(n, v)) {
+      StandardBehaviourBase::setUnsignedIntegerParameter(n, v);
+    }
+  }  // end of setUnsignedIntegerParameter
+
+  bool GenericBehaviour::updateParametersBlockValue(const std::string& n,
+                                                    const real v) const {
+    const auto& names = this->parameters_block_names;
+    const auto p = std::find(names.begin(), names.end(), n);
+    if (p == names.end()) {
+      return false;
+    }
+    this->parameters_block_values[p - names.begin()] = v;
+    return true;
+  }  // end of updateParametersBlockValue
+
+  bool GenericBehaviour::allowsParametersBlock() const {
+    return this->fct_with_parameters != nullptr;
+  }  // end of allowsParametersBlock
+
+  std::vector<real> GenericBehaviour::buildParametersBlock(
+      const std::map<std::string, real>& values) const {
+    tfel::raise_if(this->fct_with_parameters == nullptr,
+                   "GenericBehaviour::buildParametersBlock: "
+                   "parameters blocks are not supported by behaviour '" +
+                       this->getBehaviourName() + "'");
+    const auto& names = this->parameters_block_names;
+    auto block = this->parameters_block_values;
+    for (const auto& [n, v] : values) {
+      const auto p = std::find(names.begin(), names.end(), n);
+      tfel::raise_if(p == names.end(),
+                     "GenericBehaviour::buildParametersBlock: "
+                     "no parameter named '" +
+                         n + "'");
+      block[p - names.begin()] = v;
+    }
+    return block;
+  }  // end of buildParametersBlock
+
+  bool GenericBehaviour::hasBatchFunction() const {
+    return this->batch_fct != nullptr;
+  }  // end of hasBatchFunction
+
+  std::vector<std::pair<bool, real>> GenericBehaviour::integrateBatch(
+      std::span<tfel::math::matrix<real>> Kt,
+      std::span<CurrentState> states,
+      BehaviourWorkSpace& wk,
+      const real dt,
+      const StiffnessMatrixType ktype) const {
+    using size_type = std::vector<real>::size_type;
+    auto throw_if = [](const bool c, const std::string& m) {
+      tfel::raise_if(c, "GenericBehaviour::integrateBatch: " + m);
+    };
+    throw_if(Kt.size() != states.size(), "unmatched number of states");
+    auto r = std::vector<std::pair<bool, real>>{};
+    r.reserve(states.size());
+    if ((this->batch_fct == nullptr) || (this->stype == 1u) ||
+        (this->btype == 2u) || (this->fct_with_parameters != nullptr)) {
+      for (size_type p = 0; p != states.size(); ++p) {
+        r.push_back(
+            this->call_behaviour(Kt[p], states[p], wk, dt, ktype, true));
       }
+      return r;
     }
-    return {true, rdt};
-  }  // end of call_behaviour
+    const auto n = states.size();
+    if (n == 0) {
+      return r;
+    }
+    const auto& s_0 = states.front();
+    const auto ng = s_0.e0.size();
+    const auto nth = s_0.s0.size();
+    const auto nmp = s_0.mprops1.size();
+    const auto niv = s_0.iv0.size();
+    const auto nev = s_0.esv0.size();
+    const auto nK = wk.D.size();
+    for (const auto& s : states) {
+      throw_if((s.e0.size() != ng) || (s.s0.size() != nth) ||
+                   (s.mprops1.size() != nmp) || (s.iv0.size() != niv) ||
+                   (s.esv0.size() != nev),
+               "inconsistent states");
+    }
+    // structures of arrays, stored in the buffer of the workspace
+    auto& buffer = wk.batch_values;
+    buffer.resize(n * (2 * (ng + nth + niv + nev) + nmp + nK + 5));
+    auto offset = size_type{};
+    auto next = [&buffer, &offset, n](const size_type m) {
+      const auto v = std::span<real>(buffer.data() + offset, m * n);
+      offset += m * n;
+      return v;
+    };
+    const auto g0 = next(ng);
+    const auto g1 = next(ng);
+    const auto th0 = next(nth);
+    const auto th1 = next(nth);
+    const auto mps = next(nmp);
+    const auto ivs0 = next(niv);
+    const auto ivs1 = next(niv);
+    const auto evs0 = next(nev);
+    const auto evs1 = next(nev);
+    const auto se0 = next(1);
+    const auto se1 = next(1);
+    const auto de0 = next(1);
+    const auto de1 = next(1);
+    const auto K = next(nK);
+    const auto rdt = next(1);
+    std::fill(K.begin(), K.end(), real(0));
+    std::fill(rdt.begin(), rdt.end(), real(1));
+    auto& status = wk.batch_status;
+    status.assign(n, 0);
+    for (size_type p = 0; p != n; ++p) {
+      const auto& s = states[p];
+      for (size_type i = 0; i != ng; ++i) {
+        g0[i * n + p] = s.e0[i];
+        g1[i * n + p] = s.e1[i];
+        if (this->btype == 1u) {
+          // small strain behaviour
+          g0[i * n + p] -= s.e_th0[i];
+          g1[i * n + p] -= s.e_th1[i];
+        }
+      }
+      for (size_type i = 0; i != nth; ++i) {
+        th0[i * n + p] = s.s0[i];
+        th1[i * n + p] = s.s1[i];
+      }
+      for (size_type i = 0; i != nmp; ++i) {
+        mps[i * n + p] = s.mprops1[i];
+      }
+      for (size_type i = 0; i != niv; ++i) {
+        ivs0[i * n + p] = s.iv0[i];
+        ivs1[i * n + p] = s.iv1[i];
+      }
+      for (size_type i = 0; i != nev; ++i) {
+        evs0[i * n + p] = s.esv0[i];
+        evs1[i * n + p] = s.esv0[i] + s.desv[i];
+      }
+      se0[p] = s.se0;
+      se1[p] = s.se1;
+      de0[p] = s.de0;
+      de1[p] = s.de1;
+    }
+    auto data_ptr = [](const std::span<real> v) -> real* {
+      return v.empty() ? nullptr : v.data();
+    };
+    // type of integration to be performed
+    std::fill(wk.D.begin(), wk.D.end(), 0.);
+    StandardBehaviourBase::initializeTangentOperator(wk.D, ktype, true);
+    real options[3] = {0, 0, 0};
+    std::copy(wk.D.begin(), wk.D.begin() + std::min(nK, size_type(3)),
+              options);
+    char error_message[512];
+    std::fill(error_message, error_message + 512, '\0');
+    mfront::gb::BatchBehaviourData d;
+    d.error_message = error_message;
+    d.dt = dt;
+    d.n = n;
+    d.sizes.gradients = ng;
+    d.sizes.thermodynamic_forces = nth;
+    d.sizes.material_properties = nmp;
+    d.sizes.internal_state_variables = niv;
+    d.sizes.external_state_variables = nev;
+    d.sizes.tangent_operator = nK;
+    d.options = options;
+    d.K = K.data();
+    d.rdt = rdt.data();
+    d.status = status.data();
+    d.speed_of_sound = nullptr;
+    d.s0.gradients = data_ptr(g0);
+    d.s1.gradients = data_ptr(g1);
+    d.s0.thermodynamic_forces = data_ptr(th0);
+    d.s1.thermodynamic_forces = data_ptr(th1);
+    d.s0.mass_density = nullptr;
+    d.s1.mass_density = nullptr;
+    d.s0.material_properties = data_ptr(mps);
+    d.s1.material_properties = d.s0.material_properties;
+    d.s0.internal_state_variables = data_ptr(ivs0);
+    d.s1.internal_state_variables = data_ptr(ivs1);
+    d.s0.stored_energy = se0.data();
+    d.s1.stored_energy = se1.data();
+    d.s0.dissipated_energy = de0.data();
+    d.s1.dissipated_energy = de1.data();
+    d.s0.external_state_variables = data_ptr(evs0);
+    d.s1.external_state_variables = data_ptr(evs1);
+    if ((this->batch_fct)(&d) != 1) {
+      mfront::getLogStream() << error_message << '\n';
+    }
+    for (size_type p = 0; p != n; ++p) {
+      // as in `call_behaviour`, any status different from 1 is a failure
+      if (status[p] != 1) {
+        r.push_back({false, rdt[p]});
+        continue;
+      }
+      auto& s = states[p];
+      for (size_type i = 0; i != nth; ++i) {
+        s.s1[i] = th1[i * n + p];
+      }
+      for (size_type i = 0; i != niv; ++i) {
+        s.iv1[i] = ivs1[i * n + p];
+      }
+      s.se1 = se1[p];
+      s.de1 = de1[p];
+      if (ktype != StiffnessMatrixType::NOSTIFFNESS) {
+        auto* const D = wk.D.begin();
+        for (size_type i = 0; i != nK; ++i) {
+          D[i] = K[i * n + p];
+        }
+        this->convertTangentOperator(Kt[p], wk.D);
+      }
+      r.push_back({true, rdt[p]});
+    }
+    return r;
+  }  // end of integrateBatch
 
   void GenericBehaviour::executeFiniteStrainBehaviourStressPreProcessing(
       BehaviourWorkSpace& wk, mfront::gb::BehaviourData& d) const {
@@ -17,6 +17,8 @@
 #include <sstream>
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Math/SkylineLUSolve.hxx"
+#include "TFEL/Math/GMRESSolve.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/Types.hxx"
 #include "MTest/RoundingMode.hxx"
@@ -38,6 +40,74 @@ namespace mtest {
     log << '\n';
   }
 
+  /*!
+   * \brief compute the stiffness matrix and the residual using the
+   * storage of the stiffness matrix selected by the study
+   */
+  static std::pair<bool, real> computeStiffnessMatrixAndResidual(
+      StudyCurrentState& scs,
+      SolverWorkSpace& wk,
+      const Study& s,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType ktype) {
+    if (wk.storage == SolverWorkSpace::SKYLINESTORAGE) {
+      return s.computeStiffnessMatrixAndResidual(scs, wk.sK, wk.r, t, dt,
+                                                 ktype);
+    } else if (wk.storage == SolverWorkSpace::SPARSESTORAGE) {
+      return s.computeStiffnessMatrixAndResidual(scs, wk.csK, wk.r, t, dt,
+                                                 ktype);
+    }
+    return s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, ktype);
+  }  // end of computeStiffnessMatrixAndResidual
+
+  /*!
+   * \brief print the stiffness matrix in the log stream
+   * \param[in] K: stiffness matrix
+   */
+  template <typename StiffnessMatrix>
+  static void printStiffnessMatrix(const StiffnessMatrix& K) {
+    using size_type = typename StiffnessMatrix::size_type;
+    auto& log = mfront::getLogStream();
+    log << "Stiffness matrix:\n";
+    for (size_type i = 0; i != K.getNbRows(); ++i) {
+      for (size_type j = 0; j != K.getNbCols(); ++j) {
+        log << K(i, j) << " ";
+      }
+      log << '\n';
+    }
+    log << '\n';
+  }  // end of printStiffnessMatrix
+
+  /*!
+   * \brief solve the linear system `K.du=r`, where `K` is the
+   * stiffness matrix and `r` the residual. On output, the stiffness
+   * matrix contains its LU decomposition, except for the sparse
+   * storage for which the stiffness matrix is left unchanged and its
+   * incomplete LU decomposition is stored in `wk.ilu`.
+   */
+  static void solve(SolverWorkSpace& wk) {
+    using namespace tfel::math;
+    wk.du = wk.r;
+    setRoundingMode();
+    if (wk.storage == SolverWorkSpace::SKYLINESTORAGE) {
+      SkylineLUSolve::exe(wk.sK, wk.du);
+    } else if (wk.storage == SolverWorkSpace::SPARSESTORAGE) {
+      wk.ilu.decomp(wk.csK);
+      const auto r = GMRESSolve::exe(wk.csK, wk.ilu, wk.du);
+      if (!r.converged) {
+        auto msg = std::ostringstream{};
+        msg << "GenericSolver::solve: the iterative solver did not "
+            << "converge (backward error " << r.residual << " after "
+            << r.iterations << " iterations)";
+        tfel::raise(msg.str());
+      }
+    } else {
+      LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+    }
+    setRoundingMode();
+  }  // end of solve
+
   static std::pair<bool, real> iterate2(StudyCurrentState& scs,
                                         SolverWorkSpace& wk,
                                         const Study& s,
@@ -62,7 +132,7 @@ namespace mtest {
       }
     }
     const auto r =
-        s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, o.ktype);
+        computeStiffnessMatrixAndResidual(scs, wk, s, t, dt, o.ktype);
     if (!r.first) {
       return r;
     }
@@ -109,7 +179,6 @@ namespace mtest {
                 PredictionPolicy::ELASTICPREDICTIONFROMMATERIALPROPERTIES) ||
                (o.ppolicy == PredictionPolicy::SECANTOPERATORPREDICTION) ||
                (o.ppolicy == PredictionPolicy::TANGENTOPERATORPREDICTION)) {
-      std::fill(wk.K.begin(), wk.K.end(), 0.);
       auto smt = StiffnessMatrixType::ELASTIC;
       if (o.ppolicy ==
           PredictionPolicy::ELASTICPREDICTIONFROMMATERIALPROPERTIES) {
@@ -119,12 +188,22 @@ namespace mtest {
       } else if (o.ppolicy == PredictionPolicy::TANGENTOPERATORPREDICTION) {
         smt = StiffnessMatrixType::TANGENTOPERATOR;
       }
-      if (s.computePredictionStiffnessAndResidual(scs, wk.K, wk.r, t, dt, smt)
-              .first) {
-        wk.du = wk.r;
-        setRoundingMode();
-        LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
-        setRoundingMode();
+      const auto rp = [&] {
+        if (wk.storage == SolverWorkSpace::SKYLINESTORAGE) {
+          wk.sK.zero();
+          return s.computePredictionStiffnessAndResidual(scs, wk.sK, wk.r, t,
+                                                         dt, smt);
+        } else if (wk.storage == SolverWorkSpace::SPARSESTORAGE) {
+          wk.csK.zero();
+          return s.computePredictionStiffnessAndResidual(scs, wk.csK, wk.r, t,
+                                                         dt, smt);
+        }
+        std::fill(wk.K.begin(), wk.K.end(), 0.);
+        return s.computePredictionStiffnessAndResidual(scs, wk.K, wk.r, t, dt,
+                                                       smt);
+      }();
+      if (rp.first) {
+        solve(wk);
         u1 -= wk.du;
       } else {
         if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
@@ -153,23 +232,20 @@ namespace mtest {
       ++iter;
       nep2 = nep;
       nep = ne;
-      auto r =
-          s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, o.ktype);
+      auto r = computeStiffnessMatrixAndResidual(scs, wk, s, t, dt, o.ktype);
       if (!r.first) {
         return r;
       }
       r_dt = r.second;
       if ((mfront::getVerboseMode() >= mfront::VERBOSE_DEBUG) &&
           (o.ktype != StiffnessMatrixType::NOSTIFFNESS)) {
-        auto& log = mfront::getLogStream();
-        log << "Stiffness matrix:\n";
-        for (size_type i = 0; i != wk.K.getNbRows(); ++i) {
-          for (size_type j = 0; j != wk.K.getNbCols(); ++j) {
-            log << wk.K(i, j) << " ";
-          }
-          log << '\n';
+        if (wk.storage == SolverWorkSpace::SKYLINESTORAGE) {
+          printStiffnessMatrix(wk.sK);
+        } else if (wk.storage == SolverWorkSpace::SPARSESTORAGE) {
+          printStiffnessMatrix(wk.csK);
+        } else {
+          printStiffnessMatrix(wk.K);
         }
-        log << '\n';
       }
       if (mfront::getVerboseMode() >= mfront::VERBOSE_DEBUG) {
         auto& log = mfront::getLogStream();
@@ -179,10 +255,7 @@ namespace mtest {
         }
         log << '\n';
       }
-      wk.du = wk.r;
-      setRoundingMode();
-      LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
-      setRoundingMode();
+      solve(wk);
       u1 -= wk.du;
       converged =
           (o.ppolicy == PredictionPolicy::NOPREDICTION) ? (iter > 1) : true;
@@ -84,6 +84,10 @@ namespace mtest {
     return msg.str();
   }
 
+  bool ImposedGradient::dependsOn(const std::string& n) const {
+    return this->eev->dependsOn(n);
+  }  // end of dependsOn
+
   ImposedGradient::~ImposedGradient() = default;
 
 }  // end of namespace mtest
@@ -79,6 +79,10 @@ namespace mtest {
     return msg.str();
   }
 
+  bool ImposedThermodynamicForce::dependsOn(const std::string& n) const {
+    return this->sev->dependsOn(n);
+  }  // end of dependsOn
+
   ImposedThermodynamicForce::~ImposedThermodynamicForce() = default;
 
 }  // end of namespace mtest
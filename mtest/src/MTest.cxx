@@ -13,9 +13,12 @@
 
 #include <map>
 #include <cmath>
+#include <limits>
 #include <string>
 #include <vector>
 #include <memory>
+#include <future>
+#include <fstream>
 #include <sstream>
 #include <cstdlib>
 #include <iterator>
@@ -32,6 +35,7 @@
 #include "TFEL/Math/tvector.hxx"
 #include "TFEL/Math/stensor.hxx"
 #include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
 #include "MTest/Behaviour.hxx"
@@ -343,6 +347,18 @@ namespace mtest {
       this->out << "# " << cnbr + 1 << " column: disspated energy\n";
       ++cnbr;
     }
+    auto columns = std::vector<std::string>{"t"};
+    for (const auto& c : this->b->getGradientsComponents()) {
+      columns.push_back(c);
+    }
+    for (const auto& c : this->b->getThermodynamicForcesComponents()) {
+      columns.push_back(c);
+    }
+    columns.insert(columns.end(), this->ivfullnames.begin(),
+                   this->ivfullnames.end());
+    columns.push_back("StoredEnergy");
+    columns.push_back("DissipatedEnergy");
+    this->setOutputFileColumns(columns);
     // convergence criterion value for driving variables
     if (this->options.eeps < 0) {
       this->options.eeps = 1.e-12;
@@ -440,11 +456,14 @@ namespace mtest {
     const auto psz = this->getNumberOfUnknowns();
     // clear
     wk.K.clear();
+    wk.sK.clear();
+    wk.csK.clear();
     wk.p_lu.clear();
     wk.x.clear();
     wk.r.clear();
     wk.du.clear();
     // resizing
+    wk.storage = SolverWorkSpace::DENSESTORAGE;
     wk.K.resize(psz, psz);
     wk.p_lu.resize(psz);
     wk.x.resize(psz);
@@ -520,23 +539,303 @@ namespace mtest {
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFile();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFile();
       report(nullptr, state, false);
       throw;
     }
-    this->out.flush();
+    this->flushOutputFile();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
       tr.append(t->getResults());
     }
+    if (!this->sweep_values.empty()) {
+      const auto r =
+          this->sweep(this->sweep_values, this->sweep_number_of_threads);
+      if (!this->sweep_output_file.empty()) {
+        writeSweepResults(this->sweep_output_file, r, this->oprec);
+      }
+      for (std::size_t i = 0; i != r.errors.size(); ++i) {
+        if (!r.errors[i].empty()) {
+          tr.append(tfel::tests::TestResult(
+              false, "variant " + std::to_string(i) + " failed (" +
+                         r.errors[i] + ")"));
+        }
+      }
+    }
     return tr;
   }
 
+  const std::vector<real>& MTest::SweepResults::getOutput(
+      const std::string& n) const {
+    const auto p = std::find(this->names.begin(), this->names.end(), n);
+    tfel::raise_if(p == this->names.end(),
+                   "MTest::SweepResults::getOutput: "
+                   "no output named '" +
+                       n + "'");
+    return this->values[static_cast<std::size_t>(p - this->names.begin())];
+  }  // end of MTest::SweepResults::getOutput
+
+  void MTest::setSweep(const std::map<std::string, std::vector<real>>& v,
+                       const std::size_t n,
+                       const std::string& f) {
+    auto throw_if = [](const bool c, const std::string& m) {
+      tfel::raise_if(c, "MTest::setSweep: " + m);
+    };
+    throw_if(!this->sweep_values.empty(), "variants already defined");
+    throw_if(v.empty(), "no variant defined");
+    throw_if(n == 0, "invalid number of threads");
+    this->sweep_values = v;
+    this->sweep_number_of_threads = n;
+    this->sweep_output_file = f;
+  }  // end of setSweep
+
+  MTest::SweepResults MTest::sweep(
+      const std::map<std::string, std::vector<real>>& v, const std::size_t n) {
+    auto throw_if = [](const bool c, const std::string& m) {
+      tfel::raise_if(c, "MTest::sweep: " + m);
+    };
+    throw_if(v.empty(), "no variant defined");
+    throw_if(n == 0, "invalid number of threads");
+    throw_if(this->times.size() < 2, "invalid number of times defined");
+    throw_if(!this->events.empty(), "events are not supported");
+    if (!this->initialisationFinished) {
+      this->completeInitialisation();
+    }
+    const auto nv = v.begin()->second.size();
+    throw_if(nv == 0, "no variant defined");
+    // variables modified by the variants
+    const auto pnames = this->b->getParametersNames();
+    const auto mpnames = this->b->getMaterialPropertiesNames();
+    const auto esvnames = this->b->expandExternalStateVariablesNames();
+    auto contains = [](const std::vector<std::string>& names,
+                       const std::string& name) {
+      return std::find(names.begin(), names.end(), name) != names.end();
+    };
+    const auto thermal_expansion_coefficients = std::vector<std::string>{
+        "ThermalExpansion", "ThermalExpansion1", "ThermalExpansion2",
+        "ThermalExpansion3"};
+    auto parameters = std::vector<std::string>{};
+    auto evolutions = std::vector<std::string>{};
+    for (const auto& [name, values] : v) {
+      throw_if(values.size() != nv,
+               "invalid number of values for '" + name + "'");
+      if (contains(pnames, name)) {
+        parameters.push_back(name);
+      } else {
+        // only the evolutions read by the behaviour through the evolution
+        // manager of the variant can be modified
+        throw_if((!contains(mpnames, name)) && (!contains(esvnames, name)) &&
+                     (!contains(thermal_expansion_coefficients, name)),
+                 "'" + name +
+                     "' is neither a material property, an external state "
+                     "variable, a thermal expansion coefficient nor a real "
+                     "parameter");
+        // evolutions and constraints built on top of a swept evolution
+        // refer to the evolution manager of the test, so they would not
+        // see the value of the variant
+        for (const auto& [ename, e] : *(this->evm)) {
+          throw_if(e->dependsOn(name),
+                   "'" + name + "' can't be swept as the evolution '" + ename +
+                       "' depends on it");
+        }
+        for (const auto& c : this->constraints) {
+          throw_if(c->dependsOn(name),
+                   "'" + name +
+                       "' can't be swept as an imposed constraint depends "
+                       "on it");
+        }
+        evolutions.push_back(name);
+      }
+    }
+    // outputs
+    const auto ndv = this->b->getGradientsSize();
+    const auto nth = this->b->getThermodynamicForcesSize();
+    const auto nt = this->times.size();
+    auto r = SweepResults{};
+    r.times = this->times;
+    r.names = this->b->getGradientsComponents();
+    for (const auto& c : this->b->getThermodynamicForcesComponents()) {
+      r.names.push_back(c);
+    }
+    r.names.insert(r.names.end(), this->ivfullnames.begin(),
+                   this->ivfullnames.end());
+    r.names.push_back("StoredEnergy");
+    r.names.push_back("DissipatedEnergy");
+    r.values.resize(r.names.size(),
+                    std::vector<real>(nv * nt,
+                                      std::numeric_limits<real>::quiet_NaN()));
+    r.errors.resize(nv);
+    // logs of each variant, reported in the order of the variants
+    auto logs = std::vector<std::string>(nv);
+    // if the behaviour allows it, the values of the parameters are
+    // given to each variant in a parameters block rather than being
+    // shared by all the instances of the behaviour
+    const auto use_parameters_block =
+        (!parameters.empty()) && (this->b->allowsParametersBlock());
+    // state shared by all variants
+    auto s0 = StudyCurrentState{};
+    this->initializeCurrentState(s0);
+    auto treat = [this, &v, &parameters, &evolutions, &r, &logs, &s0,
+                  use_parameters_block, ndv, nth, nt](const std::size_t i) {
+      std::ostringstream log;
+      const auto guard = mfront::ThreadLogStreamGuard{log};
+      auto state = s0.makeDeepCopy();
+      if (use_parameters_block) {
+        auto values = std::map<std::string, real>{};
+        for (const auto& p : parameters) {
+          values[p] = v.at(p)[i];
+        }
+        auto& bwk = state.getStructureCurrentState("").getBehaviourWorkSpace();
+        bwk.parameters = this->b->buildParametersBlock(values);
+      }
+      if (!evolutions.empty()) {
+        auto vevm = std::make_shared<EvolutionManager>(*(this->evm));
+        for (const auto& e : evolutions) {
+          (*vevm)[e] = make_evolution(v.at(e)[i]);
+        }
+        state.evm = vevm;
+      }
+      // store the outputs at the k-th time
+      auto store = [&r, &state, i, ndv, nth, nt](const std::size_t k) {
+        const auto& cs = state.getStructureCurrentState("").istates[0];
+        auto o = std::size_t{};
+        auto set = [&r, &o, i, k, nt](const real value) {
+          r.values[o][i * nt + k] = value;
+          ++o;
+        };
+        for (unsigned short c = 0; c != ndv; ++c) {
+          set(state.u0[c]);
+        }
+        for (unsigned short c = 0; c != nth; ++c) {
+          set(cs.s0[c]);
+        }
+        for (const auto& iv : cs.iv0) {
+          set(iv);
+        }
+        set(cs.se0);
+        set(cs.de0);
+      };
+      try {
+        auto wk = SolverWorkSpace{};
+        this->initializeWorkSpace(wk);
+        store(0);
+        for (std::size_t k = 1; k != nt; ++k) {
+          GenericSolver().execute(state, wk, *this, this->options,
+                                  this->times[k - 1], this->times[k]);
+          store(k);
+        }
+      } catch (std::exception& e) {
+        r.errors[i] = e.what();
+      } catch (...) {
+        r.errors[i] = "unknown exception";
+      }
+      logs[i] = log.str();
+    };
+    // the tests, the user defined post-processings and the output files
+    // are disabled while treating the variants
+    auto tests_backup = std::move(this->tests);
+    auto upostprocessings_backup = std::move(this->upostprocessings);
+    auto out_backup = std::ofstream{};
+    auto bout_backup = std::move(this->bout);
+    auto residual_backup = std::ofstream{};
+    std::swap(this->out, out_backup);
+    std::swap(this->residual, residual_backup);
+    this->out.setstate(std::ios::badbit);
+    this->residual.setstate(std::ios::badbit);
+    auto restore = [this, &tests_backup, &upostprocessings_backup, &out_backup,
+                    &bout_backup, &residual_backup, &parameters] {
+      this->tests = std::move(tests_backup);
+      this->upostprocessings = std::move(upostprocessings_backup);
+      std::swap(this->out, out_backup);
+      this->bout = std::move(bout_backup);
+      std::swap(this->residual, residual_backup);
+      // the values of the parameters are stored in the evolutions
+      // associated with them
+      const auto& bn = this->b->getBehaviourName();
+      for (const auto& p : parameters) {
+        const auto& ev = *(this->evm->at(bn + "::" + p));
+        this->b->setParameter(p, ev(0));
+      }
+    };
+    try {
+      // unless given in a parameters block, parameters are shared by all
+      // the instances of the behaviour, so variants modifying them are
+      // treated sequentially
+      const auto parallel =
+          (n > 1) && (nv > 1) &&
+          ((parameters.empty()) || (use_parameters_block)) &&
+          (this->options.aa == nullptr) && (this->b->isThreadSafe());
+      if (parallel) {
+        using TaskResult = tfel::system::ThreadedTaskResult<void>;
+        auto pool = tfel::system::ThreadPool(std::min(n, nv));
+        auto tasks = std::vector<std::future<TaskResult>>{};
+        tasks.reserve(nv);
+        for (std::size_t i = 0; i != nv; ++i) {
+          tasks.push_back(pool.addTask([&treat, i] { treat(i); }));
+        }
+        auto tresults = std::vector<TaskResult>{};
+        tresults.reserve(nv);
+        for (auto& task : tasks) {
+          tresults.push_back(task.get());
+        }
+        for (auto& tr : tresults) {
+          if (!tr) {
+            tr.rethrow();
+          }
+        }
+      } else {
+        for (std::size_t i = 0; i != nv; ++i) {
+          if (!use_parameters_block) {
+            for (const auto& p : parameters) {
+              this->b->setParameter(p, v.at(p)[i]);
+            }
+          }
+          treat(i);
+        }
+      }
+    } catch (...) {
+      restore();
+      throw;
+    }
+    restore();
+    auto& log = mfront::getLogStream();
+    for (const auto& l : logs) {
+      log << l;
+    }
+    return r;
+  }  // end of sweep
+
+  void writeSweepResults(const std::string& f,
+                         const MTest::SweepResults& r,
+                         const int p) {
+    std::ofstream out(f);
+    tfel::raise_if(!out, "writeSweepResults: can't open file '" + f + "'");
+    out.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    if (p >= 0) {
+      out.precision(static_cast<std::streamsize>(p));
+    }
+    out << "# first column: variant\n"
+        << "# second column: time\n";
+    for (std::size_t i = 0; i != r.names.size(); ++i) {
+      out << "# " << i + 3 << " column: " << r.names[i] << '\n';
+    }
+    const auto nt = r.times.size();
+    for (std::size_t j = 0; j != r.errors.size(); ++j) {
+      for (std::size_t k = 0; k != nt; ++k) {
+        out << j << " " << r.times[k];
+        for (const auto& values : r.values) {
+          out << " " << values[j * nt + k];
+        }
+        out << '\n';
+      }
+    }
+  }  // end of writeSweepResults
+
   void MTest::setCompareToNumericalTangentOperator(const bool bo) {
     this->cto = bo;
   }  // end of setCompareToNumericalTangentOperator
@@ -942,7 +1241,20 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (this->out) {
+    if (this->bout) {
+      auto& cs = s.getStructureCurrentState("").istates[0];
+      const auto ndv = this->b->getGradientsSize();
+      const auto nth = this->b->getThermodynamicForcesSize();
+      auto values = std::vector<real>{};
+      values.reserve(this->bout->getNumberOfColumns());
+      values.push_back(t);
+      values.insert(values.end(), s.u0.begin(), s.u0.begin() + ndv);
+      values.insert(values.end(), cs.s0.begin(), cs.s0.begin() + nth);
+      values.insert(values.end(), cs.iv0.begin(), cs.iv0.end());
+      values.push_back(cs.se0);
+      values.push_back(cs.de0);
+      this->bout->write(values);
+    } else if (this->out) {
       auto& cs = s.getStructureCurrentState("").istates[0];
       // number of components of the driving variables and the thermodynamic
       // forces
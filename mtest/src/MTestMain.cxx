@@ -11,11 +11,15 @@
  * project under specific licensing conditions.
  */
 
+#include <map>
 #include <cfenv>
+#include <algorithm>
 #include <regex>
+#include <cstdio>
 #include <string>
 #include <vector>
 #include <cstdlib>
+#include <sstream>
 #include <utility>
 #include <iostream>
 
@@ -27,6 +31,10 @@
 #ifdef small
 #undef small
 #endif /* small */
+#else
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/types.h>
 #endif
 
 #ifdef MTEST_HAVE_MADNEX
@@ -39,10 +47,15 @@
 #endif
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Tests/TestSuite.hxx"
 #include "TFEL/Tests/TestManager.hxx"
 #include "TFEL/Tests/XMLTestOutput.hxx"
+#include "TFEL/Tests/StdStreamTestOutput.hxx"
+#include "TFEL/Tests/MultipleTestOutputs.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
 
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
 #include "TFEL/System/SignalManager.hxx"
@@ -52,6 +65,7 @@
 #include "MTest/RoundingMode.hxx"
 #include "MTest/Constraint.hxx"
 #include "MTest/Evolution.hxx"
+#include "MTest/Behaviour.hxx"
 #include "MTest/MTest.hxx"
 #include "MTest/PipeTest.hxx"
 #include "MTest/MTestParser.hxx"
@@ -78,6 +92,8 @@ namespace mtest {
     void treatXMLOutput();
     void treatResultFileOutput();
     void treatResidualFileOutput();
+    //! \brief treat the `--jobs` option
+    void treatJobs();
     [[noreturn]] void treatHelpCommandsList();
     [[noreturn]] void treatHelpCommands();
     [[noreturn]] void treatHelpCommand();
@@ -102,6 +118,35 @@ namespace mtest {
     std::shared_ptr<SchemeBase> createPTestTest(const std::string&);
     void treatMadnexInputFile(const std::string&);
     void treatStandardInputFile(const std::string&);
+    //! \brief a test suite run by a single job
+    struct Job {
+      //! \brief test suite
+      std::shared_ptr<tfel::tests::TestSuite> suite;
+      //! \brief xml output files
+      std::vector<std::string> xml_outputs;
+      //! \brief true if all the tests of the suite can be run in a thread
+      bool isThreadSafe = true;
+    };
+    /*!
+     * \brief execute a job
+     * \param[in] j: job
+     * \param[in] os: stream in which the results of the tests are reported
+     */
+    static tfel::tests::TestResult executeJob(const Job&, std::ostream&);
+    /*!
+     * \brief execute the jobs using a pool of threads
+     *
+     * The outputs of the jobs are reported in the order of the jobs.
+     */
+    tfel::tests::TestResult executeJobsInThreads() const;
+#if !(defined _WIN32 || defined _WIN64)
+    /*!
+     * \brief execute the jobs in forked processes
+     *
+     * The outputs of the jobs are reported in the order of the jobs.
+     */
+    tfel::tests::TestResult executeJobsInProcesses() const;
+#endif /* !(defined _WIN32 || defined _WIN64) */
 
 #ifdef MADNEX_MTEST_TEST_SUPPORT
     /*!
@@ -136,6 +181,13 @@ namespace mtest {
     bool result_file_output = true;
     // generate residual file
     bool residual_file_output = false;
+    //! \brief number of jobs run concurrently
+    std::size_t jobs = 1;
+    /*!
+     * \brief jobs, sorted by name as the test suites of the
+     * `TestManager` class. Only used if more than one job is requested.
+     */
+    std::map<std::string, Job> parallel_jobs;
   };
 
   MTestMain::MTestMain(const int argc, const char* const* const argv)
@@ -160,6 +212,10 @@ namespace mtest {
     this->registerNewCallBack("--residual-file-output",
                               &MTestMain::treatResidualFileOutput,
                               "control residual output (default no)", true);
+    this->registerNewCallBack(
+        "--jobs", "-j", &MTestMain::treatJobs,
+        "set the number of input files treated concurrently (default 1)",
+        true);
     this->registerNewCallBack(
         "--help-keywords", &MTestMain::treatHelpCommands,
         "display the help of all available commands and exit.");
@@ -388,6 +444,21 @@ namespace mtest {
     }
   }  // end of MTestMain::treatResidualFileOutput
 
+  void MTestMain::treatJobs() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(), "MTestMain::treatJobs: no option given");
+    auto n = std::size_t{};
+    auto pos = std::size_t{};
+    try {
+      n = std::stoul(o, &pos);
+    } catch (std::exception&) {
+      pos = 0;
+    }
+    tfel::raise_if((pos != o.size()) || (n == 0),
+                   "MTestMain::treatJobs: invalid number of jobs '" + o + "'");
+    this->jobs = n;
+  }  // end of MTestMain::treatJobs
+
   void MTestMain::treatHelpCommandsList() {
     if ((this->scheme == MTEST) || (this->scheme == DEFAULT)) {
       MTestParser().displayKeyWordsList();
@@ -507,11 +578,182 @@ namespace mtest {
         }
       }
     }
-    auto& tm = tfel::tests::TestManager::getTestManager();
-    const auto r = tm.execute();
+    if (this->jobs == 1) {
+      auto& tm = tfel::tests::TestManager::getTestManager();
+      const auto r = tm.execute();
+      return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    auto all_thread_safe = true;
+    for (const auto& j : this->parallel_jobs) {
+      all_thread_safe = all_thread_safe && j.second.isThreadSafe;
+    }
+#if !(defined _WIN32 || defined _WIN64)
+    if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL1) {
+      mfront::getLogStream()
+          << "mtest: " << this->parallel_jobs.size() << " jobs run in "
+          << (all_thread_safe ? "threads" : "separate processes") << '\n';
+    }
+    const auto r = all_thread_safe ? this->executeJobsInThreads()
+                                   : this->executeJobsInProcesses();
+#else  /* !(defined _WIN32 || defined _WIN64) */
+    // forking is not available, all jobs are run in threads
+    static_cast<void>(all_thread_safe);
+    const auto r = this->executeJobsInThreads();
+#endif /* !(defined _WIN32 || defined _WIN64) */
     return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
   }  // end of execute
 
+  tfel::tests::TestResult MTestMain::executeJob(const Job& j,
+                                                std::ostream& os) {
+    tfel::tests::MultipleTestOutputs outputs;
+    for (const auto& f : j.xml_outputs) {
+      outputs.addTestOutput(std::make_shared<tfel::tests::XMLTestOutput>(f));
+    }
+    outputs.addTestOutput(
+        std::make_shared<tfel::tests::StdStreamTestOutput>(os, true));
+    return j.suite->execute(outputs);
+  }  // end of executeJob
+
+  tfel::tests::TestResult MTestMain::executeJobsInThreads() const {
+    using TaskResult = tfel::system::ThreadedTaskResult<std::string>;
+    auto pool = tfel::system::ThreadPool(
+        std::min(this->jobs, this->parallel_jobs.size()));
+    auto results = std::vector<tfel::tests::TestResult>(
+        this->parallel_jobs.size());
+    auto tasks = std::vector<std::future<TaskResult>>{};
+    tasks.reserve(this->parallel_jobs.size());
+    auto idx = std::size_t{};
+    for (const auto& j : this->parallel_jobs) {
+      auto& r = results[idx];
+      tasks.push_back(pool.addTask([&j, &r] {
+        // the logs of the tests are gathered in a dedicated stream
+        std::ostringstream log;
+        const auto guard = mfront::ThreadLogStreamGuard{log};
+        r = executeJob(j.second, log);
+        return log.str();
+      }));
+      ++idx;
+    }
+    // the outputs are reported as soon as all the previous jobs are finished
+    auto r = tfel::tests::TestResult{};
+    for (std::size_t i = 0; i != tasks.size(); ++i) {
+      auto log = tasks[i].get();
+      if (!log) {
+        log.rethrow();
+      }
+      std::cout << *log << std::flush;
+      r.append(results[i]);
+    }
+    return r;
+  }  // end of executeJobsInThreads
+
+#if !(defined _WIN32 || defined _WIN64)
+  tfel::tests::TestResult MTestMain::executeJobsInProcesses() const {
+    struct Process {
+      //! \brief process id (0 if the process is not started)
+      pid_t pid = 0;
+      //! \brief temporary file where the outputs of the process are stored
+      std::FILE* log = nullptr;
+      //! \brief exit status
+      int status = 0;
+      //! \brief boolean stating if the process is finished
+      bool finished = false;
+    };
+    auto processes = std::vector<Process>(this->parallel_jobs.size());
+    auto names = std::vector<std::string>{};
+    auto r = tfel::tests::TestResult{};
+    // index of the next job to be reported
+    auto next = std::size_t{};
+    // report the jobs which are finished, in the order of the jobs
+    auto report = [&processes, &names, &next, &r] {
+      for (; (next != processes.size()) && (processes[next].finished);
+           ++next) {
+        auto& p = processes[next];
+        std::rewind(p.log);
+        char buffer[4096];
+        auto n = std::size_t{};
+        while ((n = std::fread(buffer, 1, sizeof(buffer), p.log)) != 0) {
+          std::cout.write(buffer, static_cast<std::streamsize>(n));
+        }
+        std::fclose(p.log);
+        p.log = nullptr;
+        if (WIFEXITED(p.status)) {
+          r.append(tfel::tests::TestResult(WEXITSTATUS(p.status) ==
+                                           EXIT_SUCCESS));
+        } else {
+          const auto msg = "test suite '" + names[next] + "' " +
+                           (WIFSIGNALED(p.status)
+                                ? "was terminated by signal " +
+                                      std::to_string(WTERMSIG(p.status))
+                                : std::string("was abnormally terminated"));
+          std::cout << msg << '\n';
+          r.append(tfel::tests::TestResult(false, msg));
+        }
+      }
+      std::cout.flush();
+    };
+    // wait for the end of one process
+    auto running = std::size_t{};
+    auto wait = [&processes, &running] {
+      auto status = int{};
+      const auto pid = ::waitpid(-1, &status, 0);
+      tfel::raise_if(pid == -1, "MTestMain::executeJobsInProcesses: "
+                                "waitpid failed");
+      for (auto& p : processes) {
+        if (p.pid == pid) {
+          p.status = status;
+          p.finished = true;
+          --running;
+          return;
+        }
+      }
+    };
+    auto idx = std::size_t{};
+    for (const auto& j : this->parallel_jobs) {
+      names.push_back(j.first);
+      while (running == this->jobs) {
+        wait();
+        report();
+      }
+      auto& p = processes[idx];
+      p.log = std::tmpfile();
+      tfel::raise_if(p.log == nullptr,
+                     "MTestMain::executeJobsInProcesses: "
+                     "can't create temporary file");
+      std::cout.flush();
+      std::cerr.flush();
+      std::fflush(nullptr);
+      p.pid = ::fork();
+      tfel::raise_if(p.pid == -1, "MTestMain::executeJobsInProcesses: "
+                                  "fork failed");
+      if (p.pid == 0) {
+        // child process: the standard outputs are redirected to the
+        // temporary file
+        ::dup2(::fileno(p.log), STDOUT_FILENO);
+        ::dup2(::fileno(p.log), STDERR_FILENO);
+        auto success = false;
+        try {
+          success = executeJob(j.second, std::cout).success();
+        } catch (std::exception& e) {
+          std::cout << e.what() << '\n';
+        } catch (...) {
+        }
+        std::cout.flush();
+        std::cerr.flush();
+        std::fflush(nullptr);
+        ::_exit(success ? EXIT_SUCCESS : EXIT_FAILURE);
+      }
+      ++running;
+      ++idx;
+    }
+    while (running != 0) {
+      wait();
+      report();
+    }
+    return r;
+  }  // end of executeJobsInProcesses
+#endif /* !(defined _WIN32 || defined _WIN64) */
+
   std::shared_ptr<SchemeBase> MTestMain::createMTestTest(
       const std::string& path) {
     auto t = std::make_shared<MTest>();
@@ -686,6 +928,22 @@ namespace mtest {
     }
   }  // end of treatStandardInputFile
 
+  /*!
+   * \return if the given test can be run in a thread
+   * \param[in] t: test
+   */
+  static bool MTestMain_isThreadSafe(const SchemeBase& t) {
+    const auto* const s = dynamic_cast<const SingleStructureScheme*>(&t);
+    if (s == nullptr) {
+      return false;
+    }
+    try {
+      return s->getBehaviour()->isThreadSafe();
+    } catch (...) {
+    }
+    return false;
+  }  // end of MTestMain_isThreadSafe
+
   void MTestMain::addTest(std::shared_ptr<SchemeBase> t, const std::string& n) {
     auto& tm = tfel::tests::TestManager::getTestManager();
     if (this->result_file_output) {
@@ -698,6 +956,20 @@ namespace mtest {
         t->setResidualFileName(n + "-residual.res");
       }
     }
+    if (this->jobs != 1) {
+      auto& j = this->parallel_jobs["MTest/" + n];
+      if (j.suite == nullptr) {
+        j.suite = std::make_shared<tfel::tests::TestSuite>("MTest/" + n);
+      }
+      j.suite->add(t);
+      j.isThreadSafe = j.isThreadSafe && MTestMain_isThreadSafe(*t);
+      if (this->xml_output) {
+        j.xml_outputs.push_back(t->isXMLOutputFileNameDefined()
+                                    ? t->getXMLOutputFileName()
+                                    : n + ".xml");
+      }
+      return;
+    }
     tm.addTest("MTest/" + n, t);
     if (this->xml_output) {
       std::shared_ptr<tfel::tests::TestOutput> o;
@@ -273,6 +273,7 @@ namespace mtest {
         &MTestParser::handleNumericalTangentOperatorPerturbationValue);
     add("@UserDefinedPostProcessing",
         &MTestParser::handleUserDefinedPostProcessing);
+    add("@Sweep", &MTestParser::handleSweep);
   }
 
   void MTestParser::registerCallBack(const std::string& k,
@@ -971,6 +972,48 @@ namespace mtest {
     t.addUserDefinedPostProcessing(f, v);
   }  // end of MTestParser::handleUserDefinedPostProcessing
 
+  void MTestParser::handleSweep(MTest& t, tokens_iterator& p) {
+    const std::string m = "MTestParser::handleSweep";
+    auto throw_if = [&m](const bool b, const std::string& msg) {
+      tfel::raise_if(b, m + ": " + msg);
+    };
+    using tfel::utilities::Data;
+    using tfel::utilities::DataMap;
+    // values of the variants
+    auto v = std::map<std::string, std::vector<real>>{};
+    this->checkNotEndOfLine(m, p, this->tokens.end());
+    const auto d = Data::read_map(p, this->tokens.end()).get<DataMap>();
+    for (const auto& kv : d) {
+      throw_if(!tfel::utilities::is_convertible<std::vector<double>>(kv.second),
+               "invalid values for variable '" + kv.first + "'");
+      v[kv.first] = tfel::utilities::convert<std::vector<double>>(kv.second);
+    }
+    // options
+    auto nthreads = std::size_t{1};
+    auto f = std::string{};
+    this->checkNotEndOfLine(m, p, this->tokens.end());
+    if (p->value == "{") {
+      const auto opts = Data::read_map(p, this->tokens.end()).get<DataMap>();
+      for (const auto& kv : opts) {
+        if (kv.first == "number_of_threads") {
+          throw_if(!kv.second.is<int>(),
+                   "invalid type for option 'number_of_threads'");
+          const auto n = kv.second.get<int>();
+          throw_if(n <= 0, "invalid number of threads");
+          nthreads = static_cast<std::size_t>(n);
+        } else if (kv.first == "output_file") {
+          throw_if(!kv.second.is<std::string>(),
+                   "invalid type for option 'output_file'");
+          f = kv.second.get<std::string>();
+        } else {
+          throw_if(true, "unknown option '" + kv.first + "'");
+        }
+      }
+    }
+    this->readSpecifiedToken(m, ";", p, this->tokens.end());
+    t.setSweep(v, nthreads, f);
+  }  // end of MTestParser::handleSweep
+
   ConstraintOptions MTestParser::readConstraintOptions(const std::string& m,
                                                        tokens_iterator& p) {
     auto throw_if = [&m](const bool b, const char* msg) {
@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <set>
 #include <cmath>
 #include <string>
 #include <ostream>
@@ -311,6 +312,16 @@ namespace mtest {
            std::to_string(ev) + ")";
   }
 
+  bool NonLinearConstraint::dependsOn(const std::string& n) const {
+    if (this->c->evs.count(n) != 0) {
+      return true;
+    }
+    // constant evolutions are treated as external functions
+    auto params = std::set<std::string>{};
+    this->c->c->getParametersNames(params);
+    return params.count(n) != 0;
+  }  // end of dependsOn
+
   NonLinearConstraint::~NonLinearConstraint() = default;
 
 }  // end of namespace mtest
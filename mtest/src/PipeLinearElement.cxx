@@ -13,7 +13,8 @@
 
 #include <ostream>
 #include "TFEL/Material/ModellingHypothesis.hxx"
-#include "MFront/MFrontLogStream.hxx"
+#include "TFEL/Math/SkylineMatrix.hxx"
+#include "TFEL/Math/CSRMatrix.hxx"
 #include "MTest/RoundingMode.hxx"
 #include "MTest/Behaviour.hxx"
 #include "MTest/BehaviourWorkSpace.hxx"
@@ -138,16 +139,51 @@ namespace mtest {
     }
   }  // end of PipeLinearElement::computeStrain
 
-  std::pair<bool, real> PipeLinearElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
-      tfel::math::vector<real>& r,
+  std::pair<bool, real> PipeLinearElement::integrate(
       StructureCurrentState& scs,
+      std::vector<tfel::math::tmatrix<3u, 3u, real>>& K,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
       const tfel::math::vector<real>& u1,
       const PipeMesh& m,
       const real dt,
       const StiffnessMatrixType mt,
       const size_t i) {
+    // compute the strain
+    computeStrain(scs, m, u1, i, true);
+    auto r_dt = real{};
+    // loop over Gauss point
+    for (const auto g : {0, 1}) {
+      // current state
+      auto& s = scs.istates[2 * i + g];
+      setRoundingMode();
+      const auto rb = b.integrate(s, bwk, dt, mt);
+      setRoundingMode();
+      r_dt = (g == 0) ? rb.second : std::min(rb.second, r_dt);
+      if (!rb.first) {
+        return {false, r_dt};
+      }
+      if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+        auto& Kg = K[2 * i + g];
+        for (unsigned short l = 0; l != 3; ++l) {
+          for (unsigned short c = 0; c != 3; ++c) {
+            Kg(l, c) = bwk.k(l, c);
+          }
+        }
+      }
+    }
+    return {true, r_dt};
+  }  // end of PipeLinearElement::integrate
+
+  template <typename StiffnessMatrix>
+  void PipeLinearElement::updateStiffnessMatrixAndInnerForces(
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      const StructureCurrentState& scs,
+      const std::vector<tfel::math::tmatrix<3u, 3u, real>>& K,
+      const PipeMesh& m,
+      const StiffnessMatrixType mt,
+      const size_t i) {
     //! a simple alias
     constexpr real pi = 3.14159265358979323846;
     // number of elements
@@ -166,11 +202,6 @@ namespace mtest {
     const auto r1 = Ri + dr * (i + 1);
     // jacobian of the transformation
     const auto J = dr / 2;
-    /* inner forces */
-    auto& bwk = scs.getBehaviourWorkSpace();
-    // compute the strain
-    computeStrain(scs, m, u1, i, true);
-    auto r_dt = real{};
     // loop over Gauss point
     for (const auto g : {0, 1}) {
       // Gauss point position in the reference element
@@ -178,19 +209,8 @@ namespace mtest {
       // radial position of the Gauss point
       const auto rg = interpolate(r0, r1, pg);
       // current state
-      auto& s = scs.istates[2 * i + g];
-      setRoundingMode();
-      const auto rb = b.integrate(s, bwk, dt, mt);
+      const auto& s = scs.istates[2 * i + g];
       setRoundingMode();
-      r_dt = (g == 0) ? rb.second : std::min(rb.second, r_dt);
-      if (!rb.first) {
-        if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
-          auto& log = mfront::getLogStream();
-          log << "PipeLinearElement::computeStiffnessMatrixAndResidual : "
-              << "behaviour intregration failed" << std::endl;
-        }
-        return {false, r_dt};
-      }
       // stress tensor
       const auto pi_rr = s.s1[0];
       const auto pi_zz = s.s1[1];
@@ -203,7 +223,7 @@ namespace mtest {
       r[n] += w * rg * pi_zz;
       // jacobian matrix
       if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-        const auto& bk = bwk.k;
+        const auto& bk = K[2 * i + g];
         const real de10_dur0 = -1 / dr;
         const real de12_dur0 = (1 - pg) / (2 * rg);
         const real de10_dur1 = 1 / dr;
@@ -232,7 +252,33 @@ namespace mtest {
         k(n, n) += w * rg * bk(1, 1);
       }
     }
-    return {true, r_dt};
-  }
+  }  // end of PipeLinearElement::updateStiffnessMatrixAndInnerForces
+
+  template void PipeLinearElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::matrix<real>&,
+      tfel::math::vector<real>&,
+      const StructureCurrentState&,
+      const std::vector<tfel::math::tmatrix<3u, 3u, real>>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t);
+
+  template void PipeLinearElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::SkylineMatrix<real>&,
+      tfel::math::vector<real>&,
+      const StructureCurrentState&,
+      const std::vector<tfel::math::tmatrix<3u, 3u, real>>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t);
+
+  template void PipeLinearElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::CSRMatrix<real>&,
+      tfel::math::vector<real>&,
+      const StructureCurrentState&,
+      const std::vector<tfel::math::tmatrix<3u, 3u, real>>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t);
 
 }  // end of namespace mtest
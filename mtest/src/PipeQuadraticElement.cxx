@@ -13,7 +13,8 @@
 
 #include <ostream>
 #include "TFEL/Material/ModellingHypothesis.hxx"
-#include "MFront/MFrontLogStream.hxx"
+#include "TFEL/Math/SkylineMatrix.hxx"
+#include "TFEL/Math/CSRMatrix.hxx"
 #include "MTest/RoundingMode.hxx"
 #include "MTest/Behaviour.hxx"
 #include "MTest/BehaviourWorkSpace.hxx"
@@ -145,17 +146,51 @@ namespace mtest {
     }
   }  // end of PipeQuadraticElement::computeStrain
 
-  std::pair<bool, real>
-  PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
-      tfel::math::vector<real>& r,
+  std::pair<bool, real> PipeQuadraticElement::integrate(
       StructureCurrentState& scs,
+      std::vector<tfel::math::tmatrix<3u, 3u, real>>& K,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
       const tfel::math::vector<real>& u1,
       const PipeMesh& m,
       const real dt,
       const StiffnessMatrixType mt,
       const size_t i) {
+    // compute the strain
+    computeStrain(scs, m, u1, i, true);
+    auto r_dt = real{};
+    // loop over Gauss point
+    for (const auto g : {0, 1, 2}) {
+      // current state
+      auto& s = scs.istates[3 * i + g];
+      setRoundingMode();
+      const auto rb = b.integrate(s, bwk, dt, mt);
+      setRoundingMode();
+      r_dt = (g == 0) ? rb.second : std::min(rb.second, r_dt);
+      if (!rb.first) {
+        return {false, r_dt};
+      }
+      if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+        auto& Kg = K[3 * i + g];
+        for (unsigned short l = 0; l != 3; ++l) {
+          for (unsigned short c = 0; c != 3; ++c) {
+            Kg(l, c) = bwk.k(l, c);
+          }
+        }
+      }
+    }
+    return {true, r_dt};
+  }  // end of PipeQuadraticElement::integrate
+
+  template <typename StiffnessMatrix>
+  void PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      const StructureCurrentState& scs,
+      const std::vector<tfel::math::tmatrix<3u, 3u, real>>& K,
+      const PipeMesh& m,
+      const StiffnessMatrixType mt,
+      const size_t i) {
     //! a simple alias
     constexpr real pi = 3.14159265358979323846;
     // number of elements
@@ -174,11 +209,6 @@ namespace mtest {
     const auto r1 = r0 + dr / 2;
     // radial position of the thrid node
     const auto r2 = r0 + dr;
-    /* inner forces */
-    auto& bwk = scs.getBehaviourWorkSpace();
-    // compute the strain
-    computeStrain(scs, m, u1, i, true);
-    auto r_dt = real{};
     // loop over Gauss point
     for (const auto g : {0, 1, 2}) {
       setRoundingMode();
@@ -194,19 +224,8 @@ namespace mtest {
       // shape function derivative
       const real dsf[3] = {pg - 0.5, -2. * pg, pg + 0.5};
       // current state
-      auto& s = scs.istates[3 * i + g];
-      setRoundingMode();
-      const auto rb = b.integrate(s, bwk, dt, mt);
+      const auto& s = scs.istates[3 * i + g];
       setRoundingMode();
-      r_dt = (g == 0) ? rb.second : std::min(rb.second, r_dt);
-      if (!rb.first) {
-        if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
-          auto& log = mfront::getLogStream();
-          log << "PipeQuadraticElement::computeStiffnessMatrixAndResidual : "
-              << "behaviour intregration failed" << std::endl;
-        }
-        return {false, r_dt};
-      }
       // stress tensor
       const auto pi_rr = s.s1[0];
       const auto pi_zz = s.s1[1];
@@ -220,7 +239,7 @@ namespace mtest {
       r[n] += w * rg * pi_zz;
       // jacobian matrix
       if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-        const auto& bk = bwk.k;
+        const auto& bk = K[3 * i + g];
         for (const auto l : {0, 1, 2}) {
           for (const auto j : {0, 1, 2}) {
             const auto de0_du = dsf[j] / J;
@@ -240,7 +259,33 @@ namespace mtest {
         k(n, n) += w * rg * bk(1, 1);
       }
     }  // loop over gauss point
-    return {true, r_dt};
-  }
+  }  // end of PipeQuadraticElement::updateStiffnessMatrixAndInnerForces
+
+  template void PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::matrix<real>&,
+      tfel::math::vector<real>&,
+      const StructureCurrentState&,
+      const std::vector<tfel::math::tmatrix<3u, 3u, real>>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t);
+
+  template void PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::SkylineMatrix<real>&,
+      tfel::math::vector<real>&,
+      const StructureCurrentState&,
+      const std::vector<tfel::math::tmatrix<3u, 3u, real>>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t);
+
+  template void PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::CSRMatrix<real>&,
+      tfel::math::vector<real>&,
+      const StructureCurrentState&,
+      const std::vector<tfel::math::tmatrix<3u, 3u, real>>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t);
 
 }  // end of namespace mtest
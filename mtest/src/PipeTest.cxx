@@ -11,7 +11,9 @@
  * project under specific licensing conditions.
  */
 
+#include <span>
 #include <memory>
+#include <future>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
@@ -19,12 +21,16 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/Math/General/IEEE754.hxx"
 #include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/SkylineLUSolve.hxx"
+#include "TFEL/Math/GMRESSolve.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/SolverWorkSpace.hxx"
 #include "MTest/Behaviour.hxx"
+#include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/StudyCurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
@@ -509,6 +515,23 @@ namespace mtest {
                          true, true);
     }
     //
+    if ((this->number_of_threads > 1) && (!this->b->isThreadSafe())) {
+      // the behaviour can't be called concurrently: the integration is
+      // performed by the main thread
+      if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
+        auto& log = mfront::getLogStream();
+        log << "PipeTest::completeInitialisation: "
+            << "the behaviour '" << this->b->getBehaviourName()
+            << "' is not declared reentrant, the requested number of "
+            << "threads (" << this->number_of_threads << ") is ignored\n";
+      }
+      this->number_of_threads = 1;
+    }
+    if (this->number_of_threads > 1) {
+      this->pool =
+          std::make_unique<tfel::system::ThreadPool>(this->number_of_threads);
+    }
+    //
     if (this->options.eeps < 0) {
       this->options.eeps = 1.e-11;
     }
@@ -630,6 +653,7 @@ namespace mtest {
         ++c;
       }
     }
+    this->setOutputFileColumns(this->getOutputFileColumns());
     if (this->rl == TIGHTPIPE) {
       if (this->gseq != nullptr) {
         constexpr real pi = 3.14159265358979323846;
@@ -781,8 +805,6 @@ namespace mtest {
           "number of internal state variables declared by the behaviour");
       std::copy(this->iv_t0.begin(), this->iv_t0.end(), cs.iv_1.begin());
       std::copy(this->iv_t0.begin(), this->iv_t0.end(), cs.iv0.begin());
-      // revert the current state
-      mtest::revert(ss);
       // // rotation matrix
       // cs.r = this->rm;
       // reference temperature
@@ -796,6 +818,9 @@ namespace mtest {
         cs.Tref = ev(0);
       }
     }
+    // revert the current state, once all the integration points have
+    // been initialised
+    mtest::revert(ss);
     // failure criterion status
     s.setNumberOfFailureCriterionStatus(this->failure_criteria.size());
   }  // end of initializeCurrentState
@@ -875,14 +900,15 @@ namespace mtest {
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFile();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFile();
       report(nullptr, state, false);
       throw;
     }
+    this->flushOutputFile();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -932,14 +958,43 @@ namespace mtest {
     const auto psz = this->getNumberOfUnknowns();
     // clear
     wk.K.clear();
+    wk.sK.clear();
+    wk.csK.clear();
     wk.p_lu.clear();
     wk.x.clear();
     wk.r.clear();
     wk.du.clear();
     // resizing
-    wk.K.resize(psz, psz);
-    wk.p_lu.resize(psz);
-    wk.x.resize(psz);
+    wk.storage = this->kstorage;
+    if ((wk.storage == SolverWorkSpace::SKYLINESTORAGE) ||
+        (wk.storage == SolverWorkSpace::SPARSESTORAGE)) {
+      // the radial displacements of the nodes of an element are coupled
+      // to each other. The axial strain, which is the last unknown, is
+      // coupled to all the radial displacements.
+      const auto bw = [this]() -> size_type {
+        if (this->mesh.etype == PipeMesh::LINEAR) {
+          return 1;
+        } else if (this->mesh.etype == PipeMesh::QUADRATIC) {
+          return 2;
+        } else if (this->mesh.etype != PipeMesh::CUBIC) {
+          tfel::raise(
+              "PipeTest::initializeWorkSpace: "
+              "unknown element type");
+        }
+        return 3;
+      }();
+      if (wk.storage == SolverWorkSpace::SKYLINESTORAGE) {
+        wk.sK.resize(tfel::math::SkylineMatrix<real>::getBandedProfile(
+            this->getNumberOfNodes(), bw, 1));
+      } else {
+        wk.csK.resize(tfel::math::CSRMatrix<real>::getBandedPattern(
+            this->getNumberOfNodes(), bw, 1));
+      }
+    } else {
+      wk.K.resize(psz, psz);
+      wk.p_lu.resize(psz);
+      wk.x.resize(psz);
+    }
     wk.r.resize(psz, 0.);
     wk.du.resize(psz, 0.);
   }  // end of initializeWorkSpace
@@ -1055,6 +1110,38 @@ namespace mtest {
     return {false, 1};
   }  // end of PipeTest
 
+  std::pair<bool, real> PipeTest::computePredictionStiffnessAndResidual(
+      StudyCurrentState&,
+      tfel::math::SkylineMatrix<real>&,
+      tfel::math::vector<real>&,
+      const real&,
+      const real&,
+      const StiffnessMatrixType) const {
+    return {false, 1};
+  }  // end of computePredictionStiffnessAndResidual
+
+  std::pair<bool, real> PipeTest::computePredictionStiffnessAndResidual(
+      StudyCurrentState&,
+      tfel::math::CSRMatrix<real>&,
+      tfel::math::vector<real>&,
+      const real&,
+      const real&,
+      const StiffnessMatrixType) const {
+    return {false, 1};
+  }  // end of computePredictionStiffnessAndResidual
+
+  static void PipeTest_zero(tfel::math::matrix<real>& k) {
+    std::fill(k.begin(), k.end(), real(0));
+  }  // end of PipeTest_zero
+
+  static void PipeTest_zero(tfel::math::SkylineMatrix<real>& k) {
+    k.zero();
+  }  // end of PipeTest_zero
+
+  static void PipeTest_zero(tfel::math::CSRMatrix<real>& k) {
+    k.zero();
+  }  // end of PipeTest_zero
+
   std::pair<bool, real> PipeTest::computeStiffnessMatrixAndResidual(
       StudyCurrentState& state,
       tfel::math::matrix<real>& k,
@@ -1062,6 +1149,37 @@ namespace mtest {
       const real t,
       const real dt,
       const StiffnessMatrixType mt) const {
+    return this->assembleStiffnessMatrixAndResidual(state, k, r, t, dt, mt);
+  }  // end of computeStiffnessMatrixAndResidual
+
+  std::pair<bool, real> PipeTest::computeStiffnessMatrixAndResidual(
+      StudyCurrentState& state,
+      tfel::math::SkylineMatrix<real>& k,
+      tfel::math::vector<real>& r,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    return this->assembleStiffnessMatrixAndResidual(state, k, r, t, dt, mt);
+  }  // end of computeStiffnessMatrixAndResidual
+
+  std::pair<bool, real> PipeTest::computeStiffnessMatrixAndResidual(
+      StudyCurrentState& state,
+      tfel::math::CSRMatrix<real>& k,
+      tfel::math::vector<real>& r,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    return this->assembleStiffnessMatrixAndResidual(state, k, r, t, dt, mt);
+  }  // end of computeStiffnessMatrixAndResidual
+
+  template <typename StiffnessMatrix>
+  std::pair<bool, real> PipeTest::assembleStiffnessMatrixAndResidual(
+      StudyCurrentState& state,
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
     using LE = PipeLinearElement;
     using QE = PipeQuadraticElement;
     using CE = PipeCubicElement;
@@ -1069,7 +1187,7 @@ namespace mtest {
     // reset r and k
     std::fill(r.begin(), r.end(), real(0));
     if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-      std::fill(k.begin(), k.end(), real(0));
+      PipeTest_zero(k);
     }
     // current pipe state
     auto& scs = state.getStructureCurrentState("");
@@ -1234,34 +1352,132 @@ namespace mtest {
         r(n) -= state.getEvolution("AxialForce")(t + dt);
       }
     }
-    // loop over the elements
-    auto r_dt = real{};
-    for (size_type i = 0; i != ne; ++i) {
-      auto ri = std::pair<bool, real>{};
+    // number of Gauss points per element
+    const auto ng = scs.istates.size() / ne;
+    this->tangent_operators.resize(scs.istates.size());
+    auto& Kt = this->behaviour_tangent_operators;
+    if (Kt.size() != scs.istates.size()) {
+      const auto& kb = scs.getBehaviourWorkSpace().k;
+      Kt.assign(scs.istates.size(),
+                tfel::math::matrix<real>(kb.getNbRows(), kb.getNbCols()));
+    }
+    auto results = std::vector<std::pair<bool, real>>(ne, {false, real{}});
+    // integration of the behaviour on the elements in [ib, ie[. The
+    // behaviour is integrated on all the Gauss points of those
+    // elements in one call, so that the batched entry point of the
+    // behaviour is used, if available.
+    auto integrate = [this, &state, &scs, &Kt, &results, dt, mt, ng](
+                         BehaviourWorkSpace& bwk, const size_type ib,
+                         const size_type ie) {
+      for (auto i = ib; i != ie; ++i) {
+        if (this->mesh.etype == PipeMesh::LINEAR) {
+          LE::computeStrain(scs, this->mesh, state.u1, i, true);
+        } else if (this->mesh.etype == PipeMesh::QUADRATIC) {
+          QE::computeStrain(scs, this->mesh, state.u1, i, true);
+        } else if (this->mesh.etype == PipeMesh::CUBIC) {
+          CE::computeStrain(scs, this->mesh, state.u1, i, true);
+        } else {
+          tfel::raise(
+              "PipeTest::computeStiffnessMatrixAndResidual: "
+              "unknown element type");
+        }
+      }
+      const auto pb = ng * ib;
+      const auto np = ng * (ie - ib);
+      setRoundingMode();
+      const auto rb = this->b->integrateBatch(
+          std::span<tfel::math::matrix<real>>(Kt).subspan(pb, np),
+          std::span<CurrentState>(&scs.istates[pb], np), bwk, dt, mt);
+      setRoundingMode();
+      for (auto i = ib; i != ie; ++i) {
+        auto& ri = results[i];
+        ri = {true, real{}};
+        for (size_type g = 0; g != ng; ++g) {
+          const auto& rg = rb[(i - ib) * ng + g];
+          ri.second = (g == 0) ? rg.second : std::min(rg.second, ri.second);
+          ri.first = ri.first && rg.first;
+        }
+        if ((!ri.first) || (mt == StiffnessMatrixType::NOSTIFFNESS)) {
+          continue;
+        }
+        for (size_type g = 0; g != ng; ++g) {
+          const auto& kg = Kt[ng * i + g];
+          auto& Kg = this->tangent_operators[ng * i + g];
+          for (unsigned short l = 0; l != 3; ++l) {
+            for (unsigned short c = 0; c != 3; ++c) {
+              Kg(l, c) = kg(l, c);
+            }
+          }
+        }
+      }
+    };
+    // assembly of the inner forces and of the stiffness matrix
+    auto assemble = [this, &k, &r, &scs, mt](const size_type i) {
+      const auto& K = this->tangent_operators;
       if (this->mesh.etype == PipeMesh::LINEAR) {
-        ri = LE::updateStiffnessMatrixAndInnerForces(
-            k, r, scs, *(this->b), state.u1, this->mesh, dt, mt, i);
+        LE::updateStiffnessMatrixAndInnerForces(k, r, scs, K, this->mesh, mt,
+                                                i);
       } else if (this->mesh.etype == PipeMesh::QUADRATIC) {
-        ri = QE::updateStiffnessMatrixAndInnerForces(
-            k, r, scs, *(this->b), state.u1, this->mesh, dt, mt, i);
-      } else if (this->mesh.etype == PipeMesh::CUBIC) {
-        ri = CE::updateStiffnessMatrixAndInnerForces(
-            k, r, scs, *(this->b), state.u1, this->mesh, dt, mt, i);
+        QE::updateStiffnessMatrixAndInnerForces(k, r, scs, K, this->mesh, mt,
+                                                i);
       } else {
-        tfel::raise(
-            "PipeTest::computeStiffnessMatrixAndResidual: "
-            "unknown element type");
+        CE::updateStiffnessMatrixAndInnerForces(k, r, scs, K, this->mesh, mt,
+                                                i);
       }
+    };
+    if (this->pool == nullptr) {
+      // sequential integration
+      integrate(scs.getBehaviourWorkSpace(), 0, ne);
+    } else {
+      // parallel integration: the elements are split in contiguous
+      // ranges, each range being treated by one task with its own
+      // behaviour workspace. The workspaces are allocated beforehand
+      // since their allocation is not thread-safe.
+      const auto nt = std::min(this->pool->getNumberOfThreads(), ne);
+      using TaskResult = tfel::system::ThreadedTaskResult<void>;
+      auto tasks = std::vector<std::future<TaskResult>>{};
+      tasks.reserve(nt);
+      for (size_type c = 0; c != nt; ++c) {
+        auto& bwk = scs.getBehaviourWorkSpace(c);
+        const auto ib = (c * ne) / nt;
+        const auto ie = ((c + 1) * ne) / nt;
+        tasks.push_back(this->pool->addTask(
+            [&integrate, &bwk, ib, ie] { integrate(bwk, ib, ie); }));
+      }
+      // all the tasks must be finished before reporting an exception
+      auto tresults = std::vector<TaskResult>{};
+      tresults.reserve(nt);
+      for (auto& task : tasks) {
+        tresults.push_back(task.get());
+      }
+      for (auto& tr : tresults) {
+        if (!tr) {
+          tr.rethrow();
+        }
+      }
+    }
+    // sequential assembly, in the order of the elements, which gives
+    // the same results whatever the number of threads
+    auto r_dt = real{};
+    for (size_type i = 0; i != ne; ++i) {
+      const auto& ri = results[i];
       if (i == 0) {
         r_dt = ri.second;
       }
       r_dt = std::min(r_dt, ri.second);
       if (!ri.first) {
+        if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
+          auto& log = mfront::getLogStream();
+          log << "PipeTest::computeStiffnessMatrixAndResidual: "
+              << "behaviour integration failed in element " << i
+              << std::endl;
+        }
         return {false, r_dt};
       }
+      assemble(i);
     }
     return {true, r_dt};
-  }  // end of computeStiffnessMatrixAndResidual
+  }  // end of assembleStiffnessMatrixAndResidual
 
   void PipeTest::checkBehaviourConsistency(
       const std::shared_ptr<Behaviour>& bp) {
@@ -1492,6 +1708,21 @@ namespace mtest {
     tfel::raise("getNumberOfGaussPoints: unknown element type");
   }  // end of getNumberOfGaussPoints
 
+  static void PipeTest_back_substitute(SolverWorkSpace& wk,
+                                       tfel::math::vector<real>& du) {
+    if (wk.storage == SolverWorkSpace::SKYLINESTORAGE) {
+      tfel::math::SkylineLUSolve::back_substitute(wk.sK, du);
+    } else if (wk.storage == SolverWorkSpace::SPARSESTORAGE) {
+      // the preconditioner has been computed by the last resolution
+      const auto r = tfel::math::GMRESSolve::exe(wk.csK, wk.ilu, du);
+      tfel::raise_if(!r.converged,
+                     "PipeTest::computeLoadingCorrection: "
+                     "the iterative solver did not converge");
+    } else {
+      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+    }
+  }  // end of PipeTest_back_substitute
+
   void PipeTest::computeLoadingCorrection(StudyCurrentState& state,
                                           SolverWorkSpace& wk,
                                           const SolverOptions&,
@@ -1531,7 +1762,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      PipeTest_back_substitute(wk, du);
       setRoundingMode();
       const real due_dp = *(du.rbegin() + 1);
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1554,7 +1785,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      PipeTest_back_substitute(wk, du);
       setRoundingMode();
       const real du_dp = du[0];
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1580,7 +1811,7 @@ namespace mtest {
       std::fill(du.begin(), du.end(), real(0));
       du(n) = 1;
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      PipeTest_back_substitute(wk, du);
       setRoundingMode();
       const real dezz_dF = du(n);
       auto& F = state.getEvolution("AxialForce");
@@ -1688,41 +1919,45 @@ namespace mtest {
   void PipeTest::addOutput(const std::string& t, const std::string& n) {
     if (t == "minimum_value") {
       this->aoutputs.push_back(
-          {"minimum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMinimumValue(s, n);
+          {"minimum value of '" + n + "'", t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMinimumValue(s, n);
            }});
     } else if (t == "maximum_value") {
       this->aoutputs.push_back(
-          {"maximum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMaximumValue(s, n);
+          {"maximum value of '" + n + "'", t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMaximumValue(s, n);
            }});
     } else if (t == "integral_value_initial_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(s, n);
+           t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(s, n);
            }});
     } else if (t == "integral_value_current_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(
+           t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(
                  s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else if (t == "mean_value_initial_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n);
+           t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(s, n);
            }});
     } else if (t == "mean_value_current_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n,
-                                          Configuration::CURRENT_CONFIGURATION);
+           t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(s, n,
+                                           Configuration::CURRENT_CONFIGURATION);
            }});
     } else {
       tfel::raise(
@@ -2020,6 +2255,18 @@ namespace mtest {
     this->mesh.etype = ph;
   }  // end of setElementType
 
+  void PipeTest::setStiffnessMatrixStorage(
+      const SolverWorkSpace::StiffnessMatrixStorage ks) {
+    this->kstorage = ks;
+  }  // end of setStiffnessMatrixStorage
+
+  void PipeTest::setNumberOfThreads(const size_type n) {
+    tfel::raise_if(n == 0,
+                   "PipeTest::setNumberOfThreads: "
+                   "invalid number of threads");
+    this->number_of_threads = n;
+  }  // end of setNumberOfThreads
+
   void PipeTest::setMandrelRadiusEvolution(std::shared_ptr<Evolution> r) {
     this->mandrel_radius_evolution = r;
   }  // end of setMandrelRadiusEvolution
@@ -2135,13 +2382,47 @@ namespace mtest {
     this->T0 = T;
   }  // end of setFillingTemperature
 
+  std::vector<std::string> PipeTest::getOutputFileColumns() const {
+    auto c = std::vector<std::string>{"t",
+                                      "InnerRadius",
+                                      "OuterRadius",
+                                      "InnerRadiusDisplacement",
+                                      "OuterRadiusDisplacement",
+                                      "AxialDisplacement"};
+    if ((this->rl == IMPOSEDOUTERRADIUS) || (this->rl == IMPOSEDINNERRADIUS) ||
+        (this->rl == TIGHTPIPE) ||
+        (this->mandrel_radius_evolution != nullptr)) {
+      c.push_back("InnerPressure");
+    }
+    if ((this->al == IMPOSEDAXIALGROWTH) ||
+        (this->mandrel_axial_growth_evolution != nullptr)) {
+      c.push_back("AxialForce");
+    }
+    if (this->mandrel_radius_evolution != nullptr) {
+      c.push_back("MandrelContactIndicator");
+    }
+    for (const auto& ao : this->aoutputs) {
+      c.push_back(ao.n);
+    }
+    if (this->inner_boundary_oxidation_model.model != nullptr) {
+      c.push_back("InnerBoundaryOxidationLength");
+    }
+    if (this->outer_boundary_oxidation_model.model != nullptr) {
+      c.push_back("OuterBoundaryOxidationLength");
+    }
+    for (const auto& fc : this->failure_criteria) {
+      c.push_back("FailureCriterionStatus(" + fc->getName() + ")");
+    }
+    return c;
+  }  // end of getOutputFileColumns
+
   void PipeTest::printOutput(const real t,
                              const StudyCurrentState& state,
                              const bool o) const {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (!this->out) {
+    if ((this->bout == nullptr) && (!this->out)) {
       return;
     }
     const auto& u1 = state.u1;
@@ -2150,42 +2431,53 @@ namespace mtest {
     const auto Ri = this->mesh.inner_radius;
     // outer radius
     const auto Re = this->mesh.outer_radius;
-    this->out << t << " " << Ri + u1[0] << " " << Re + u1[n - 1] << " " << u1[0]
-              << " " << u1[n - 1] << " " << u1[n];
+    auto values = std::vector<real>{t,     Ri + u1[0],   Re + u1[n - 1],
+                                    u1[0], u1[n - 1], u1[n]};
     if ((this->rl == IMPOSEDOUTERRADIUS) || (this->rl == IMPOSEDINNERRADIUS) ||
         (this->rl == TIGHTPIPE) ||
         (this->mandrel_radius_evolution != nullptr)) {
-      this->out << " " << state.getEvolution("InnerPressure")(t);
+      values.push_back(state.getEvolution("InnerPressure")(t));
     }
     if ((this->al == IMPOSEDAXIALGROWTH) ||
         (this->mandrel_axial_growth_evolution != nullptr)) {
-      this->out << " " << state.getEvolution("AxialForce")(t);
+      values.push_back(state.getEvolution("AxialForce")(t));
     }
     if (this->mandrel_radius_evolution != nullptr) {
-      if (state.containsParameter("MandrelContactStateAtEndOfTimeStep")) {
-        if (state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep")) {
-          this->out << " " << 1;
-        } else {
-          this->out << " " << 0;
-        }
-      } else {
-        this->out << " " << 0;
-      }
+      const auto contact =
+          state.containsParameter("MandrelContactStateAtEndOfTimeStep") &&
+          state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep");
+      values.push_back(contact ? 1 : 0);
     }
     for (const auto& ao : this->aoutputs) {
-      this->out << " ";
-      ao.f(out, state);
+      values.push_back(ao.f(state));
     }
+    // in text files, the oxidation lengths are not separated from the
+    // previous column
+    const auto oxidation_lengths = values.size();
     if (this->inner_boundary_oxidation_model.model != nullptr) {
-      this->out << getOxidationLength(state,
-                                      this->inner_boundary_oxidation_model);
+      values.push_back(
+          getOxidationLength(state, this->inner_boundary_oxidation_model));
     }
     if (this->outer_boundary_oxidation_model.model != nullptr) {
-      this->out << getOxidationLength(state,
-                                      this->outer_boundary_oxidation_model);
+      values.push_back(
+          getOxidationLength(state, this->outer_boundary_oxidation_model));
     }
     for (std::size_t i = 0; i != this->failure_criteria.size(); ++i) {
-      this->out << " " << (state.getFailureCriterionStatus(i) ? 1 : 0);
+      values.push_back(state.getFailureCriterionStatus(i) ? 1 : 0);
+    }
+    if (this->bout != nullptr) {
+      this->bout->write(values);
+      return;
+    }
+    this->out << values[0];
+    for (std::size_t i = 1; i != values.size(); ++i) {
+      const auto glued =
+          (i >= oxidation_lengths) &&
+          (i < values.size() - this->failure_criteria.size());
+      if (!glued) {
+        this->out << " ";
+      }
+      this->out << values[i];
     }
     this->out << '\n';
   }  // end of printOutput
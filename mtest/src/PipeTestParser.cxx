@@ -228,6 +228,10 @@ namespace mtest {
     this->registerCallBack("@NumberOfElements",
                            &PipeTestParser::handleNumberOfElements);
     this->registerCallBack("@ElementType", &PipeTestParser::handleElementType);
+    this->registerCallBack("@StiffnessMatrixStorage",
+                           &PipeTestParser::handleStiffnessMatrixStorage);
+    this->registerCallBack("@NumberOfThreads",
+                           &PipeTestParser::handleNumberOfThreads);
     this->registerCallBack("@MandrelRadiusEvolution",
                            &PipeTestParser::handleMandrelRadiusEvolution);
     this->registerCallBack("@MandrelAxialGrowthEvolution",
@@ -383,6 +387,45 @@ namespace mtest {
                              this->tokens.end());
   }  // end of PipeTestParser::handleElementType
 
+  void PipeTestParser::handleStiffnessMatrixStorage(PipeTest& t,
+                                                    tokens_iterator& p) {
+    this->checkNotEndOfLine("PipeTestParser::handleStiffnessMatrixStorage", p,
+                            this->tokens.end());
+    const auto& s = this->readString(p, this->tokens.end());
+    if (s == "Skyline") {
+      t.setStiffnessMatrixStorage(SolverWorkSpace::SKYLINESTORAGE);
+    } else if (s == "Dense") {
+      t.setStiffnessMatrixStorage(SolverWorkSpace::DENSESTORAGE);
+    } else if (s == "Sparse") {
+      t.setStiffnessMatrixStorage(SolverWorkSpace::SPARSESTORAGE);
+    } else {
+      tfel::raise(
+          "PipeTestParser::handleStiffnessMatrixStorage: "
+          "invalid stiffness matrix storage ('" +
+          s +
+          "').\n"
+          "Valid storages are 'Skyline', 'Dense' and 'Sparse'");
+    }
+    this->checkNotEndOfLine("PipeTestParser::handleStiffnessMatrixStorage", p,
+                            this->tokens.end());
+    this->readSpecifiedToken("PipeTestParser::handleStiffnessMatrixStorage",
+                             ";", p, this->tokens.end());
+  }  // end of PipeTestParser::handleStiffnessMatrixStorage
+
+  void PipeTestParser::handleNumberOfThreads(PipeTest& t, tokens_iterator& p) {
+    this->checkNotEndOfLine("PipeTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    const auto n = this->readInt(p, this->tokens.end());
+    tfel::raise_if(n <= 0,
+                   "PipeTestParser::handleNumberOfThreads: "
+                   "invalid number of threads");
+    t.setNumberOfThreads(static_cast<PipeTest::size_type>(n));
+    this->checkNotEndOfLine("PipeTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    this->readSpecifiedToken("PipeTestParser::handleNumberOfThreads", ";", p,
+                             this->tokens.end());
+  }  // end of PipeTestParser::handleNumberOfThreads
+
   void PipeTestParser::handleGasEquationOfState(PipeTest& t,
                                                 tokens_iterator& p) {
     const auto& e = this->readString(p, this->tokens.end());
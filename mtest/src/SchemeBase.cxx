@@ -312,7 +312,17 @@ namespace mtest {
 
   void SchemeBase::resetOutputFile() {
     // output file
-    if (!this->output.empty()) {
+    if (this->output_format == BINARYFORMAT) {
+      // the text output is disabled
+      this->out.exceptions(std::ios::goodbit);
+      this->out.close();
+      this->out.setstate(std::ios::badbit);
+      this->bout.reset();
+      if ((!this->output.empty()) && (!this->output_columns.empty())) {
+        this->bout = std::make_unique<tfel::utilities::BinaryDataWriter>(
+            this->output, this->output_columns);
+      }
+    } else if (!this->output.empty()) {
       this->out.close();
       this->out.open(this->output.c_str());
       tfel::raise_if(!this->out,
@@ -445,6 +455,31 @@ namespace mtest {
     this->oprec = static_cast<int>(p);
   }
 
+  void SchemeBase::setOutputFileFormat(const OutputFileFormat f) {
+    tfel::raise_if(this->initialisationFinished,
+                   "SchemeBase::setOutputFileFormat: "
+                   "the output file format can't be changed "
+                   "after the initialisation");
+    this->output_format = f;
+  }  // end of setOutputFileFormat
+
+  void SchemeBase::setOutputFileColumns(const std::vector<std::string>& c) {
+    this->output_columns = c;
+    this->bout.reset();
+    if ((this->output_format == BINARYFORMAT) && (!this->output.empty())) {
+      this->bout = std::make_unique<tfel::utilities::BinaryDataWriter>(
+          this->output, this->output_columns);
+    }
+  }  // end of setOutputFileColumns
+
+  void SchemeBase::flushOutputFile() const {
+    if (this->bout) {
+      this->bout->flush();
+    } else {
+      this->out.flush();
+    }
+  }  // end of flushOutputFile
+
   void SchemeBase::setResidualFileName(const std::string& o) {
     tfel::raise_if(!this->residualFileName.empty(),
                    "SchemeBase::setResidualFileName : "
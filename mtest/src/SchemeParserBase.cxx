@@ -190,6 +190,23 @@ namespace mtest {
                              ";", p, this->tokens.end());
   }  // end of SchemeParserBase::handleOutputFilePrecision
 
+  void SchemeParserBase::handleOutputFileFormat(SchemeBase& t,
+                                                tokens_iterator& p) {
+    const auto v = this->readString(p, this->tokens.end());
+    if (v == "Text") {
+      t.setOutputFileFormat(SchemeBase::TEXTFORMAT);
+    } else if (v == "Binary") {
+      t.setOutputFileFormat(SchemeBase::BINARYFORMAT);
+    } else {
+      tfel::raise(
+          "SchemeParserBase::handleOutputFileFormat: "
+          "invalid format '" +
+          v + "'. Expected 'Text' or 'Binary'");
+    }
+    this->readSpecifiedToken("SchemeParserBase::handleOutputFileFormat", ";", p,
+                             this->tokens.end());
+  }  // end of SchemeParserBase::handleOutputFileFormat
+
   void SchemeParserBase::handleResidualFile(SchemeBase& t, tokens_iterator& p) {
     t.setResidualFileName(this->readString(p, this->tokens.end()));
     this->readSpecifiedToken("SchemeParserBase::handleResidualFiles", ";", p,
@@ -674,7 +691,8 @@ namespace mtest {
         }
         this->readSpecifiedToken("SchemeParserBase::parseEvolution", "}", p,
                                  this->tokens.end());
-        ev = std::shared_ptr<Evolution>(new LPIEvolution(tvalues, values));
+        ev = std::shared_ptr<Evolution>(
+            new TabulatedEvolution(std::move(tvalues), std::move(values)));
       } else {
         const real s = this->readDouble(t, p);
         ev = std::shared_ptr<Evolution>(new ConstantEvolution(s));
@@ -703,7 +721,8 @@ namespace mtest {
       } else {
         vv = data.getColumn(readUnsignedInt(p, this->tokens.end()));
       }
-      ev = std::shared_ptr<Evolution>(new LPIEvolution(tv, vv));
+      ev = std::shared_ptr<Evolution>(
+          new TabulatedEvolution(std::move(tv), std::move(vv)));
     } else {
       tfel::raise(
           "SchemeParserBase::parseEvolution: "
@@ -747,6 +766,7 @@ namespace mtest {
     add("@XMLOutputFile", &SchemeParserBase::handleXMLOutputFile);
     add("@OutputFrequency", &SchemeParserBase::handleOutputFrequency);
     add("@OutputFilePrecision", &SchemeParserBase::handleOutputFilePrecision);
+    add("@OutputFileFormat", &SchemeParserBase::handleOutputFileFormat);
     add("@ResidualFile", &SchemeParserBase::handleResidualFile);
     add("@ResidualFilePrecision",
         &SchemeParserBase::handleResidualFilePrecision);
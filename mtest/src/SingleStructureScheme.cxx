@@ -166,6 +166,11 @@ namespace mtest {
                    "SingleStructureScheme::setParameter: "
                    "no behaviour defined");
     this->b->setParameter(n, v);
+    // update the evolution associated with the parameter
+    const auto pev = this->evm->find(this->b->getBehaviourName() + "::" + n);
+    if (pev != this->evm->end()) {
+      pev->second->setValue(v);
+    }
   }
 
   void SingleStructureScheme::setIntegerParameter(const std::string& n,
@@ -319,14 +324,15 @@ namespace mtest {
                                                        const real dt) const {
     using namespace tfel::material;
     auto& scs = state.getStructureCurrentState("");
+    const auto& evm = (state.evm != nullptr) ? *(state.evm) : *(this->evm);
     // evaluations of the materials properties, state variables at the
     // end of the time step. Computation of thermal expansion if needed.
     for (auto& s : scs.istates) {
       this->setGaussPointPositionForEvolutionsEvaluation(s);
-      computeMaterialProperties(s, *(this->evm), *(this->dmpv),
+      computeMaterialProperties(s, evm, *(this->dmpv),
                                 this->b->getMaterialPropertiesNames(), t, dt);
       computeExternalStateVariables(
-          s, *(this->evm), this->b->expandExternalStateVariablesNames(), t, dt);
+          s, evm, this->b->expandExternalStateVariablesNames(), t, dt);
       // thermal expansion
       if ((this->handleThermalExpansion) &&
           ((this->b->getBehaviourType() ==
@@ -337,10 +343,10 @@ namespace mtest {
              MechanicalBehaviourBase::FINITESTRAINKINEMATIC_ETO_PK1)))) {
         if (this->b->getSymmetryType() == 0) {
           // isotropic case
-          computeThermalExpansion(s, *(this->evm), t, dt);
+          computeThermalExpansion(s, evm, t, dt);
         } else if (this->b->getSymmetryType() == 1) {
           // orthotropic case
-          computeThermalExpansion(s, *(this->evm), t, dt,
+          computeThermalExpansion(s, evm, t, dt,
                                   getSpaceDimension(this->hypothesis));
         } else {
           tfel::raise(
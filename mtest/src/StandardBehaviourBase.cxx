@@ -761,6 +761,15 @@ namespace mtest {
     elm.setParameter(this->library, this->behaviour, this->hypothesis, n, v);
   }  // end of setUnsignedIntegerParameter
 
+  bool StandardBehaviourBase::isThreadSafe() const {
+    // the behaviour must explicitly be declared reentrant, which is not
+    // the case of hand-written behaviours and of behaviours generated
+    // by older versions of MFront
+    using namespace tfel::system;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    return elm.isReentrant(this->library, this->behaviour);
+  }  // end of isThreadSafe
+
   std::vector<std::string>
   StandardBehaviourBase::getOptionalMaterialProperties() const {
     return {};
@@ -41,6 +41,10 @@ namespace mtest {
       static_cast<void>(m);
       cs = std::make_shared<CurrentState>(*cs);
     }
+    // workspaces are not shared with the original object, so that both
+    // objects can be used concurrently. They are allocated on demand.
+    copy.bwks.clear();
+    copy.model_wks.clear();
     return copy;
   }  // end of makeDeepCopy
 
@@ -61,18 +65,24 @@ namespace mtest {
   }
 
   BehaviourWorkSpace& StructureCurrentState::getBehaviourWorkSpace() const {
+    return this->getBehaviourWorkSpace(0);
+  }  // end of StructureCurrentState::getBehaviourWorkSpace
+
+  BehaviourWorkSpace& StructureCurrentState::getBehaviourWorkSpace(
+      const std::size_t i) const {
     using tfel::material::ModellingHypothesis;
-    if (this->bwks.empty()) {
+    while (this->bwks.size() <= i) {
       tfel::raise_if(this->b == nullptr,
                      "StructureCurrentState::getBehaviourWorkSpace: "
                      "behaviour not set");
       tfel::raise_if(this->h == ModellingHypothesis::UNDEFINEDHYPOTHESIS,
                      "StructureCurrentState::getBehaviourWorkSpace: "
                      "modelling hypothesis not set");
-      this->bwks.push_back(std::make_shared<BehaviourWorkSpace>());
-      this->b->allocateWorkSpace(*(this->bwks[0]));
+      auto wk = std::make_shared<BehaviourWorkSpace>();
+      this->b->allocateWorkSpace(*wk);
+      this->bwks.push_back(std::move(wk));
     }
-    return *(this->bwks[0]);
+    return *(this->bwks[i]);
   }  // end of StructureCurrentState::getBehaviourWorkSpace
 
   CurrentState& StructureCurrentState::getModelCurrentState(const Model& m) {
@@ -11,10 +11,59 @@
  * project under specific licensing conditions.
  */
 
+#include "TFEL/Raise.hxx"
 #include "MTest/Study.hxx"
 
 namespace mtest {
 
+  std::pair<bool, real> Study::computePredictionStiffnessAndResidual(
+      StudyCurrentState&,
+      tfel::math::SkylineMatrix<real>&,
+      tfel::math::vector<real>&,
+      const real&,
+      const real&,
+      const StiffnessMatrixType) const {
+    tfel::raise(
+        "Study::computePredictionStiffnessAndResidual: "
+        "skyline storage of the stiffness matrix is not supported");
+  }  // end of computePredictionStiffnessAndResidual
+
+  std::pair<bool, real> Study::computeStiffnessMatrixAndResidual(
+      StudyCurrentState&,
+      tfel::math::SkylineMatrix<real>&,
+      tfel::math::vector<real>&,
+      const real,
+      const real,
+      const StiffnessMatrixType) const {
+    tfel::raise(
+        "Study::computeStiffnessMatrixAndResidual: "
+        "skyline storage of the stiffness matrix is not supported");
+  }  // end of computeStiffnessMatrixAndResidual
+
+  std::pair<bool, real> Study::computePredictionStiffnessAndResidual(
+      StudyCurrentState&,
+      tfel::math::CSRMatrix<real>&,
+      tfel::math::vector<real>&,
+      const real&,
+      const real&,
+      const StiffnessMatrixType) const {
+    tfel::raise(
+        "Study::computePredictionStiffnessAndResidual: "
+        "sparse storage of the stiffness matrix is not supported");
+  }  // end of computePredictionStiffnessAndResidual
+
+  std::pair<bool, real> Study::computeStiffnessMatrixAndResidual(
+      StudyCurrentState&,
+      tfel::math::CSRMatrix<real>&,
+      tfel::math::vector<real>&,
+      const real,
+      const real,
+      const StiffnessMatrixType) const {
+    tfel::raise(
+        "Study::computeStiffnessMatrixAndResidual: "
+        "sparse storage of the stiffness matrix is not supported");
+  }  // end of computeStiffnessMatrixAndResidual
+
   Study::~Study() = default;
 
 }  // end of namespace mtest
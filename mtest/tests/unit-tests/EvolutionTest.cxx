@@ -16,6 +16,8 @@
 #endif /* NDEBUG */
 
 #include <cmath>
+#include <limits>
+#include <vector>
 #include <cstdlib>
 #include <iostream>
 #include <stdexcept>
@@ -32,6 +34,16 @@ struct EvolutionTestUnitTest final : public tfel::tests::TestCase {
   }  // end of EvolutionTestUnitTest
 
   tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute()
+  //! destructor
+  ~EvolutionTestUnitTest() override = default;
+
+ private:
+  void test1() {
     auto cev = mtest::make_evolution(12.);
     auto lev = mtest::make_evolution({{0., 2.}, {1., 3.}, {2., 4.}});
     auto lev2 = mtest::make_evolution({{0., 1.}});
@@ -51,10 +63,84 @@ struct EvolutionTestUnitTest final : public tfel::tests::TestCase {
     TFEL_TESTS_CHECK_THROW(lev->setValue(4.), std::runtime_error);
     TFEL_TESTS_CHECK_THROW(cev->setValue(2., 4.), std::runtime_error);
     TFEL_TESTS_CHECK_THROW(mtest::LPIEvolution({}, {})(2.), std::runtime_error);
-    return this->result;
-  }  // end of execute()
-  //! destructor
-  ~EvolutionTestUnitTest() override = default;
+  }  // end of test1
+  void test2() {
+    // comparison of tabulated evolutions and LPI evolutions on a long
+    // history given in an arbitrary order, with duplicated times
+    constexpr auto n = std::vector<double>::size_type{1000};
+    auto t = std::vector<double>{};
+    auto v = std::vector<double>{};
+    for (std::vector<double>::size_type i = 0; i != n; ++i) {
+      const auto j = (i * 337) % n;
+      t.push_back(0.1 * j);
+      v.push_back(std::sin(0.1 * j) + 0.01 * j);
+    }
+    t.push_back(0.5);
+    v.push_back(100.);
+    const auto lev = mtest::LPIEvolution(t, v);
+    const auto tev = mtest::TabulatedEvolution(t, v);
+    TFEL_TESTS_ASSERT(tev.getTimes().size() == n);
+    TFEL_TESTS_ASSERT(!tev.isConstant());
+    auto check = [this, &lev, &tev](const double x) {
+      TFEL_TESTS_ASSERT(std::abs(lev(x) - tev(x)) < 1.e-12);
+    };
+    // increasing times, decreasing times, random access
+    for (auto x = -1.; x < 101.; x += 0.037) {
+      check(x);
+    }
+    for (auto x = 101.; x > -1.; x -= 0.041) {
+      check(x);
+    }
+    for (std::vector<double>::size_type i = 0; i != 2 * n; ++i) {
+      check(0.05 * static_cast<double>((i * 7919) % (2 * n)));
+    }
+    // vectorized evaluation
+    auto times = std::vector<double>{};
+    for (auto x = -1.; x < 101.; x += 0.013) {
+      times.push_back(x);
+    }
+    times.push_back(3.);
+    auto r = std::vector<double>{};
+    tev.evaluate(r, times);
+    TFEL_TESTS_ASSERT(r.size() == times.size());
+    auto ok = true;
+    for (std::vector<double>::size_type i = 0; i != times.size(); ++i) {
+      ok = ok && (std::abs(r[i] - lev(times[i])) < 1.e-12);
+    }
+    TFEL_TESTS_ASSERT(ok);
+  }  // end of test2
+  void test3() {
+    // modifications of tabulated evolutions
+    auto ev = mtest::TabulatedEvolution({0., 1.}, {2., 3.});
+    TFEL_TESTS_ASSERT(std::abs(ev(0.5) - 2.5) < 1.e-14);
+    ev.setValue(2., 5.);
+    TFEL_TESTS_ASSERT(std::abs(ev(1.5) - 4.) < 1.e-14);
+    ev.setValue(0.5, 4.);
+    TFEL_TESTS_ASSERT(std::abs(ev(0.25) - 3.) < 1.e-14);
+    TFEL_TESTS_ASSERT(std::abs(ev(0.75) - 3.5) < 1.e-14);
+    ev.setValue(1., 1.);
+    TFEL_TESTS_ASSERT(std::abs(ev(1.5) - 3.) < 1.e-14);
+    TFEL_TESTS_ASSERT(ev.getTimes().size() == 4);
+    TFEL_TESTS_CHECK_THROW(ev.setValue(4.), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(mtest::TabulatedEvolution({0.}, {}),
+                           std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(mtest::TabulatedEvolution({}, {})(2.),
+                           std::runtime_error);
+    const auto cev = mtest::TabulatedEvolution({1.}, {3.});
+    TFEL_TESTS_ASSERT(cev.isConstant());
+    TFEL_TESTS_ASSERT(std::abs(cev(0.) - 3.) < 1.e-14);
+    TFEL_TESTS_ASSERT(std::abs(cev(2.) - 3.) < 1.e-14);
+    // non finite times are rejected
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    const auto inf = std::numeric_limits<double>::infinity();
+    TFEL_TESTS_CHECK_THROW(ev(nan), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(ev(inf), std::runtime_error);
+    auto r = std::vector<double>{};
+    TFEL_TESTS_CHECK_THROW(ev.evaluate(r, {0.5, nan}), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(ev.setValue(nan, 1.), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(mtest::TabulatedEvolution({0., nan}, {1., 2.}),
+                           std::runtime_error);
+  }  // end of test3
 };
 
 TFEL_TESTS_GENERATE_PROXY(EvolutionTestUnitTest, "EvolutionTestUnitTest");
@@ -0,0 +1,137 @@
+/*!
+ * \file   MTestSweepTest.cxx
+ * \brief  This file tests the `MTest::sweep` method
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "MTest/MTest.hxx"
+#include "MTest/Behaviour.hxx"
+
+//! \brief path to the library containing the behaviours
+static std::string library;
+//! \brief directory containing the input files
+static std::string directory;
+
+struct MTestSweepTest final : public tfel::tests::TestCase {
+  MTestSweepTest()
+      : tfel::tests::TestCase("MTest", "MTestSweepTest") {
+  }  // end of MTestSweepTest
+
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute()
+
+ private:
+  //! \brief read the given input file
+  static void read(mtest::MTest& m, const std::string& f) {
+    m.readInputFile(directory + "/" + f, {},
+                    {{"@library@", "\"" + library + "\""}});
+  }  // end of read
+  //! \brief the variants must lead to different results
+  void test1() {
+    constexpr auto eps = mtest::real(1.e-3);
+    const auto E = std::vector<mtest::real>{100.e9, 150.e9, 200.e9};
+    for (const auto n : {std::size_t{1}, std::size_t{3}}) {
+      auto m = mtest::MTest{};
+      read(m, "MTestSweepTest.mtest");
+      const auto r = m.sweep({{"YoungModulus", E}}, n);
+      const auto nt = r.times.size();
+      TFEL_TESTS_ASSERT(nt == 2u);
+      const auto& sxx = r.getOutput("SXX");
+      for (std::size_t i = 0; i != E.size(); ++i) {
+        TFEL_TESTS_ASSERT(r.errors[i].empty());
+        TFEL_TESTS_ASSERT(std::abs(sxx[i * nt + 1] - E[i] * eps) <
+                          1.e-8 * E[i]);
+      }
+    }
+  }  // end of test1
+  //! \brief evolutions used by an imposed constraint can't be swept
+  void test2() {
+    auto m = mtest::MTest{};
+    read(m, "MTestSweepTest2.mtest");
+    TFEL_TESTS_CHECK_THROW(m.sweep({{"YoungModulus", {100.e9, 200.e9}}}),
+                           std::runtime_error);
+    // `e0` is not read by the behaviour
+    TFEL_TESTS_CHECK_THROW(m.sweep({{"e0", {1.e-3, 2.e-3}}}),
+                           std::runtime_error);
+    // the Poisson ratio can be swept
+    const auto r = m.sweep({{"PoissonRatio", {0.2, 0.3}}});
+    TFEL_TESTS_ASSERT(r.errors[0].empty());
+    TFEL_TESTS_ASSERT(r.errors[1].empty());
+    const auto& eyy = r.getOutput("EYY");
+    TFEL_TESTS_ASSERT(std::abs(eyy[1] + 0.2e-3) < 1.e-10);
+    TFEL_TESTS_ASSERT(std::abs(eyy[3] + 0.3e-3) < 1.e-10);
+  }  // end of test2
+  //! \brief evolutions used by another evolution can't be swept
+  void test3() {
+    auto m = mtest::MTest{};
+    read(m, "MTestSweepTest3.mtest");
+    TFEL_TESTS_CHECK_THROW(m.sweep({{"YoungModulus", {100.e9, 200.e9}}}),
+                           std::runtime_error);
+  }  // end of test3
+  /*!
+   * \brief the values of the parameters of a behaviour generated with
+   * the `caller_owned_parameters` option are passed to each variant in
+   * a parameters block, so that the variants are treated in parallel
+   */
+  void test4() {
+    constexpr auto eps = mtest::real(1.e-3);
+    const auto E = std::vector<mtest::real>{100.e9, 150.e9, 200.e9};
+    auto m = mtest::MTest{};
+    read(m, "MTestSweepTest4.mtest");
+    TFEL_TESTS_ASSERT(m.getBehaviour()->allowsParametersBlock());
+    const auto r = m.sweep({{"YoungModulus", E}}, 3);
+    const auto nt = r.times.size();
+    TFEL_TESTS_ASSERT(nt == 2u);
+    const auto& sxx = r.getOutput("SXX");
+    for (std::size_t i = 0; i != E.size(); ++i) {
+      TFEL_TESTS_ASSERT(r.errors[i].empty());
+      TFEL_TESTS_ASSERT(std::abs(sxx[i * nt + 1] - E[i] * eps) <
+                        1.e-8 * E[i]);
+    }
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(MTestSweepTest, "MTestSweepTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  using namespace tfel::tests;
+  if (argc != 3) {
+    std::cerr << "MTestSweepTest: invalid number of arguments\n"
+              << "usage: MTestSweepTest library directory\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  directory = argv[2];
+  auto& m = TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("MTestSweepTest.xml");
+  const auto r = m.execute();
+  return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
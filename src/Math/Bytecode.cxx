@@ -0,0 +1,661 @@
+/*!
+ * \file   src/Math/Bytecode.cxx
+ * \brief  This file implements the `Bytecode` class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <limits>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/Function.hxx"
+#include "TFEL/Math/Parser/BinaryFunction.hxx"
+#include "TFEL/Math/Parser/BinaryOperator.hxx"
+#include "TFEL/Math/Parser/LogicalExpr.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
+
+namespace tfel::math::parser {
+
+  /*!
+   * \brief number of registers for which the evaluation does not
+   * require any memory allocation
+   */
+  static constexpr Bytecode::size_type Bytecode_maximumStackRegisters = 64;
+
+  //! \brief number of values treated at once by the `evaluate` method
+  static constexpr Bytecode::size_type Bytecode_blockSize = 64;
+
+  /*!
+   * \return the boolean value associated with a register holding the
+   * result of a logical expression, i.e. `0` or `1`.
+   * \param[in] v: value of the register
+   */
+  static bool Bytecode_isTrue(const double v) {
+    return v > 0.5;
+  }  // end of Bytecode_isTrue
+
+  Bytecode::Bytecode(const Expr& e, const std::vector<double>& v)
+      : variables(v) {
+    this->result = e.compile(*this);
+    this->finalize();
+  }  // end of Bytecode
+
+  Bytecode::size_type Bytecode::addRegister() {
+    this->constant_registers.push_back(false);
+    this->constant_values.push_back(0);
+    return this->nregisters++;
+  }  // end of addRegister
+
+  bool Bytecode::isConstant(const size_type r) const {
+    return this->constant_registers[r];
+  }  // end of isConstant
+
+  Bytecode::size_type Bytecode::addConstant(const double v) {
+    const auto k = std::bit_cast<std::uint64_t>(v);
+    const auto p = this->constants_registers.find(k);
+    if (p != this->constants_registers.end()) {
+      return p->second;
+    }
+    const auto r = this->addRegister();
+    this->constant_registers[r] = true;
+    this->constant_values[r] = v;
+    this->constants_registers.insert({k, r});
+    return r;
+  }  // end of addConstant
+
+  Bytecode::size_type Bytecode::addVariable(const Expr& e,
+                                            const std::vector<double>& v,
+                                            const size_type p) {
+    if (&v != &(this->variables)) {
+      return this->addExpression(e);
+    }
+    auto i = Instruction{};
+    i.op = LOAD;
+    i.a = p;
+    return this->addInstruction(i, Key{LOAD, p, 0, 0});
+  }  // end of addVariable
+
+  Bytecode::size_type Bytecode::addOperation(const OpCode op,
+                                             const size_type a) {
+    raise_if((op != NEGATE) && (op != NOT),
+             "Bytecode::addOperation: invalid unary operation");
+    auto i = Instruction{};
+    i.op = op;
+    i.a = a;
+    return this->addInstruction(i, Key{op, a, 0, 0});
+  }  // end of addOperation
+
+  Bytecode::size_type Bytecode::addOperation(const OpCode op,
+                                             const size_type a,
+                                             const size_type b) {
+    const auto commutative = (op == ADD) || (op == MULTIPLY) ||
+                             (op == EQUAL) || (op == AND) || (op == OR);
+    auto i = Instruction{};
+    i.op = op;
+    i.a = a;
+    i.b = b;
+    if (commutative) {
+      return this->addInstruction(
+          i, Key{op, std::min(a, b), std::max(a, b), 0});
+    }
+    return this->addInstruction(i, Key{op, a, b, 0});
+  }  // end of addOperation
+
+  Bytecode::size_type Bytecode::addFunctionCall(const UnaryFunctionPtr f,
+                                                const size_type a,
+                                                const bool check_errno) {
+    auto i = Instruction{};
+    i.op = check_errno ? CHECKED_CALL1 : CALL1;
+    i.a = a;
+    i.f1 = f;
+    return this->addInstruction(
+        i, Key{i.op, a, 0, reinterpret_cast<std::uintptr_t>(f)});
+  }  // end of addFunctionCall
+
+  Bytecode::size_type Bytecode::addFunctionCall(const BinaryFunctionPtr f,
+                                                const size_type a,
+                                                const size_type b) {
+    auto i = Instruction{};
+    i.op = CHECKED_CALL2;
+    i.a = a;
+    i.b = b;
+    i.f2 = f;
+    return this->addInstruction(
+        i, Key{i.op, a, b, reinterpret_cast<std::uintptr_t>(f)});
+  }  // end of addFunctionCall
+
+  Bytecode::size_type Bytecode::addExpression(const Expr& e) {
+    auto i = Instruction{};
+    i.op = EXPRESSION;
+    i.e = &e;
+    return this->addInstruction(
+        i, Key{EXPRESSION, 0, 0, reinterpret_cast<std::uintptr_t>(&e)});
+  }  // end of addExpression
+
+  Bytecode::size_type Bytecode::addLogicalExpression(const LogicalExpr& e) {
+    auto i = Instruction{};
+    i.op = LOGICAL_EXPRESSION;
+    i.l = &e;
+    return this->addInstruction(
+        i,
+        Key{LOGICAL_EXPRESSION, 0, 0, reinterpret_cast<std::uintptr_t>(&e)});
+  }  // end of addLogicalExpression
+
+  Bytecode::size_type Bytecode::addConditionalExpression(const LogicalExpr& c,
+                                                         const Expr& a,
+                                                         const Expr& b) {
+    const auto rc = c.compile(*this);
+    if (this->isConstant(rc)) {
+      // only the selected branch is compiled
+      if (Bytecode_isTrue(this->constant_values[rc])) {
+        return a.compile(*this);
+      }
+      return b.compile(*this);
+    }
+    const auto r = this->addRegister();
+    // instructions emitted in a branch can't be reused outside this
+    // branch
+    const auto emitted_before = this->emitted;
+    auto add_branch = [this, r, &emitted_before](const Expr& e) {
+      auto move = Instruction{};
+      move.op = MOVE;
+      move.d = r;
+      move.a = e.compile(*this);
+      this->instructions.push_back(move);
+      this->emitted = emitted_before;
+    };
+    auto jump_if_false = Instruction{};
+    jump_if_false.op = JUMP_IF_FALSE;
+    jump_if_false.a = rc;
+    const auto pj1 = this->instructions.size();
+    this->instructions.push_back(jump_if_false);
+    add_branch(a);
+    auto jump = Instruction{};
+    jump.op = JUMP;
+    const auto pj2 = this->instructions.size();
+    this->instructions.push_back(jump);
+    this->instructions[pj1].target = this->instructions.size();
+    add_branch(b);
+    this->instructions[pj2].target = this->instructions.size();
+    return r;
+  }  // end of addConditionalExpression
+
+  Bytecode::size_type Bytecode::addInstruction(Instruction i, const Key& k) {
+    const auto p = this->emitted.find(k);
+    if (p != this->emitted.end()) {
+      return p->second;
+    }
+    // constant folding
+    const auto nargs = [&i]() -> size_type {
+      switch (i.op) {
+        case NEGATE:
+        case NOT:
+        case CALL1:
+        case CHECKED_CALL1:
+          return 1;
+        case ADD:
+        case SUBSTRACT:
+        case MULTIPLY:
+        case DIVIDE:
+        case POWER:
+        case CHECKED_CALL2:
+        case EQUAL:
+        case GREATER:
+        case GREATER_OR_EQUAL:
+        case LESSER:
+        case LESSER_OR_EQUAL:
+        case AND:
+        case OR:
+          return 2;
+        default:
+          break;
+      }
+      // loading of variables and expressions evaluated by their
+      // `getValue` method can't be folded
+      return 0;
+    }();
+    if ((nargs != 0) && (this->isConstant(i.a)) &&
+        ((nargs == 1) || (this->isConstant(i.b)))) {
+      auto r = std::array<double, 3>{this->constant_values[i.a],
+                                     nargs == 2 ? this->constant_values[i.b]
+                                                : 0,
+                                     0};
+      auto fi = i;
+      fi.a = 0;
+      fi.b = 1;
+      fi.d = 2;
+      try {
+        Bytecode::execute(r.data(), nullptr, &fi, &fi + 1);
+        return this->addConstant(r[2]);
+      } catch (...) {
+        // the evaluation fails: the instruction is kept so that the
+        // error is reported at runtime, if this instruction is reached.
+      }
+    }
+    i.d = this->addRegister();
+    this->instructions.push_back(i);
+    this->emitted.insert({k, i.d});
+    return i.d;
+  }  // end of addInstruction
+
+  void Bytecode::finalize() {
+    // new numbering of the registers
+    auto nc = size_type{};
+    for (size_type r = 0; r != this->nregisters; ++r) {
+      if (this->constant_registers[r]) {
+        ++nc;
+      }
+    }
+    auto numbering = std::vector<size_type>(this->nregisters);
+    auto ic = size_type{};
+    auto iv = nc;
+    this->constants.resize(nc);
+    for (size_type r = 0; r != this->nregisters; ++r) {
+      if (this->constant_registers[r]) {
+        this->constants[ic] = this->constant_values[r];
+        numbering[r] = ic++;
+      } else {
+        numbering[r] = iv++;
+      }
+    }
+    for (auto& i : this->instructions) {
+      i.d = numbering[i.d];
+      if ((i.op != LOAD) && (i.op != EXPRESSION) &&
+          (i.op != LOGICAL_EXPRESSION) && (i.op != JUMP)) {
+        i.a = numbering[i.a];
+      }
+      if ((i.op != LOAD) && (i.op != EXPRESSION) &&
+          (i.op != LOGICAL_EXPRESSION)) {
+        i.b = numbering[i.b];
+      }
+    }
+    this->result = numbering[this->result];
+    // clean-up
+    this->constant_values.clear();
+    this->constant_registers.clear();
+    this->constants_registers.clear();
+    this->emitted.clear();
+  }  // end of finalize
+
+  void Bytecode::execute(double* const r,
+                         const double* const v,
+                         const Instruction* const pb,
+                         const Instruction* const pe) {
+    auto p = pb;
+    while (p != pe) {
+      const auto& i = *p;
+      switch (i.op) {
+        case LOAD:
+          r[i.d] = v[i.a];
+          break;
+        case ADD:
+          r[i.d] = r[i.a] + r[i.b];
+          break;
+        case SUBSTRACT:
+          r[i.d] = r[i.a] - r[i.b];
+          break;
+        case MULTIPLY:
+          r[i.d] = r[i.a] * r[i.b];
+          break;
+        case DIVIDE:
+          if (std::abs(r[i.b]) < std::numeric_limits<double>::min()) {
+            // OpDiv reports the error
+            r[i.d] = OpDiv::apply(r[i.a], r[i.b]);
+          } else {
+            r[i.d] = r[i.a] / r[i.b];
+          }
+          break;
+        case POWER:
+          r[i.d] = std::pow(r[i.a], r[i.b]);
+          break;
+        case NEGATE:
+          r[i.d] = -r[i.a];
+          break;
+        case CALL1:
+          r[i.d] = i.f1(r[i.a]);
+          break;
+        case CHECKED_CALL1: {
+          const auto arg = r[i.a];
+          const auto old = errno;
+          errno = 0;
+          r[i.d] = i.f1(arg);
+          if (errno != 0) {
+            const auto e = errno;
+            errno = old;
+            FunctionBase::throwInvalidCallException(arg, e);
+          }
+          errno = old;
+        } break;
+        case CHECKED_CALL2: {
+          const auto old = errno;
+          errno = 0;
+          r[i.d] = i.f2(r[i.a], r[i.b]);
+          if (errno != 0) {
+            const auto e = errno;
+            errno = old;
+            StandardBinaryFunctionBase::throwInvalidCallException(e);
+          }
+          errno = old;
+        } break;
+        case EQUAL:
+          r[i.d] = OpEqual::apply(r[i.a], r[i.b]) ? 1 : 0;
+          break;
+        case GREATER:
+          r[i.d] = (r[i.a] > r[i.b]) ? 1 : 0;
+          break;
+        case GREATER_OR_EQUAL:
+          r[i.d] = (r[i.a] >= r[i.b]) ? 1 : 0;
+          break;
+        case LESSER:
+          r[i.d] = (r[i.a] < r[i.b]) ? 1 : 0;
+          break;
+        case LESSER_OR_EQUAL:
+          r[i.d] = (r[i.a] <= r[i.b]) ? 1 : 0;
+          break;
+        case AND:
+          r[i.d] =
+              (Bytecode_isTrue(r[i.a]) && Bytecode_isTrue(r[i.b])) ? 1 : 0;
+          break;
+        case OR:
+          r[i.d] =
+              (Bytecode_isTrue(r[i.a]) || Bytecode_isTrue(r[i.b])) ? 1 : 0;
+          break;
+        case NOT:
+          r[i.d] = Bytecode_isTrue(r[i.a]) ? 0 : 1;
+          break;
+        case JUMP_IF_FALSE:
+          if (!Bytecode_isTrue(r[i.a])) {
+            p = pb + i.target;
+            continue;
+          }
+          break;
+        case JUMP:
+          p = pb + i.target;
+          continue;
+        case MOVE:
+          r[i.d] = r[i.a];
+          break;
+        case EXPRESSION:
+          r[i.d] = i.e->getValue();
+          break;
+        case LOGICAL_EXPRESSION:
+          r[i.d] = i.l->getValue() ? 1 : 0;
+          break;
+      }
+      ++p;
+    }
+  }  // end of execute
+
+  double Bytecode::getValue() const {
+    const auto* const pb = this->instructions.data();
+    const auto* const pe = pb + this->instructions.size();
+    const auto* const v = this->variables.data();
+    if (this->nregisters <= Bytecode_maximumStackRegisters) {
+      std::array<double, Bytecode_maximumStackRegisters> r;
+      std::copy(this->constants.begin(), this->constants.end(), r.begin());
+      Bytecode::execute(r.data(), v, pb, pe);
+      return r[this->result];
+    }
+    auto r = std::vector<double>(this->nregisters);
+    std::copy(this->constants.begin(), this->constants.end(), r.begin());
+    Bytecode::execute(r.data(), v, pb, pe);
+    return r[this->result];
+  }  // end of getValue
+
+  bool Bytecode::isVectorizable() const noexcept {
+    return std::none_of(
+        this->instructions.begin(), this->instructions.end(),
+        [](const Instruction& i) {
+          return (i.op == EXPRESSION) || (i.op == LOGICAL_EXPRESSION);
+        });
+  }  // end of isVectorizable
+
+  /*!
+   * \brief apply an unary operation to a block of values
+   * \param[in] r: registers
+   * \param[in] i: instruction
+   * \param[in] n: size of the block
+   * \param[in] op: operation
+   */
+  template <typename Operation>
+  static void Bytecode_apply(double* const r,
+                             const Bytecode::Instruction& i,
+                             const Bytecode::size_type n,
+                             const Operation& op) {
+    auto* const rd = r + i.d * Bytecode_blockSize;
+    const auto* const ra = r + i.a * Bytecode_blockSize;
+    for (Bytecode::size_type k = 0; k != n; ++k) {
+      rd[k] = op(ra[k]);
+    }
+  }  // end of Bytecode_apply
+
+  /*!
+   * \brief apply a binary operation to a block of values
+   * \param[in] r: registers
+   * \param[in] i: instruction
+   * \param[in] n: size of the block
+   * \param[in] op: operation
+   */
+  template <typename Operation>
+  static void Bytecode_apply2(double* const r,
+                              const Bytecode::Instruction& i,
+                              const Bytecode::size_type n,
+                              const Operation& op) {
+    auto* const rd = r + i.d * Bytecode_blockSize;
+    const auto* const ra = r + i.a * Bytecode_blockSize;
+    const auto* const rb = r + i.b * Bytecode_blockSize;
+    for (Bytecode::size_type k = 0; k != n; ++k) {
+      rd[k] = op(ra[k], rb[k]);
+    }
+  }  // end of Bytecode_apply2
+
+  bool Bytecode::execute(double* const r,
+                         std::span<const double* const> v,
+                         const size_type o,
+                         const size_type n,
+                         const Instruction* const pb,
+                         const Instruction* const pe) {
+    constexpr auto bs = Bytecode_blockSize;
+    auto p = pb;
+    while (p != pe) {
+      const auto& i = *p;
+      switch (i.op) {
+        case LOAD:
+          std::copy(v[i.a] + o, v[i.a] + o + n, r + i.d * bs);
+          break;
+        case ADD:
+          Bytecode_apply2(r, i, n,
+                          [](const double a, const double b) { return a + b; });
+          break;
+        case SUBSTRACT:
+          Bytecode_apply2(r, i, n,
+                          [](const double a, const double b) { return a - b; });
+          break;
+        case MULTIPLY:
+          Bytecode_apply2(r, i, n,
+                          [](const double a, const double b) { return a * b; });
+          break;
+        case DIVIDE: {
+          const auto* const ra = r + i.a * bs;
+          const auto* const rb = r + i.b * bs;
+          for (size_type k = 0; k != n; ++k) {
+            if (std::abs(rb[k]) < std::numeric_limits<double>::min()) {
+              // OpDiv reports the error
+              OpDiv::apply(ra[k], rb[k]);
+            }
+          }
+          Bytecode_apply2(r, i, n,
+                          [](const double a, const double b) { return a / b; });
+        } break;
+        case POWER:
+          Bytecode_apply2(r, i, n, [](const double a, const double b) {
+            return std::pow(a, b);
+          });
+          break;
+        case NEGATE:
+          Bytecode_apply(r, i, n, [](const double a) { return -a; });
+          break;
+        case CALL1:
+          Bytecode_apply(r, i, n, i.f1);
+          break;
+        case CHECKED_CALL1: {
+          const auto old = errno;
+          errno = 0;
+          Bytecode_apply(r, i, n, i.f1);
+          if (errno != 0) {
+            // look for the faulty argument
+            const auto* const ra = r + i.a * bs;
+            for (size_type k = 0; k != n; ++k) {
+              errno = 0;
+              i.f1(ra[k]);
+              if (errno != 0) {
+                const auto e = errno;
+                errno = old;
+                FunctionBase::throwInvalidCallException(ra[k], e);
+              }
+            }
+          }
+          errno = old;
+        } break;
+        case CHECKED_CALL2: {
+          const auto old = errno;
+          errno = 0;
+          Bytecode_apply2(r, i, n, i.f2);
+          if (errno != 0) {
+            const auto e = errno;
+            errno = old;
+            StandardBinaryFunctionBase::throwInvalidCallException(e);
+          }
+          errno = old;
+        } break;
+        case EQUAL:
+          Bytecode_apply2(r, i, n, [](const double a, const double b) {
+            return OpEqual::apply(a, b) ? 1. : 0.;
+          });
+          break;
+        case GREATER:
+          Bytecode_apply2(r, i, n, [](const double a, const double b) {
+            return (a > b) ? 1. : 0.;
+          });
+          break;
+        case GREATER_OR_EQUAL:
+          Bytecode_apply2(r, i, n, [](const double a, const double b) {
+            return (a >= b) ? 1. : 0.;
+          });
+          break;
+        case LESSER:
+          Bytecode_apply2(r, i, n, [](const double a, const double b) {
+            return (a < b) ? 1. : 0.;
+          });
+          break;
+        case LESSER_OR_EQUAL:
+          Bytecode_apply2(r, i, n, [](const double a, const double b) {
+            return (a <= b) ? 1. : 0.;
+          });
+          break;
+        case AND:
+          Bytecode_apply2(r, i, n, [](const double a, const double b) {
+            return (Bytecode_isTrue(a) && Bytecode_isTrue(b)) ? 1. : 0.;
+          });
+          break;
+        case OR:
+          Bytecode_apply2(r, i, n, [](const double a, const double b) {
+            return (Bytecode_isTrue(a) || Bytecode_isTrue(b)) ? 1. : 0.;
+          });
+          break;
+        case NOT:
+          Bytecode_apply(r, i, n, [](const double a) {
+            return Bytecode_isTrue(a) ? 0. : 1.;
+          });
+          break;
+        case JUMP_IF_FALSE: {
+          const auto* const ra = r + i.a * bs;
+          const auto nt = std::count_if(ra, ra + n, Bytecode_isTrue);
+          if (nt == 0) {
+            p = pb + i.target;
+            continue;
+          }
+          if (static_cast<size_type>(nt) != n) {
+            return false;
+          }
+        } break;
+        case JUMP:
+          p = pb + i.target;
+          continue;
+        case MOVE:
+          Bytecode_apply(r, i, n, [](const double a) { return a; });
+          break;
+        case EXPRESSION:
+        case LOGICAL_EXPRESSION:
+          raise("Bytecode::execute: unsupported instruction");
+      }
+      ++p;
+    }
+    return true;
+  }  // end of execute
+
+  void Bytecode::evaluate(std::span<const double* const> v,
+                          std::span<double> out) const {
+    constexpr auto bs = Bytecode_blockSize;
+    raise_if(!this->isVectorizable(),
+             "Bytecode::evaluate: "
+             "the bytecode is not vectorizable");
+    raise_if(v.size() != this->variables.size(),
+             "Bytecode::evaluate: "
+             "invalid number of variables");
+    const auto* const pb = this->instructions.data();
+    const auto* const pe = pb + this->instructions.size();
+    // registers used to treat the values by blocks
+    auto r = std::vector<double>(this->nregisters * bs);
+    for (size_type c = 0; c != this->constants.size(); ++c) {
+      std::fill(r.begin() + c * bs, r.begin() + (c + 1) * bs,
+                this->constants[c]);
+    }
+    // registers and values of the variables used to treat the values
+    // one by one
+    auto rs = std::vector<double>(this->nregisters);
+    auto vs = std::vector<double>(v.size());
+    std::copy(this->constants.begin(), this->constants.end(), rs.begin());
+    for (size_type o = 0; o < out.size(); o += bs) {
+      const auto n = std::min(bs, out.size() - o);
+      if (Bytecode::execute(r.data(), v, o, n, pb, pe)) {
+        const auto* const pr = r.data() + this->result * bs;
+        std::copy(pr, pr + n, out.begin() + o);
+        continue;
+      }
+      // divergent branches
+      for (size_type k = o; k != o + n; ++k) {
+        for (size_type j = 0; j != v.size(); ++j) {
+          vs[j] = v[j][k];
+        }
+        Bytecode::execute(rs.data(), vs.data(), pb, pe);
+        out[k] = rs[this->result];
+      }
+    }
+  }  // end of evaluate
+
+  Bytecode::size_type Bytecode::getNumberOfInstructions() const noexcept {
+    return this->instructions.size();
+  }  // end of getNumberOfInstructions
+
+  Bytecode::size_type Bytecode::getNumberOfRegisters() const noexcept {
+    return this->nregisters;
+  }  // end of getNumberOfRegisters
+
+  const std::vector<Bytecode::Instruction>& Bytecode::getInstructions()
+      const noexcept {
+    return this->instructions;
+  }  // end of getInstructions
+
+}  // end of namespace tfel::math::parser
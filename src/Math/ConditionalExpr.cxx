@@ -44,6 +44,11 @@ namespace tfel::math::parser {
     return this->b->getValue();
   }  // end of ConditionalExpr::getValue() const
 
+  std::vector<double>::size_type ConditionalExpr::compile(
+      Bytecode& bc) const {
+    return bc.addConditionalExpression(*(this->c), *(this->a), *(this->b));
+  }  // end of ConditionalExpr::compile
+
   std::string ConditionalExpr::getCxxFormula(
       const std::vector<std::string>& m) const {
     return "(" + this->c->getCxxFormula(m) + ") ? " + "(" +
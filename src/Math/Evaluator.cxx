@@ -1235,7 +1235,70 @@ namespace tfel::math {
     return this->getValue();
   }  // end of getValue
 
+  void Evaluator::evaluate(std::span<const std::span<const double>> columns,
+                           std::span<double> out) {
+    using size_type = std::vector<double>::size_type;
+    raise_if(this->expr == nullptr,
+             "Evaluator::evaluate: "
+             "uninitialized expression.");
+    raise_if(columns.size() != this->variables.size(),
+             "Evaluator::evaluate: invalid number of columns "
+             "(" +
+                 std::to_string(columns.size()) + " given, " +
+                 std::to_string(this->variables.size()) + " expected)");
+    // values of the variables, sorted by position
+    auto values = std::vector<const double*>(this->variables.size());
+    auto i = size_type{};
+    for (const auto& p : this->positions) {
+      raise_if(columns[i].size() != out.size(),
+               "Evaluator::evaluate: invalid size of the values of "
+               "variable '" +
+                   p.first + "'");
+      values[p.second] = columns[i].data();
+      ++i;
+    }
+    auto eval = [this, &values, &out](const tfel::math::parser::Bytecode& c) {
+      if (c.isVectorizable()) {
+        c.evaluate(values, out);
+        return;
+      }
+      // some nodes are evaluated by their `getValue` method which
+      // requires the values of the variables
+      for (size_type k = 0; k != out.size(); ++k) {
+        for (size_type j = 0; j != values.size(); ++j) {
+          this->variables[j] = values[j][k];
+        }
+        out[k] = c.getValue();
+      }
+    };
+    if (this->bytecode != nullptr) {
+      eval(*(this->bytecode));
+    } else {
+      eval(tfel::math::parser::Bytecode(*(this->expr), this->variables));
+    }
+  }  // end of evaluate
+
+  void Evaluator::compile() {
+    raise_if(this->expr == nullptr,
+             "Evaluator::compile: "
+             "uninitialized expression.");
+    this->bytecode = std::make_unique<tfel::math::parser::Bytecode>(
+        *(this->expr), this->variables);
+  }  // end of compile
+
+  bool Evaluator::isCompiled() const noexcept {
+    return this->bytecode != nullptr;
+  }  // end of isCompiled
+
+  const tfel::math::parser::Bytecode* Evaluator::getBytecode()
+      const noexcept {
+    return this->bytecode.get();
+  }  // end of getBytecode
+
   double Evaluator::getValue() const {
+    if (this->bytecode != nullptr) {
+      return this->bytecode->getValue();
+    }
     raise_if(this->expr == nullptr,
              "Evaluator::getValue: "
              "uninitialized expression.");
@@ -1299,6 +1362,9 @@ namespace tfel::math {
     this->manager = src.manager;
     if (src.expr != nullptr) {
       this->expr = src.expr->clone(this->variables);
+      if (src.isCompiled()) {
+        this->compile();
+      }
     }
   }  // end of Evaluator
 
@@ -1307,8 +1373,12 @@ namespace tfel::math {
       this->variables = src.variables;
       this->positions = src.positions;
       this->manager = src.manager;
+      this->bytecode.reset();
       if (src.expr != nullptr) {
         this->expr = src.expr->clone(this->variables);
+        if (src.isCompiled()) {
+          this->compile();
+        }
       } else {
         this->expr.reset();
       }
@@ -1346,6 +1416,7 @@ namespace tfel::math {
   }  // end of Evaluator
 
   void Evaluator::clear() {
+    this->bytecode.reset();
     this->variables.clear();
     this->positions.clear();
     this->expr.reset();
@@ -1448,12 +1519,18 @@ namespace tfel::math {
     this->checkCyclicDependency();
     auto f = std::make_shared<Evaluator>(*this);
     f->expr = f->expr->resolveDependencies(f->variables);
+    if (f->isCompiled()) {
+      f->compile();
+    }
     return f;
   }  // end of resolveDependencies() const
 
   void Evaluator::removeDependencies() {
     this->checkCyclicDependency();
     this->expr = this->expr->resolveDependencies(this->variables);
+    if (this->isCompiled()) {
+      this->compile();
+    }
   }  // end of removeDependencies() const
 
   std::shared_ptr<tfel::math::parser::ExternalFunctionManager>
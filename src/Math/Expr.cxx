@@ -19,6 +19,10 @@
 
 namespace tfel::math::parser {
 
+  std::vector<double>::size_type Expr::compile(Bytecode& c) const {
+    return c.addExpression(*this);
+  }  // end of compile
+
   Expr::~Expr() = default;
 
   void mergeVariablesNames(std::vector<std::string>& v,
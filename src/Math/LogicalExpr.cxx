@@ -79,6 +79,10 @@ namespace tfel::math::parser {
     return '(' + a + ")||(" + b + ')';
   }  // end of OpOr::getCxxFormula
 
+  std::vector<double>::size_type LogicalExpr::compile(Bytecode& c) const {
+    return c.addLogicalExpression(*this);
+  }  // end of compile
+
   LogicalExpr::~LogicalExpr() = default;
 
   NegLogicalExpression::NegLogicalExpression(
@@ -98,6 +102,11 @@ namespace tfel::math::parser {
     return !this->a->getValue();
   }  // end of getValue
 
+  std::vector<double>::size_type NegLogicalExpression::compile(
+      Bytecode& c) const {
+    return c.addOperation(Bytecode::NOT, this->a->compile(c));
+  }  // end of compile
+
   std::string NegLogicalExpression::getCxxFormula(
       const std::vector<std::string>& m) const {
     return "!(" + this->a->getCxxFormula(m) + ")";
@@ -36,6 +36,10 @@ namespace tfel::math::parser {
     return -(this->expr->getValue());
   }  // end of getValue()
 
+  std::vector<double>::size_type Negation::compile(Bytecode& c) const {
+    return c.addOperation(Bytecode::NEGATE, this->expr->compile(c));
+  }  // end of compile
+
   void Negation::checkCyclicDependency(std::vector<std::string>& names) const {
     this->expr->checkCyclicDependency(names);
   }  // end of checkCyclicDependency
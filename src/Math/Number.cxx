@@ -39,6 +39,10 @@ namespace tfel::math::parser {
 
   double Number::getValue() const { return this->value; }  // end of getValue
 
+  std::vector<double>::size_type Number::compile(Bytecode& c) const {
+    return c.addConstant(this->value);
+  }  // end of compile
+
   void Number::getParametersNames(std::set<std::string>&) const {
   }  // end of getParametersNames
 
@@ -35,6 +35,10 @@ namespace tfel::math::parser {
     return this->v[this->pos];
   }  // end of Variable::getValue
 
+  std::vector<double>::size_type Variable::compile(Bytecode& c) const {
+    return c.addVariable(*this, this->v, this->pos);
+  }  // end of Variable::compile
+
   std::string Variable::getCxxFormula(const std::vector<std::string>& m) const {
     tfel::raise_if(this->pos >= m.size(),
                    "Variable::getCxxFormula: "
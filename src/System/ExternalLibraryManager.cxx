@@ -13,6 +13,7 @@
 
 #include <cctype>
 #include <cstring>
+#include <sstream>
 #include <fstream>
 #include <stdexcept>
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
@@ -116,6 +117,42 @@ namespace tfel::system {
     return r;
   }  // end of decomposeVariableName
 
+  /*!
+   * \brief parse a metadata record exported by `MFront`
+   * \return the values of the symbols described by the record. An empty
+   * map is returned if the version of the record is not supported.
+   * \param[in] r: record
+   */
+  static std::map<std::string, std::vector<std::string>, std::less<>>
+  parseMetaData(const std::string& r) {
+    auto m = std::map<std::string, std::vector<std::string>, std::less<>>{};
+    auto in = std::istringstream{r};
+    auto line = std::string{};
+    if ((!std::getline(in, line)) || (line != "mfront_metadata 1")) {
+      return m;
+    }
+    while (std::getline(in, line)) {
+      const auto p = line.rfind(' ');
+      if ((p == std::string::npos) || (p == 0)) {
+        return {};
+      }
+      auto n = std::size_t{};
+      try {
+        n = std::stoul(line.substr(p + 1));
+      } catch (...) {
+        return {};
+      }
+      auto values = std::vector<std::string>(n);
+      for (auto& v : values) {
+        if (!std::getline(in, v)) {
+          return {};
+        }
+      }
+      m.insert({line.substr(0, p), std::move(values)});
+    }
+    return m;
+  }  // end of parseMetaData
+
   ExternalLibraryManager& ExternalLibraryManager::getExternalLibraryManager() {
     static ExternalLibraryManager elm;
     return elm;
@@ -307,8 +344,7 @@ namespace tfel::system {
     auto throw_if = [l, f](const bool c, const std::string& m) {
       raise_if(c, "ExternalLibraryManager::getMaterialKnowledgeType: " + m);
     };
-    const auto lib = this->loadLibrary(l);
-    const int nb = ::tfel_getUnsignedShort(lib, (f + "_mfront_mkt").c_str());
+    const int nb = this->getUnsignedShort(l, f, "", "mfront_mkt");
     throw_if(nb == -1,
              "the material knowledge type could not be read "
              "(" +
@@ -436,6 +472,11 @@ namespace tfel::system {
     return this->getStringIfDefined(l, f + "_tfel_version");
   }  // end of getTFELVersion
 
+  bool ExternalLibraryManager::isReentrant(const std::string& l,
+                                           const std::string& f) {
+    return this->getUnsignedShort(l, f, "", "reentrant") == 1;
+  }  // end of isReentrant
+
   std::string ExternalLibraryManager::getUnitSystem(const std::string& l,
                                                     const std::string& f) {
     return this->getStringIfDefined(l, f + "_unit_system");
@@ -445,9 +486,15 @@ namespace tfel::system {
   ExternalLibraryManager::getSupportedModellingHypotheses(
       const std::string& l, const std::string& f) {
     std::vector<std::string> h;
+    const auto nb = this->getUnsignedShort(l, f, "", "nModellingHypotheses");
+    if (const auto* const v =
+            this->getMetaData(l, f, "", "ModellingHypotheses");
+        (nb != -1) && (v != nullptr) &&
+        (v->size() >= static_cast<std::size_t>(nb))) {
+      h.insert(h.end(), v->begin(), v->begin() + nb);
+      return h;
+    }
     const auto lib = this->loadLibrary(l);
-    const auto nb =
-        ::tfel_getUnsignedShort(lib, (f + "_nModellingHypotheses").c_str());
     char** res;
     raise_if(nb == -1,
              "ExternalLibraryManager::"
@@ -920,12 +967,7 @@ namespace tfel::system {
   bool ExternalLibraryManager::getUMATRequiresStiffnessTensor(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    int res;
-    const auto lib = this->loadLibrary(l);
-    res = ::tfel_getUMATRequiresStiffnessTensor(lib, (f + "_" + h).c_str());
-    if (res < 0) {
-      res = ::tfel_getUMATRequiresStiffnessTensor(lib, f.c_str());
-    }
+    const auto res = this->getUnsignedShort(l, f, h, "requiresStiffnessTensor");
     raise_if(res < 0,
              "ExternalLibraryManager::getUMATRequiresStiffnessTensor: "
              "information could not be read (" +
@@ -942,13 +984,8 @@ namespace tfel::system {
   bool ExternalLibraryManager::getUMATRequiresThermalExpansionCoefficientTensor(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    auto lib = this->loadLibrary(l);
-    auto res = ::tfel_getUMATRequiresThermalExpansionCoefficientTensor(
-        lib, (f + "_" + h).c_str());
-    if (res < 0) {
-      res = ::tfel_getUMATRequiresThermalExpansionCoefficientTensor(lib,
-                                                                    f.c_str());
-    }
+    const auto res = this->getUnsignedShort(
+        l, f, h, "requiresThermalExpansionCoefficientTensor");
     raise_if(res < 0,
              "ExternalLibraryManager::"
              "getUMATRequiresThermalExpansionCoefficientTensor: "
@@ -1081,6 +1118,46 @@ namespace tfel::system {
     return fct;
   }
 
+  bool ExternalLibraryManager::hasGenericBehaviourBatchFunction(
+      const std::string& l, const std::string& f) {
+    return this->contains(l, f + "_batch");
+  }  // end of hasGenericBehaviourBatchFunction
+
+  GenericBehaviourBatchFctPtr
+  ExternalLibraryManager::getGenericBehaviourBatchFunction(
+      const std::string& l, const std::string& f) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct =
+        ::tfel_getGenericBehaviourBatchFunction(lib, (f + "_batch").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::getGenericBehaviourBatchFunction: "
+             "could not load the batched entry point of generic behaviour "
+             "function '" +
+                 f + "' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourBatchFunction
+
+  bool ExternalLibraryManager::hasGenericBehaviourFunctionWithParameters(
+      const std::string& l, const std::string& f) {
+    return this->contains(l, f + "_with_parameters");
+  }  // end of hasGenericBehaviourFunctionWithParameters
+
+  GenericBehaviourWithParametersFctPtr
+  ExternalLibraryManager::getGenericBehaviourFunctionWithParameters(
+      const std::string& l, const std::string& f) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericBehaviourFunctionWithParameters(
+        lib, (f + "_with_parameters").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourFunctionWithParameters: "
+             "could not load the entry point of generic behaviour "
+             "function '" +
+                 f + "' taking the values of the parameters (" +
+                 getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourFunctionWithParameters
+
   std::vector<std::string>
   ExternalLibraryManager::getGenericBehaviourInitializeFunctions(
       const std::string& l, const std::string& f, const std::string& h) {
@@ -1289,12 +1366,7 @@ namespace tfel::system {
   bool ExternalLibraryManager::isUMATBehaviourAbleToComputeInternalEnergy(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    const auto lib = this->loadLibrary(l);
-    auto b =
-        ::tfel_getBool(lib, (f + "_" + h + "_ComputesInternalEnergy").c_str());
-    if (b == -1) {
-      b = ::tfel_getBool(lib, (f + "_ComputesInternalEnergy").c_str());
-    }
+    const auto b = this->getUnsignedShort(l, f, h, "ComputesInternalEnergy");
     if (b == -1) {
       return false;
     }
@@ -1304,12 +1376,7 @@ namespace tfel::system {
   bool ExternalLibraryManager::isUMATBehaviourAbleToComputeDissipatedEnergy(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    const auto lib = this->loadLibrary(l);
-    auto b = ::tfel_getBool(
-        lib, (f + "_" + h + "_ComputesDissipatedEnergy").c_str());
-    if (b == -1) {
-      b = ::tfel_getBool(lib, (f + "_ComputesDissipatedEnergy").c_str());
-    }
+    const auto b = this->getUnsignedShort(l, f, h, "ComputesDissipatedEnergy");
     if (b == -1) {
       return false;
     }
@@ -1553,14 +1620,14 @@ namespace tfel::system {
     if (!h.empty()) {
       ExternalLibraryManagerCheckModellingHypothesisName(h);
     }
-    const auto lib = this->loadLibrary(l);
-    auto nb = -1;
-    if (!h.empty()) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_" + h + "_n" + n).c_str());
-    }
-    if (nb == -1) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_n" + n).c_str());
+    const auto nb = this->getUnsignedShort(l, f, h, "n" + n);
+    if (const auto* const v = this->getMetaData(l, f, h, n);
+        (nb != -1) && (v != nullptr) &&
+        (v->size() >= static_cast<std::size_t>(nb))) {
+      vars.insert(vars.end(), v->begin(), v->begin() + nb);
+      return;
     }
+    const auto lib = this->loadLibrary(l);
     raise_if(nb == -1,
              "ExternalLibraryManager::getUMATNames: "
              "number of variables names could not be read "
@@ -1589,14 +1656,16 @@ namespace tfel::system {
     if (!h.empty()) {
       ExternalLibraryManagerCheckModellingHypothesisName(h);
     }
-    const auto lib = this->loadLibrary(l);
-    auto nb = -1;
-    if (!h.empty()) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_" + h + "_n" + n).c_str());
-    }
-    if (nb == -1) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_n" + n).c_str());
+    const auto nb = this->getUnsignedShort(l, f, h, "n" + n);
+    if (const auto* const v = this->getMetaData(l, f, h, n + "Types");
+        (nb != -1) && (v != nullptr) &&
+        (v->size() >= static_cast<std::size_t>(nb))) {
+      for (auto p = v->begin(); p != v->begin() + nb; ++p) {
+        types.push_back(std::stoi(*p));
+      }
+      return;
     }
+    const auto lib = this->loadLibrary(l);
     raise_if(nb == -1,
              "ExternalLibraryManager::getUMATTypes: "
              "number of variables names could not be read "
@@ -1618,16 +1687,55 @@ namespace tfel::system {
     std::copy(res, res + nb, std::back_inserter(types));
   }  // end of getUMATTypes
 
+  const std::vector<std::string>* ExternalLibraryManager::getMetaData(
+      const std::string& l,
+      const std::string& f,
+      const std::string& h,
+      const std::string& n) {
+    auto find = [this, &l, &n](const std::string& p)
+        -> const std::vector<std::string>* {
+      auto& records = this->metadata[l];
+      auto pr = records.find(p);
+      if (pr == records.end()) {
+        const auto r = this->getStringIfDefined(l, p + "_mfront_metadata");
+        pr = records.insert({p, parseMetaData(r)}).first;
+      }
+      const auto pv = pr->second.find(n);
+      return pv != pr->second.end() ? &(pv->second) : nullptr;
+    };
+    std::lock_guard<std::mutex> lock(this->metadata_mutex);
+    if (!h.empty()) {
+      if (const auto* const v = find(f + '_' + h); v != nullptr) {
+        return v;
+      }
+    }
+    return find(f);
+  }  // end of getMetaData
+
+  int ExternalLibraryManager::getUnsignedShort(const std::string& l,
+                                               const std::string& f,
+                                               const std::string& h,
+                                               const std::string& n) {
+    if (const auto* const v = this->getMetaData(l, f, h, n);
+        (v != nullptr) && (v->size() == 1)) {
+      return std::stoi(v->front());
+    }
+    const auto lib = this->loadLibrary(l);
+    auto r = -1;
+    if (!h.empty()) {
+      r = ::tfel_getUnsignedShort(lib, (f + '_' + h + '_' + n).c_str());
+    }
+    if (r == -1) {
+      r = ::tfel_getUnsignedShort(lib, (f + '_' + n).c_str());
+    }
+    return r;
+  }  // end of getUnsignedShort
+
   bool ExternalLibraryManager::isUMATBehaviourUsableInPurelyImplicitResolution(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    const auto lib = this->loadLibrary(l);
-    int b = ::tfel_getBool(
-        lib, (f + "_" + h + "_UsableInPurelyImplicitResolution").c_str());
-    if (b == -1) {
-      b = ::tfel_getBool(lib,
-                         (f + "_UsableInPurelyImplicitResolution").c_str());
-    }
+    const auto b =
+        this->getUnsignedShort(l, f, h, "UsableInPurelyImplicitResolution");
     if (b == -1) {
       return false;
     }
@@ -1650,8 +1758,7 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getUMATBehaviourType(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u = ::tfel_getUnsignedShort(lib, (f + "_BehaviourType").c_str());
+    const auto u = this->getUnsignedShort(l, f, "", "BehaviourType");
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATBehaviourType: "
              "behaviour type could not be read (" +
@@ -1661,9 +1768,7 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getUMATBehaviourKinematic(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u =
-        ::tfel_getUnsignedShort(lib, (f + "_BehaviourKinematic").c_str());
+    const auto u = this->getUnsignedShort(l, f, "", "BehaviourKinematic");
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATBehaviourKinematic: "
              "behaviour type could not be read (" +
@@ -1673,8 +1778,7 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getUMATSymmetryType(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u = ::tfel_getUnsignedShort(lib, (f + "_SymmetryType").c_str());
+    const auto u = this->getUnsignedShort(l, f, "", "SymmetryType");
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATSymmetryType: "
              "symmetry type could not be read (" +
@@ -1684,9 +1788,7 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getUMATElasticSymmetryType(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u =
-        ::tfel_getUnsignedShort(lib, (f + "_ElasticSymmetryType").c_str());
+    const auto u = this->getUnsignedShort(l, f, "", "ElasticSymmetryType");
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATElasticSymmetryType: "
              "elastic symmetry type could not be read "
@@ -1802,15 +1904,14 @@ namespace tfel::system {
   bool
   ExternalLibraryManager::hasTemperatureBeenRemovedFromExternalStateVariables(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto s = f + "_TemperatureRemovedFromExternalStateVariables";
-    const auto u = ::tfel_getUnsignedShort(lib, s.c_str());
+    const auto u = this->getUnsignedShort(
+        l, f, "", "TemperatureRemovedFromExternalStateVariables");
     if (u == -1) {
       tfel::raise(
           "ExternalLibraryManager::"
           "hasTemperatureBeenRemovedFromExternalStateVariables: "
           "undefined symbol '" +
-          s + "'");
+          f + "_TemperatureRemovedFromExternalStateVariables'");
     }
     return u == 1;
   }  // end of hasTemperatureBeenRemovedFromExternalStateVariables
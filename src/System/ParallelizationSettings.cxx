@@ -0,0 +1,83 @@
+/*!
+ * \file   src/System/ParallelizationSettings.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+#include "TFEL/Raise.hxx"
+#include "TFEL/System/ParallelizationSettings.hxx"
+
+namespace tfel::system {
+
+  static ThreadPool::size_type readSizeFromEnvironment(
+      const char* const n, const ThreadPool::size_type v) {
+    const auto e = std::getenv(n);
+    if (e == nullptr) {
+      return v;
+    }
+    auto r = ThreadPool::size_type{};
+    auto pos = std::size_t{};
+    try {
+      r = static_cast<ThreadPool::size_type>(std::stoul(e, &pos));
+    } catch (std::exception&) {
+      pos = 0;
+    }
+    tfel::raise_if((pos == 0) || (e[pos] != '\0'),
+                   "getParallelizationSettings: invalid value '" +
+                       std::string(e) + "' for the environment variable '" +
+                       std::string(n) + "'");
+    return r;
+  }  // end of readSizeFromEnvironment
+
+  static ParallelizationSettings readParallelizationSettings() {
+    auto s = ParallelizationSettings{};
+    // the `ABAQUSEXPLICIT_NTHREADS` environment variable was used by the
+    // behaviours generated by the `Abaqus/Explicit` interface before the
+    // introduction of `TFEL_NUMBER_OF_THREADS`, with a default of 4
+    // threads
+    const auto n = readSizeFromEnvironment(
+        "TFEL_NUMBER_OF_THREADS",
+        readSizeFromEnvironment("ABAQUSEXPLICIT_NTHREADS", 4));
+    s.number_of_threads = std::max(n, ThreadPool::size_type{1});
+    s.grain_size = readSizeFromEnvironment("TFEL_GRAIN_SIZE", 0);
+    const auto p = std::getenv("TFEL_PARTITIONING");
+    if (p != nullptr) {
+      const auto v = std::string(p);
+      if (v == "static") {
+        s.partitioning = ThreadPool::Partitioning::STATIC;
+      } else if (v == "dynamic") {
+        s.partitioning = ThreadPool::Partitioning::DYNAMIC;
+      } else if (v == "guided") {
+        s.partitioning = ThreadPool::Partitioning::GUIDED;
+      } else {
+        tfel::raise(
+            "getParallelizationSettings: invalid value '" + v +
+            "' for the environment variable 'TFEL_PARTITIONING' "
+            "(expected 'static', 'dynamic' or 'guided')");
+      }
+    }
+    return s;
+  }  // end of readParallelizationSettings
+
+  const ParallelizationSettings& getParallelizationSettings() {
+    static const auto s = readParallelizationSettings();
+    return s;
+  }  // end of getParallelizationSettings
+
+  ThreadPool& getSharedThreadPool() {
+    static ThreadPool pool(getParallelizationSettings().number_of_threads - 1);
+    return pool;
+  }  // end of getSharedThreadPool
+
+}  // end of namespace tfel::system
@@ -11,37 +11,117 @@
  * project under specific licensing conditions.
  */
 
+#include <deque>
 #include <memory>
+#include <algorithm>
 #include <stdexcept>
 #include "TFEL/System/ThreadPool.hxx"
 
 namespace tfel::system {
 
+  //! \brief pool to which the current thread belongs, if any
+  static thread_local const ThreadPool* current_pool = nullptr;
+  //! \brief index of the current thread in its pool
+  static thread_local ThreadPool::size_type current_worker = 0;
+
+  struct ThreadPool::WorkQueue {
+    //! \brief mutex protecting the tasks
+    std::mutex m;
+    //! \brief tasks
+    std::deque<std::function<void()>> tasks;
+  };  // end of struct ThreadPool::WorkQueue
+
+  struct ThreadPool::ParallelForState {
+    /*!
+     * \brief retrieve the next chunk to be treated
+     * \return false if all the chunks have been distributed
+     * \param[out] ib: first index of the chunk
+     * \param[out] ie: past-the-end index of the chunk
+     */
+    bool take(size_type& ib, size_type& ie) {
+      if (this->divisor == 0) {
+        // chunks of fixed size
+        ib = this->next.fetch_add(this->grain);
+        if (ib >= this->e) {
+          return false;
+        }
+        ie = ib + std::min(this->grain, this->e - ib);
+        return true;
+      }
+      // the size of the chunk is proportional to the number of
+      // remaining indices
+      ib = this->next.load();
+      while (ib < this->e) {
+        const auto r = this->e - ib;
+        const auto s = std::min(std::max(r / this->divisor, this->grain), r);
+        if (this->next.compare_exchange_weak(ib, ib + s)) {
+          ie = ib + s;
+          return true;
+        }
+      }
+      return false;
+    }  // end of take
+    //! \brief treat chunks until none is left
+    void work() {
+      size_type ib, ie;
+      while ((!this->failed) && (this->take(ib, ie))) {
+        try {
+          (*(this->f))(ib, ie);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(this->m);
+          if (!this->error) {
+            this->error = std::current_exception();
+          }
+          this->failed = true;
+        }
+      }
+    }  // end of work
+    //! \brief function treating a chunk
+    const std::function<void(size_type, size_type)>* f;
+    //! \brief past-the-end index
+    size_type e;
+    //! \brief number of indices per chunk, or minimal size of a chunk
+    size_type grain;
+    /*!
+     * \brief if not null, the size of a chunk is the number of
+     * remaining indices divided by this value (guided partitioning)
+     */
+    size_type divisor = 0;
+    //! \brief first index of the next chunk to be treated
+    std::atomic<size_type> next{0};
+    //! \brief number of helper tasks not finished
+    size_type helpers = 0;
+    //! \brief flag set if a call to `f` failed
+    std::atomic<bool> failed{false};
+    //! \brief first exception thrown
+    std::exception_ptr error;
+    // synchronization
+    std::mutex m;
+    std::condition_variable c;
+  };  // end of struct ThreadPool::ParallelForState
+
   ThreadPool::ThreadPool(const size_t n) {
-    this->statuses.resize(n, ThreadPool::Status::IDLE);
+    for (size_t i = 0; i < n; ++i) {
+      this->queues.push_back(std::make_unique<WorkQueue>());
+    }
     for (size_t i = 0; i < n; ++i) {
       auto f = [this, i] {
+        current_pool = this;
+        current_worker = i;
         for (;;) {
           std::function<void()> task;
-          {
-            std::unique_lock<std::mutex> lock(this->m);
-            while (!(this->stop || !this->tasks.empty())) {
-              this->c.wait(
-                  lock, [this] { return this->stop || !this->tasks.empty(); });
-            }
-            if (this->stop && this->tasks.empty()) {
-              return;
-            }
-            task = std::move(this->tasks.front());
-            this->tasks.pop();
-            this->statuses[i] = ThreadPool::Status::WORKING;
-            this->c.notify_all();
+          if (this->pop(task, i)) {
+            task();
+            this->finish();
+            continue;
           }
-          task();
-          {
-            std::unique_lock<std::mutex> lock(this->m);
-            this->statuses[i] = ThreadPool::Status::IDLE;
-            this->c.notify_all();
+          std::unique_lock<std::mutex> lock(this->m);
+          ++(this->sleeping);
+          this->c.wait(lock,
+                       [this] { return this->stop || this->queued != 0; });
+          --(this->sleeping);
+          if (this->stop && this->queued == 0) {
+            return;
           }
         }
       };
@@ -53,17 +133,159 @@ namespace tfel::system {
     return this->workers.size();
   }  // end of ThreadPool::getNumberOfThreads
 
-  void ThreadPool::wait() {
-    std::unique_lock<std::mutex> lock(this->m);
-    while (!this->tasks.empty()) {
-      this->c.wait(lock, [this] { return this->tasks.empty(); });
+  void ThreadPool::push(std::function<void()> t) {
+    if (this->queues.empty()) {
+      throw std::runtime_error("ThreadPool::addTask: empty pool");
+    }
+    {
+      std::unique_lock<std::mutex> lock(this->m);
+      // don't allow enqueueing after stopping the pool
+      if (this->stop) {
+        throw std::runtime_error(
+            "ThreadPool::addTask: "
+            "enqueue on stopped ThreadPool");
+      }
     }
-    for (size_t i = 0; i != this->statuses.size(); ++i) {
-      while (this->statuses[i] != Status::IDLE) {
-        this->c.wait(lock,
-                     [this, i] { return this->statuses[i] == Status::IDLE; });
+    const auto i = (current_pool == this)
+                       ? current_worker
+                       : (this->next_queue++) % this->queues.size();
+    ++(this->active);
+    {
+      auto& q = *(this->queues[i]);
+      std::lock_guard<std::mutex> lock(q.m);
+      q.tasks.push_back(std::move(t));
+    }
+    ++(this->queued);
+    // a worker increments `sleeping` before checking `queued`: either
+    // it sees the new task, or it is notified here.
+    if (this->sleeping != 0) {
+      std::lock_guard<std::mutex> lock(this->m);
+    }
+    this->c.notify_one();
+  }  // end of ThreadPool::push
+
+  bool ThreadPool::pop(std::function<void()>& t, const size_type i) {
+    const auto n = this->queues.size();
+    if (this->queued == 0) {
+      return false;
+    }
+    {
+      auto& q = *(this->queues[i]);
+      std::lock_guard<std::mutex> lock(q.m);
+      if (!q.tasks.empty()) {
+        t = std::move(q.tasks.back());
+        q.tasks.pop_back();
+        --(this->queued);
+        return true;
       }
     }
+    for (size_type j = 1; j != n; ++j) {
+      auto& q = *(this->queues[(i + j) % n]);
+      std::lock_guard<std::mutex> lock(q.m);
+      if (!q.tasks.empty()) {
+        t = std::move(q.tasks.front());
+        q.tasks.pop_front();
+        --(this->queued);
+        return true;
+      }
+    }
+    return false;
+  }  // end of ThreadPool::pop
+
+  bool ThreadPool::executePendingTask() {
+    if (this->queues.empty()) {
+      return false;
+    }
+    const auto i = (current_pool == this) ? current_worker : 0;
+    std::function<void()> task;
+    if (!this->pop(task, i)) {
+      return false;
+    }
+    task();
+    this->finish();
+    return true;
+  }  // end of ThreadPool::executePendingTask
+
+  void ThreadPool::finish() {
+    if (--(this->active) == 0) {
+      std::lock_guard<std::mutex> lock(this->m);
+      this->finished.notify_all();
+    }
+  }  // end of ThreadPool::finish
+
+  void ThreadPool::parallelFor(
+      const Partitioning p,
+      const size_type b,
+      const size_type e,
+      const size_type g,
+      const std::function<void(size_type, size_type)>& f) {
+    if (e <= b) {
+      return;
+    }
+    const auto n = e - b;
+    const auto nt = this->workers.size();
+    // number of threads taking part in the work, including the caller
+    const auto nthr = nt + 1;
+    auto grain = size_type{};
+    if (p == Partitioning::STATIC) {
+      grain = std::max((n + nthr - 1) / nthr, g);
+    } else if (p == Partitioning::DYNAMIC) {
+      grain = (g != 0) ? g : std::max(n / (4 * nthr), size_type{1});
+    } else {
+      grain = std::max(g, size_type{1});
+    }
+    // upper bound of the number of chunks
+    const auto nchunks = (n + grain - 1) / grain;
+    if ((nt == 0) || (nchunks == 1)) {
+      f(b, e);
+      return;
+    }
+    ParallelForState s;
+    s.f = &f;
+    s.e = e;
+    s.grain = grain;
+    if (p == Partitioning::GUIDED) {
+      s.divisor = 2 * nthr;
+    }
+    s.next = b;
+    s.helpers = std::min(nt, nchunks - 1);
+    const auto nh = s.helpers;
+    for (size_type i = 0; i != nh; ++i) {
+      this->push([ps = &s] {
+        ps->work();
+        std::lock_guard<std::mutex> lock(ps->m);
+        if (--(ps->helpers) == 0) {
+          ps->c.notify_all();
+        }
+      });
+    }
+    // the calling thread takes part in the work
+    s.work();
+    // the helpers must be finished before leaving, since they refer to
+    // `s`. Pending tasks are treated meanwhile, so that nested calls
+    // from a worker can't dead-lock.
+    for (;;) {
+      {
+        std::lock_guard<std::mutex> lock(s.m);
+        if (s.helpers == 0) {
+          break;
+        }
+      }
+      if (!this->executePendingTask()) {
+        // all the remaining helpers are being executed
+        std::unique_lock<std::mutex> lock(s.m);
+        s.c.wait(lock, [&s] { return s.helpers == 0; });
+        break;
+      }
+    }
+    if (s.error) {
+      std::rethrow_exception(s.error);
+    }
+  }  // end of ThreadPool::parallelFor
+
+  void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(this->m);
+    this->finished.wait(lock, [this] { return this->active == 0; });
   }  // end of ThreadPool::wait()
 
   ThreadPool::~ThreadPool() {
@@ -0,0 +1,303 @@
+/*!
+ * \file   src/Utilities/BinaryData.cxx
+ * \brief  This file implements the `BinaryData` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <bit>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <string_view>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/MappedFile.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
+
+namespace tfel::utilities {
+
+  //! \brief magic string starting the files following the `npy` format
+  static constexpr std::string_view BinaryData_magic = "\x93NUMPY";
+
+  /*!
+   * \brief a minimal parser of the description of the array stored in a
+   * file following the `npy` format. This description is a `python`
+   * dictionary containing the keys `descr`, `fortran_order` and `shape`.
+   */
+  struct BinaryData_HeaderParser {
+    //! \brief description of a field
+    struct Field {
+      //! \brief name of the field
+      std::string name;
+      //! \brief type of the field
+      std::string type;
+    };
+    /*!
+     * \brief constructor
+     * \param[in] h: header
+     * \param[in] f: file name
+     */
+    BinaryData_HeaderParser(const std::string_view h, const std::string& f)
+        : header(h), file(f) {
+      this->expect('{');
+      while (!this->consume('}')) {
+        const auto key = this->readString();
+        this->expect(':');
+        if (key == "descr") {
+          if (this->consume('[')) {
+            while (!this->consume(']')) {
+              auto fd = Field{};
+              this->expect('(');
+              fd.name = this->readString();
+              this->expect(',');
+              fd.type = this->readString();
+              this->consume(',');
+              this->throw_if(!this->consume(')'),
+                             "unsupported description of field '" +
+                                 fd.name + "'");
+              this->fields.push_back(std::move(fd));
+              this->consume(',');
+            }
+            this->structured = true;
+          } else {
+            this->fields.push_back({"", this->readString()});
+          }
+        } else if (key == "fortran_order") {
+          this->skipSpaces();
+          if (this->header.substr(this->pos, 4) == "True") {
+            this->fortran_order = true;
+            this->pos += 4;
+          } else if (this->header.substr(this->pos, 5) == "False") {
+            this->fortran_order = false;
+            this->pos += 5;
+          } else {
+            this->throw_if(true, "invalid value for 'fortran_order'");
+          }
+        } else if (key == "shape") {
+          this->expect('(');
+          while (!this->consume(')')) {
+            this->shape.push_back(this->readInteger());
+            this->consume(',');
+          }
+        } else {
+          this->throw_if(true, "unsupported key '" + key + "'");
+        }
+        this->consume(',');
+      }
+      this->throw_if(this->fields.empty(), "no description of the data");
+    }  // end of BinaryData_HeaderParser
+    //! \brief fields
+    std::vector<Field> fields;
+    //! \brief shape of the array
+    std::vector<std::size_t> shape;
+    //! \brief if true, the array is an array of records
+    bool structured = false;
+    //! \brief if true, the array is stored by columns
+    bool fortran_order = false;
+
+   private:
+    void throw_if(const bool b, const std::string& m) const {
+      raise_if(b, "BinaryData::BinaryData: " + m + " (file '" + this->file +
+                      "')");
+    }  // end of throw_if
+    void skipSpaces() {
+      while ((this->pos != this->header.size()) &&
+             ((this->header[this->pos] == ' ') ||
+              (this->header[this->pos] == '\t'))) {
+        ++(this->pos);
+      }
+    }  // end of skipSpaces
+    bool consume(const char c) {
+      this->skipSpaces();
+      if ((this->pos != this->header.size()) &&
+          (this->header[this->pos] == c)) {
+        ++(this->pos);
+        return true;
+      }
+      return false;
+    }  // end of consume
+    void expect(const char c) {
+      this->throw_if(!this->consume(c),
+                     "invalid header (expected '" + std::string(1, c) + "')");
+    }  // end of expect
+    std::string readString() {
+      this->skipSpaces();
+      this->throw_if(this->pos == this->header.size(),
+                     "invalid header (unexpected end of header)");
+      const auto q = this->header[this->pos];
+      this->throw_if((q != '\'') && (q != '"'),
+                     "invalid header (expected a string)");
+      auto r = std::string{};
+      ++(this->pos);
+      while (true) {
+        this->throw_if(this->pos == this->header.size(),
+                       "invalid header (unterminated string)");
+        auto c = this->header[this->pos++];
+        if (c == q) {
+          break;
+        }
+        if (c == '\\') {
+          this->throw_if(this->pos == this->header.size(),
+                         "invalid header (unterminated string)");
+          c = this->header[this->pos++];
+        }
+        r += c;
+      }
+      return r;
+    }  // end of readString
+    std::size_t readInteger() {
+      this->skipSpaces();
+      auto r = std::size_t{};
+      const auto p0 = this->pos;
+      while ((this->pos != this->header.size()) &&
+             (this->header[this->pos] >= '0') &&
+             (this->header[this->pos] <= '9')) {
+        r = 10 * r + static_cast<std::size_t>(this->header[this->pos] - '0');
+        ++(this->pos);
+      }
+      this->throw_if(p0 == this->pos, "invalid header (expected an integer)");
+      return r;
+    }  // end of readInteger
+    //! \brief header
+    const std::string_view header;
+    //! \brief file name
+    const std::string& file;
+    //! \brief current position
+    std::string_view::size_type pos = 0;
+  };  // end of struct BinaryData_HeaderParser
+
+  bool BinaryData::isBinaryDataFile(const std::string& f) {
+    std::ifstream in(f, std::ios::in | std::ios::binary);
+    if (!in) {
+      return false;
+    }
+    auto m = std::array<char, BinaryData_magic.size()>{};
+    in.read(m.data(), static_cast<std::streamsize>(m.size()));
+    return (in.gcount() == static_cast<std::streamsize>(m.size())) &&
+           (std::string_view(m.data(), m.size()) == BinaryData_magic);
+  }  // end of isBinaryDataFile
+
+  BinaryData::BinaryData(const std::string& f, const bool b)
+      : content(std::make_unique<MappedFile>(f, b)) {
+    auto throw_if = [&f](const bool c, const std::string& m) {
+      raise_if(c, "BinaryData::BinaryData: " + m + " (file '" + f + "')");
+    };
+    const auto data = this->content->view();
+    throw_if((data.size() < 10) ||
+                 (data.substr(0, BinaryData_magic.size()) != BinaryData_magic),
+             "invalid file format");
+    const auto version = static_cast<unsigned char>(data[6]);
+    throw_if((version < 1) || (version > 3), "unsupported format version");
+    const auto psize = std::size_t{version == 1 ? 10u : 12u};
+    throw_if(data.size() < psize, "invalid file format");
+    // size of the description, stored in little endian
+    auto hsize = std::size_t{};
+    for (std::size_t i = psize - 8; i != 0; --i) {
+      hsize = 256 * hsize + static_cast<unsigned char>(data[7 + i]);
+    }
+    throw_if(data.size() < psize + hsize, "truncated header");
+    const auto h = BinaryData_HeaderParser{data.substr(psize, hsize), f};
+    for (const auto& fd : h.fields) {
+      throw_if(fd.type.size() != 3 || fd.type.substr(1) != "f8",
+               "unsupported data type '" + fd.type + "'");
+      const auto swap =
+          (fd.type[0] == '<')   ? std::endian::native != std::endian::little
+          : (fd.type[0] == '>') ? std::endian::native != std::endian::big
+                                : false;
+      throw_if((fd.type[0] != '<') && (fd.type[0] != '>') &&
+                   (fd.type[0] != '='),
+               "unsupported data type '" + fd.type + "'");
+      throw_if((&fd != &h.fields.front()) && (swap != this->swap_bytes),
+               "all fields must have the same byte order");
+      this->swap_bytes = swap;
+    }
+    if (h.structured) {
+      throw_if(h.shape.size() != 1, "unsupported array shape");
+      this->nlines = h.shape[0];
+      this->ncolumns = h.fields.size();
+      for (const auto& fd : h.fields) {
+        this->legends.push_back(fd.name);
+      }
+    } else {
+      throw_if((h.shape.size() != 1) && (h.shape.size() != 2),
+               "unsupported array shape");
+      this->nlines = h.shape[0];
+      this->ncolumns = h.shape.size() == 1 ? 1 : h.shape[1];
+      this->fortran_order = h.fortran_order;
+    }
+    this->offset = psize + hsize;
+    throw_if((data.size() - this->offset) / sizeof(double) <
+                 this->nlines * this->ncolumns,
+             "truncated file");
+  }  // end of BinaryData
+
+  BinaryData::BinaryData(BinaryData&&) = default;
+  BinaryData& BinaryData::operator=(BinaryData&&) = default;
+
+  BinaryData::size_type BinaryData::getNumberOfColumns() const noexcept {
+    return this->ncolumns;
+  }  // end of getNumberOfColumns
+
+  BinaryData::size_type BinaryData::getNumberOfLines() const noexcept {
+    return this->nlines - this->first_line;
+  }  // end of getNumberOfLines
+
+  std::vector<double> BinaryData::getColumn(const size_type i) const {
+    auto tab = std::vector<double>{};
+    this->getColumn(tab, i);
+    return tab;
+  }  // end of getColumn
+
+  void BinaryData::getColumn(std::vector<double>& tab,
+                             const size_type i) const {
+    raise_if((i == 0) || (i > this->ncolumns),
+             "BinaryData::getColumn: invalid column index '" +
+                 std::to_string(i) + "'");
+    const auto* const values = this->content->view().data() + this->offset;
+    const auto c = i - 1;
+    tab.resize(this->nlines - this->first_line);
+    for (size_type l = this->first_line; l != this->nlines; ++l) {
+      const auto pos = this->fortran_order ? c * this->nlines + l
+                                           : l * this->ncolumns + c;
+      auto b = std::array<char, sizeof(double)>{};
+      std::memcpy(b.data(), values + pos * sizeof(double), sizeof(double));
+      if (this->swap_bytes) {
+        std::reverse(b.begin(), b.end());
+      }
+      std::memcpy(&tab[l - this->first_line], b.data(), sizeof(double));
+    }
+  }  // end of getColumn
+
+  BinaryData::size_type BinaryData::findColumn(const std::string& n) const {
+    const auto p = std::find(this->legends.begin(), this->legends.end(), n);
+    raise_if(p == this->legends.end(),
+             "BinaryData::findColumn: no column named '" + n + "' found");
+    return static_cast<size_type>(p - this->legends.begin() + 1);
+  }  // end of findColumn
+
+  const std::vector<std::string>& BinaryData::getLegends() const noexcept {
+    return this->legends;
+  }  // end of getLegends
+
+  std::string BinaryData::getLegend(const size_type c) const {
+    raise_if(c == 0, "BinaryData::getLegend: invalid column index");
+    if (c > this->legends.size()) {
+      return "";
+    }
+    return this->legends[c - 1];
+  }  // end of getLegend
+
+  void BinaryData::skipLines(const size_type n) {
+    this->first_line = std::min(this->nlines, this->first_line + n);
+  }  // end of skipLines
+
+  BinaryData::~BinaryData() = default;
+
+}  // end of namespace tfel::utilities
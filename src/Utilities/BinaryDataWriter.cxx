@@ -0,0 +1,152 @@
+/*!
+ * \file   src/Utilities/BinaryDataWriter.cxx
+ * \brief  This file implements the `BinaryDataWriter` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <bit>
+#include <limits>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \return the description of the array stored in the file, as a
+   * `python` dictionary
+   * \param[in] c: names of the columns
+   * \param[in] n: number of lines
+   */
+  static std::string BinaryDataWriter_getDescription(
+      const std::vector<std::string>& c, const std::size_t n) {
+    const auto* const type =
+        (std::endian::native == std::endian::little) ? "'<f8'" : "'>f8'";
+    auto d = std::string{"{'descr': ["};
+    for (const auto& name : c) {
+      if (&name != &c.front()) {
+        d += ", ";
+      }
+      d += "('";
+      for (const auto ch : name) {
+        if ((ch == '\\') || (ch == '\'')) {
+          d += '\\';
+        }
+        d += ch;
+      }
+      d += "', ";
+      d += type;
+      d += ')';
+    }
+    d += "], 'fortran_order': False, 'shape': (" + std::to_string(n) + ",), }";
+    return d;
+  }  // end of BinaryDataWriter_getDescription
+
+  /*!
+   * \return the size of the part of the header preceding the
+   * description of the array
+   * \param[in] v: version of the `npy` format
+   */
+  static std::size_t BinaryDataWriter_getPreludeSize(const unsigned char v) {
+    // magic string, version and size of the description
+    return v == 1 ? 10 : 12;
+  }  // end of BinaryDataWriter_getPreludeSize
+
+  BinaryDataWriter::BinaryDataWriter(const std::string& f,
+                                     const std::vector<std::string>& c)
+      : file(f), columns(c) {
+    auto throw_if = [&f](const bool b, const std::string& msg) {
+      raise_if(b, "BinaryDataWriter::BinaryDataWriter: " + msg +
+                      " (file '" + f + "')");
+    };
+    throw_if(c.empty(), "no column specified");
+    for (auto p = c.begin(); p != c.end(); ++p) {
+      throw_if(p->empty(), "empty column name");
+      throw_if(std::find(p + 1, c.end(), *p) != c.end(),
+               "multiple columns named '" + *p + "'");
+    }
+    // size of the header. Space is reserved for the largest number of
+    // lines
+    const auto d = BinaryDataWriter_getDescription(c, 0);
+    const auto ascii = std::all_of(d.begin(), d.end(), [](const char ch) {
+      return static_cast<unsigned char>(ch) < 128;
+    });
+    const auto dsize =
+        d.size() + std::to_string(std::numeric_limits<size_type>::max()).size();
+    const auto align = [](const size_type s) -> size_type {
+      return 64 * ((s + 63) / 64);
+    };
+    // the description ends with a new line character
+    this->version = ascii ? 1 : 3;
+    this->header_size =
+        align(BinaryDataWriter_getPreludeSize(this->version) + dsize + 1);
+    if ((this->version == 1) && (this->header_size - 10 > 65535)) {
+      this->version = 2;
+      this->header_size = align(BinaryDataWriter_getPreludeSize(2) + dsize + 1);
+    }
+    this->out.open(f, std::ios::out | std::ios::binary | std::ios::trunc);
+    throw_if(!this->out, "can't open file");
+    this->out.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    this->writeHeader();
+  }  // end of BinaryDataWriter
+
+  BinaryDataWriter::size_type BinaryDataWriter::getNumberOfColumns()
+      const noexcept {
+    return this->columns.size();
+  }  // end of getNumberOfColumns
+
+  BinaryDataWriter::size_type BinaryDataWriter::getNumberOfLines()
+      const noexcept {
+    return this->nlines;
+  }  // end of getNumberOfLines
+
+  void BinaryDataWriter::writeHeader() {
+    const auto psize = BinaryDataWriter_getPreludeSize(this->version);
+    const auto hsize = this->header_size - psize;
+    auto h = std::string{"\x93NUMPY"};
+    h += static_cast<char>(this->version);
+    h += '\0';
+    // size of the description, in little endian
+    for (size_type i = 0; i != psize - 8; ++i) {
+      h += static_cast<char>((hsize >> (8 * i)) & 0xFF);
+    }
+    h += BinaryDataWriter_getDescription(this->columns, this->nlines);
+    h.resize(this->header_size - 1, ' ');
+    h += '\n';
+    this->out.write(h.data(), static_cast<std::streamsize>(h.size()));
+  }  // end of writeHeader
+
+  void BinaryDataWriter::write(std::span<const double> v) {
+    raise_if(v.size() != this->columns.size(),
+             "BinaryDataWriter::write: "
+             "invalid number of values (expected " +
+                 std::to_string(this->columns.size()) + ", got " +
+                 std::to_string(v.size()) + ")");
+    this->out.write(reinterpret_cast<const char*>(v.data()),
+                    static_cast<std::streamsize>(v.size() * sizeof(double)));
+    ++(this->nlines);
+  }  // end of write
+
+  void BinaryDataWriter::flush() {
+    const auto p = this->out.tellp();
+    this->out.seekp(0);
+    this->writeHeader();
+    this->out.seekp(p);
+    this->out.flush();
+  }  // end of flush
+
+  BinaryDataWriter::~BinaryDataWriter() {
+    try {
+      this->flush();
+    } catch (...) {
+    }
+  }  // end of ~BinaryDataWriter
+
+}  // end of namespace tfel::utilities
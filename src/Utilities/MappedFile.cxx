@@ -0,0 +1,82 @@
+/*!
+ * \file   src/Utilities/MappedFile.cxx
+ * \brief  This file implements the `MappedFile` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <fstream>
+#include <iterator>
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define TFEL_MAPPEDFILE_HAVE_MMAP
+#endif
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/MappedFile.hxx"
+
+namespace tfel::utilities {
+
+  MappedFile::MappedFile(const std::string& f, const bool b) {
+#ifdef TFEL_MAPPEDFILE_HAVE_MMAP
+    if (b) {
+      const auto fd = ::open(f.c_str(), O_RDONLY);
+      raise_if(fd == -1, "MappedFile::MappedFile: can't open '" + f + '\'');
+      struct stat s;
+      if ((::fstat(fd, &s) == 0) && (S_ISREG(s.st_mode))) {
+        if (s.st_size == 0) {
+          ::close(fd);
+          return;
+        }
+        const auto size = static_cast<std::size_t>(s.st_size);
+        auto* const m = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m != MAP_FAILED) {
+          ::close(fd);
+#ifdef MADV_SEQUENTIAL
+          ::madvise(m, size, MADV_SEQUENTIAL);
+#endif /* MADV_SEQUENTIAL */
+          this->mapping = m;
+          this->mapping_size = size;
+          return;
+        }
+      }
+      // fall back to the standard reading
+      ::close(fd);
+    }
+#else
+    static_cast<void>(b);
+#endif /* TFEL_MAPPEDFILE_HAVE_MMAP */
+    std::ifstream in(f, std::ios::in | std::ios::binary);
+    raise_if(!in, "MappedFile::MappedFile: can't open '" + f + '\'');
+    this->buffer.assign(std::istreambuf_iterator<char>(in),
+                        std::istreambuf_iterator<char>());
+  }  // end of MappedFile
+
+  std::string_view MappedFile::view() const noexcept {
+    if (this->mapping != nullptr) {
+      return {static_cast<const char*>(this->mapping), this->mapping_size};
+    }
+    return this->buffer;
+  }  // end of view
+
+  bool MappedFile::isMemoryMapped() const noexcept {
+    return this->mapping != nullptr;
+  }  // end of isMemoryMapped
+
+  MappedFile::~MappedFile() {
+#ifdef TFEL_MAPPEDFILE_HAVE_MMAP
+    if (this->mapping != nullptr) {
+      ::munmap(this->mapping, this->mapping_size);
+    }
+#endif /* TFEL_MAPPEDFILE_HAVE_MMAP */
+  }  // end of ~MappedFile
+
+}  // end of namespace tfel::utilities
@@ -0,0 +1,263 @@
+/*!
+ * \file   src/Utilities/NumericTextData.cxx
+ * \brief  This file implements the `NumericTextData` class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <string_view>
+#include <system_error>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
+#include "TFEL/Utilities/CxxTokenizer.hxx"
+#include "TFEL/Utilities/MappedFile.hxx"
+#include "TFEL/Utilities/NumericTextData.hxx"
+
+namespace tfel::utilities {
+
+  static bool NumericTextData_isSpace(const char c) {
+    return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\v') ||
+           (c == '\f');
+  }  // end of NumericTextData_isSpace
+
+  /*!
+   * \return if the given character may appear in a number. Other
+   * characters (for instance digit separators or the letters of `inf`
+   * and `nan`) are rejected so that the values read are exactly the
+   * ones that would be obtained by the `TextData` class.
+   */
+  static bool NumericTextData_isNumberCharacter(const char c) {
+    return ((c >= '0') && (c <= '9')) || (c == '.') || (c == 'e') ||
+           (c == 'E') || (c == '+') || (c == '-');
+  }  // end of NumericTextData_isNumberCharacter
+
+  /*!
+   * \brief parse a value
+   * \return true on success
+   * \param[out] v: value
+   * \param[in] b: iterator to the beginning of the token
+   * \param[in] e: iterator past the end of the token
+   */
+  static bool NumericTextData_parseValue(double& v,
+                                         const char* b,
+                                         const char* const e) {
+    if (!std::all_of(b, e, NumericTextData_isNumberCharacter)) {
+      return false;
+    }
+    // std::from_chars does not accept a leading plus sign
+    if (*b == '+') {
+      ++b;
+      if ((b == e) || (*b == '+') || (*b == '-')) {
+        return false;
+      }
+    }
+    const auto r = std::from_chars(b, e, v, std::chars_format::general);
+    return (r.ec == std::errc{}) && (r.ptr == e);
+  }  // end of NumericTextData_parseValue
+
+  static std::vector<std::string> NumericTextData_getLegends(
+      const std::string_view l) {
+    std::vector<std::string> r;
+    CxxTokenizer t;
+    t.treatCharAsString(true);
+    t.parseString(std::string{l});
+    t.stripComments();
+    std::for_each(t.begin(), t.end(), [&r](const Token& w) {
+      if (w.flag == Token::String) {
+        r.push_back(w.value.substr(1, w.value.size() - 2));
+      } else {
+        r.push_back(w.value);
+      }
+    });
+    return r;
+  }  // end of NumericTextData_getLegends
+
+  NumericTextData::NumericTextData(const std::string& file,
+                                   const std::string& format)
+      : NumericTextData(file, Options{format, true}) {
+  }  // end of NumericTextData::NumericTextData
+
+  NumericTextData::NumericTextData(const std::string& file,
+                                   const Options& opts) {
+    const auto& format = opts.format;
+    const auto gnuplot = (format == "gnuplot") || (format == "alcyone");
+    const auto content = MappedFile{file, opts.use_memory_mapping};
+    const auto data = content.view();
+    // number of columns, determined by the first line of data
+    auto nc = size_type{};
+    auto add_line = [this, &file, &nc](const std::string_view l,
+                                       const size_type n) {
+      auto throw_if = [&file, n](const bool b, const std::string& msg) {
+        raise_if(b, "NumericTextData::NumericTextData: " + msg + " (line " +
+                        std::to_string(n) + " of file '" + file + "')");
+      };
+      auto p = l.data();
+      const auto pe = l.data() + l.size();
+      auto c = size_type{};
+      while (true) {
+        while ((p != pe) && (NumericTextData_isSpace(*p))) {
+          ++p;
+        }
+        if (p == pe) {
+          break;
+        }
+        const auto b = p;
+        while ((p != pe) && (!NumericTextData_isSpace(*p))) {
+          ++p;
+        }
+        auto v = double{};
+        throw_if(!NumericTextData_parseValue(v, b, p),
+                 "invalid value '" + std::string{b, p} + "'");
+        if (this->lines.empty()) {
+          this->columns.emplace_back();
+        } else {
+          throw_if(c >= nc, "unexpected number of values");
+        }
+        this->columns[c].push_back(v);
+        ++c;
+      }
+      if (this->lines.empty()) {
+        throw_if(c == 0, "no value read");
+        nc = c;
+      } else {
+        throw_if(c != nc, "unexpected number of values");
+      }
+      this->lines.push_back(n);
+    };
+    auto firstLine = true;
+    auto firstComments = true;
+    auto nbr = size_type{1};
+    auto pos = std::string_view::size_type{};
+    while (pos < data.size()) {
+      const auto eol = data.find('\n', pos);
+      const auto end = eol == std::string_view::npos ? data.size() : eol;
+      const auto line = data.substr(pos, end - pos);
+      pos = end + 1;
+      if (line.empty()) {
+        continue;
+      }
+      if (line[0] == '#') {
+        if (!firstComments) {
+          continue;
+        }
+        if (format.empty()) {
+          const auto c = line.substr(1);
+          if (firstLine) {
+            this->legends = NumericTextData_getLegends(c);
+          }
+          this->preamble.emplace_back(c);
+        }
+      } else {
+        if (gnuplot && firstLine) {
+          this->legends = NumericTextData_getLegends(line);
+          bool all_numbers = true;
+          for (const auto& l : this->legends) {
+            try {
+              convert<double>(l);
+            } catch (std::exception&) {
+              all_numbers = false;
+            }
+            if (!all_numbers) {
+              break;
+            }
+          }
+          if (all_numbers) {
+            this->legends.clear();
+            add_line(line, nbr);
+          }
+        } else {
+          add_line(line, nbr);
+          firstComments = false;
+        }
+      }
+      firstLine = false;
+      ++nbr;
+    }
+  }  // end of NumericTextData::NumericTextData
+
+  NumericTextData::NumericTextData(NumericTextData&&) = default;
+  NumericTextData& NumericTextData::operator=(NumericTextData&&) = default;
+
+  NumericTextData::size_type NumericTextData::getNumberOfColumns()
+      const noexcept {
+    return this->columns.size();
+  }  // end of NumericTextData::getNumberOfColumns
+
+  NumericTextData::size_type NumericTextData::getNumberOfLines()
+      const noexcept {
+    return this->lines.size();
+  }  // end of NumericTextData::getNumberOfLines
+
+  const std::vector<double>& NumericTextData::getColumn(
+      const size_type i) const {
+    raise_if(i == 0u,
+             "NumericTextData::getColumn: column '0' requested "
+             "(column numbers begins at '1').");
+    raise_if(i > this->columns.size(),
+             "NumericTextData::getColumn: invalid column index '" +
+                 std::to_string(i) + "' (only '" +
+                 std::to_string(this->columns.size()) +
+                 "' columns available)");
+    return this->columns[i - 1];
+  }  // end of NumericTextData::getColumn
+
+  void NumericTextData::getColumn(std::vector<double>& tab,
+                                  const size_type i) const {
+    const auto& c = this->getColumn(i);
+    tab.assign(c.begin(), c.end());
+  }  // end of NumericTextData::getColumn
+
+  const std::vector<NumericTextData::size_type>&
+  NumericTextData::getLineNumbers() const noexcept {
+    return this->lines;
+  }  // end of NumericTextData::getLineNumbers
+
+  NumericTextData::size_type NumericTextData::findColumn(
+      const std::string& n) const {
+    const auto p = std::find(this->legends.begin(), this->legends.end(), n);
+    raise_if(p == this->legends.end(),
+             "NumericTextData::findColumn: "
+             "no column named '" +
+                 n + "' found'.");
+    return static_cast<size_type>(p - this->legends.begin() + 1);
+  }  // end of NumericTextData::findColumn
+
+  const std::vector<std::string>& NumericTextData::getLegends()
+      const noexcept {
+    return this->legends;
+  }  // end of NumericTextData::getLegends
+
+  std::string NumericTextData::getLegend(const size_type c) const {
+    raise_if(c == 0, "NumericTextData::getLegend: invalid column index");
+    if (c >= this->legends.size() + 1) {
+      return "";
+    }
+    return this->legends[c - 1];
+  }  // end of NumericTextData::getLegend
+
+  const std::vector<std::string>& NumericTextData::getPreamble()
+      const noexcept {
+    return this->preamble;
+  }  // end of NumericTextData::getPreamble
+
+  void NumericTextData::skipLines(const size_type n) {
+    const auto p = std::upper_bound(this->lines.begin(), this->lines.end(),
+                                    n + 1);
+    const auto d = p - this->lines.begin();
+    this->lines.erase(this->lines.begin(), p);
+    for (auto& c : this->columns) {
+      c.erase(c.begin(), c.begin() + d);
+    }
+  }  // end of NumericTextData::skipLines
+
+  NumericTextData::~NumericTextData() = default;
+
+}  // end of namespace tfel::utilities
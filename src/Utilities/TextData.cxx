@@ -11,7 +11,10 @@
  * project under specific licensing conditions.
  */
 
+#include <array>
+#include <mutex>
 #include <cassert>
+#include <charconv>
 #include <stdexcept>
 #include <sstream>
 #include <fstream>
@@ -24,7 +27,20 @@
 
 namespace tfel::utilities {
 
-  TextData::TextData(const std::string& file, const std::string& format) {
+  /*!
+   * \brief read the given file and split each line in tokens
+   * \param[out] lines: lines
+   * \param[out] legends: legends
+   * \param[out] preamble: preamble
+   * \param[in] file: file name
+   * \param[in] format: file format
+   */
+  static void TextData_tokenize(std::vector<TextData::Line>& lines,
+                                std::vector<std::string>& legends,
+                                std::vector<std::string>& preamble,
+                                const std::string& file,
+                                const std::string& format) {
+    using size_type = TextData::size_type;
     auto get_legends = [](const std::string& l) {
       std::vector<std::string> r;
       CxxTokenizer t;
@@ -40,8 +56,8 @@ namespace tfel::utilities {
       });
       return r;
     };
-    auto add_line = [this](const std::string& l, const Token::size_type n) {
-      Line nl;
+    auto add_line = [&lines](const std::string& l, const Token::size_type n) {
+      TextData::Line nl;
       CxxTokenizer t;
       t.treatCharAsString(true);
       t.parseString(l);
@@ -50,7 +66,7 @@ namespace tfel::utilities {
         nl.tokens.push_back(w);
         nl.tokens.back().line = n;
       });
-      this->lines.push_back(std::move(nl));
+      lines.push_back(std::move(nl));
     };
     auto firstLine = true;
     auto firstComments = true;
@@ -70,15 +86,15 @@ namespace tfel::utilities {
         if (format.empty()) {
           line.erase(line.begin());
           if (firstLine) {
-            this->legends = get_legends(line);
+            legends = get_legends(line);
           }
-          this->preamble.push_back(line);
+          preamble.push_back(line);
         }
       } else {
         if (((format == "gnuplot") || (format == "alcyone")) && (firstLine)) {
-          this->legends = get_legends(line);
+          legends = get_legends(line);
           bool all_numbers = true;
-          for (const auto& l : this->legends) {
+          for (const auto& l : legends) {
             try {
               convert<double>(l);
             } catch (std::exception&) {
@@ -89,7 +105,7 @@ namespace tfel::utilities {
             }
           }
           if (all_numbers) {
-            this->legends.clear();
+            legends.clear();
             add_line(line, nbr);
           }
         } else {
@@ -100,8 +116,38 @@ namespace tfel::utilities {
       firstLine = false;
       ++nbr;
     }
+  }  // end of TextData_tokenize
+
+  TextData::TextData(const std::string& f, const std::string& fmt)
+      : file(f), format(fmt) {
+    if (BinaryData::isBinaryDataFile(f)) {
+      this->binary_data = std::make_unique<BinaryData>(f);
+      this->legends = this->binary_data->getLegends();
+      return;
+    }
+    try {
+      this->numeric_data = std::make_unique<NumericTextData>(f, fmt);
+    } catch (std::exception&) {
+      // the file does not only contain numeric values
+      this->numeric_data.reset();
+    }
+    if (this->numeric_data != nullptr) {
+      this->legends = this->numeric_data->getLegends();
+      this->preamble = this->numeric_data->getPreamble();
+      return;
+    }
+    TextData_tokenize(this->lines, this->legends, this->preamble, f, fmt);
+    this->tokenized = true;
   }  // end of TextData::TextData
 
+  const NumericTextData* TextData::getNumericTextData() const noexcept {
+    return this->numeric_data.get();
+  }  // end of TextData::getNumericTextData
+
+  const BinaryData* TextData::getBinaryData() const noexcept {
+    return this->binary_data.get();
+  }  // end of TextData::getBinaryData
+
   const std::vector<std::string>& TextData::getLegends() const {
     return this->legends;
   }  // end of TextData::getLegends
@@ -139,11 +185,29 @@ namespace tfel::utilities {
       raise_if(b, "TextData::getColumn: " + msg);
     };
     tab.clear();
-    tab.reserve(this->lines.size());
     // sanity check
     throw_if(i == 0u,
              "column '0' requested "
              "(column numbers begins at '1').");
+    if (this->binary_data != nullptr) {
+      const auto& d = *(this->binary_data);
+      throw_if(d.getNumberOfColumns() < i,
+               "the file does not have '" + std::to_string(i) + "' columns.");
+      d.getColumn(tab, i);
+      return;
+    }
+    if (this->numeric_data != nullptr) {
+      const auto& d = *(this->numeric_data);
+      if (d.getNumberOfLines() == 0) {
+        return;
+      }
+      throw_if(d.getNumberOfColumns() < i,
+               "line '" + std::to_string(d.getLineNumbers().front()) +
+                   "' does not have '" + std::to_string(i) + "' columns.");
+      d.getColumn(tab, i);
+      return;
+    }
+    tab.reserve(this->lines.size());
     // treatment
     for (const auto& l : this->lines) {
       auto n = l.tokens.empty() ? 0 : l.tokens[0].line;
@@ -156,14 +220,66 @@ namespace tfel::utilities {
   }  // end of TextData::getColumn
 
   std::vector<TextData::Line>::const_iterator TextData::begin() const {
+    // the lines may be built by the first call to this method, which can
+    // be made concurrently by several threads
+    const auto lock = std::lock_guard<std::mutex>{this->m};
+    if ((!this->tokenized) && (this->binary_data != nullptr)) {
+      // the values are converted to strings allowing to recover them
+      // exactly
+      const auto& d = *(this->binary_data);
+      this->lines.resize(d.getNumberOfLines());
+      for (size_type c = 0; c != d.getNumberOfColumns(); ++c) {
+        const auto values = d.getColumn(c + 1);
+        for (size_type l = 0; l != values.size(); ++l) {
+          auto v = std::array<char, 32>{};
+          const auto r =
+              std::to_chars(v.data(), v.data() + v.size(), values[l]);
+          this->lines[l].tokens.emplace_back(std::string(v.data(), r.ptr),
+                                             l + 1, c, Token::Number);
+        }
+      }
+      this->tokenized = true;
+    }
+    if (!this->tokenized) {
+      auto l = std::vector<std::string>{};
+      auto p = std::vector<std::string>{};
+      TextData_tokenize(this->lines, l, p, this->file, this->format);
+      // removing the lines skipped by the `skipLines` method
+      const auto& n = this->numeric_data->getLineNumbers();
+      const auto s =
+          this->lines.size() - std::min(this->lines.size(), n.size());
+      this->lines.erase(this->lines.begin(), this->lines.begin() + s);
+      this->tokenized = true;
+    }
     return this->lines.begin();
   }  // end of TextData::begin()
 
   std::vector<TextData::Line>::const_iterator TextData::end() const {
+    // make sure that the lines have been tokenized
+    static_cast<void>(this->begin());
+    // the `lines` member is not modified once built
     return this->lines.end();
   }  // end of TextData::end()
 
   void TextData::skipLines(const Token::size_type n) {
+    const auto lock = std::lock_guard<std::mutex>{this->m};
+    if (this->binary_data != nullptr) {
+      // the first lines of data are skipped
+      this->binary_data->skipLines(n);
+      if (this->tokenized) {
+        this->lines.erase(this->lines.begin(),
+                          this->lines.begin() +
+                              static_cast<std::ptrdiff_t>(
+                                  std::min(n, this->lines.size())));
+      }
+      return;
+    }
+    if (this->numeric_data != nullptr) {
+      this->numeric_data->skipLines(n);
+      if (!this->tokenized) {
+        return;
+      }
+    }
     auto get_line = [](const Line& l) -> Token::size_type {
       return l.tokens.empty() ? 0 : l.tokens[0].line;
     };
@@ -175,6 +291,8 @@ namespace tfel::utilities {
       ++p;
     }
     lines.erase(lines.begin(), p);
-  }
+  }  // end of TextData::skipLines
+
+  TextData::~TextData() = default;
 
 }  // end of namespace tfel::utilities
@@ -0,0 +1,222 @@
+/*!
+ * \file   tests/Math/LocalKrigingTest.cxx
+ * \brief  This file tests the `KrigingKdTree` and the `LocalKriging`
+ * classes.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/Kriging.hxx"
+#include "TFEL/Math/LocalKriging.hxx"
+
+//! \brief a reproducible pseudo-random number generator
+struct RandomNumberGenerator {
+  double operator()(const double a, const double b) {
+    this->state = (this->state * 1103515245u + 12345u) % 2147483648u;
+    return a + (b - a) * static_cast<double>(this->state) / 2147483648.;
+  }
+  unsigned long long state = 12345u;
+};
+
+template <unsigned short N>
+static typename tfel::math::KrigingVariable<N, double>::type getRandomPoint(
+    RandomNumberGenerator& g) {
+  if constexpr (N == 1) {
+    return g(0, 1);
+  } else {
+    auto x = tfel::math::tvector<N, double>{};
+    for (auto& v : x) {
+      v = g(0, 1);
+    }
+    return x;
+  }
+}  // end of getRandomPoint
+
+template <unsigned short N>
+static double f(
+    const typename tfel::math::KrigingVariable<N, double>::type& x) {
+  if constexpr (N == 1) {
+    return std::cos(2 * x) * std::exp(x);
+  } else {
+    auto s = 0.;
+    for (const auto& v : x) {
+      s += v;
+    }
+    return std::cos(2 * s) * std::exp(x[0]);
+  }
+}  // end of f
+
+template <unsigned short N>
+static double getSquaredDistance(
+    const typename tfel::math::KrigingVariable<N, double>::type& x,
+    const typename tfel::math::KrigingVariable<N, double>::type& y) {
+  if constexpr (N == 1) {
+    return (x - y) * (x - y);
+  } else {
+    auto d2 = 0.;
+    for (unsigned short i = 0; i != N; ++i) {
+      d2 += (x[i] - y[i]) * (x[i] - y[i]);
+    }
+    return d2;
+  }
+}  // end of getSquaredDistance
+
+struct LocalKrigingTest final : public tfel::tests::TestCase {
+  LocalKrigingTest() : tfel::tests::TestCase("TFEL/Math", "LocalKriging") {}
+  tfel::tests::TestResult execute() override {
+    this->test1<1u>();
+    this->test1<2u>();
+    this->test1<3u>();
+    this->test2<1u>();
+    this->test2<2u>();
+    this->test2<3u>();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief compare the k-d tree to a brute force search
+  template <unsigned short N>
+  void test1() {
+    using Variable = typename tfel::math::KrigingVariable<N, double>::type;
+    auto g = RandomNumberGenerator{};
+    auto points = std::vector<Variable>{};
+    for (std::size_t i = 0; i != 1000; ++i) {
+      points.push_back(getRandomPoint<N>(g));
+    }
+    // duplicated points
+    points.push_back(points[10]);
+    points.push_back(points[10]);
+    auto tree = tfel::math::KrigingKdTree<N, double>{};
+    tree.build(points);
+    TFEL_TESTS_ASSERT(tree.size() == points.size());
+    auto w = typename tfel::math::KrigingKdTree<N, double>::Workspace{};
+    auto n = std::vector<std::size_t>{};
+    for (std::size_t i = 0; i != 100; ++i) {
+      const auto x = getRandomPoint<N>(g);
+      for (const std::size_t k : {1u, 7u, 16u, 50u}) {
+        tree.findNearestNeighbours(n, w, x, k);
+        TFEL_TESTS_ASSERT(n.size() == k);
+        auto d2 = std::vector<double>{};
+        for (const auto& p : points) {
+          d2.push_back(getSquaredDistance<N>(p, x));
+        }
+        std::sort(d2.begin(), d2.end());
+        for (std::size_t j = 0; j != n.size(); ++j) {
+          TFEL_TESTS_ASSERT(
+              std::abs(getSquaredDistance<N>(points[n[j]], x) - d2[j]) <
+              1e-14);
+        }
+      }
+    }
+    tree.findNearestNeighbours(n, w, points[0], points.size() + 10);
+    TFEL_TESTS_ASSERT(n.size() == points.size());
+  }  // end of test1
+  //! \brief the interpolation is exact at the data points
+  template <unsigned short N>
+  void test2() {
+    auto g = RandomNumberGenerator{};
+    auto k = tfel::math::LocalKriging<N>{};
+    k.setSupportRadius(1);
+    auto points =
+        std::vector<typename tfel::math::KrigingVariable<N, double>::type>{};
+    for (std::size_t i = 0; i != 2000; ++i) {
+      points.push_back(getRandomPoint<N>(g));
+      k.addValue(points.back(), f<N>(points.back()));
+    }
+    k.buildInterpolation();
+    for (std::size_t i = 0; i != 100; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(k(points[i]) - f<N>(points[i])) < 1e-10);
+    }
+    // accuracy inside the domain
+    for (std::size_t i = 0; i != 100; ++i) {
+      auto x = getRandomPoint<N>(g);
+      if constexpr (N == 1) {
+        x = 0.25 + x / 2;
+      } else {
+        for (auto& v : x) {
+          v = 0.25 + v / 2;
+        }
+      }
+      TFEL_TESTS_ASSERT(std::abs(k(x) - f<N>(x)) < 2e-2);
+    }
+  }  // end of test2
+  /*!
+   * \brief when all the points are used, the local interpolation is
+   * equal to the global one.
+   */
+  void test3() {
+    using Model = tfel::math::KrigingDefaultModel<2u, double>;
+    auto g = RandomNumberGenerator{};
+    auto k1 = tfel::math::Kriging<2u>{};
+    auto k2 = tfel::math::LocalKriging<2u, double, Model>{};
+    for (std::size_t i = 0; i != 50; ++i) {
+      const auto x = getRandomPoint<2u>(g);
+      k1.addValue(x, f<2u>(x));
+      k2.addValue(x, f<2u>(x));
+    }
+    k1.buildInterpolation();
+    k2.setNumberOfNeighbours(50);
+    k2.buildInterpolation();
+    for (std::size_t i = 0; i != 100; ++i) {
+      const auto x = getRandomPoint<2u>(g);
+      TFEL_TESTS_ASSERT(std::abs(k1(x) - k2(x)) < 1e-10);
+    }
+  }  // end of test3
+  //! \brief batch evaluation
+  void test4() {
+    using Variable = tfel::math::tvector<3u, double>;
+    auto g = RandomNumberGenerator{};
+    auto k = tfel::math::LocalKriging<3u>{};
+    k.setSupportRadius(0.5);
+    for (std::size_t i = 0; i != 1000; ++i) {
+      const auto x = getRandomPoint<3u>(g);
+      k.addValue(x, f<3u>(x));
+    }
+    k.buildInterpolation();
+    auto points = std::vector<Variable>{};
+    for (std::size_t i = 0; i != 100; ++i) {
+      const auto x = getRandomPoint<3u>(g);
+      // points sharing the same neighbours
+      auto x2 = x;
+      x2[0] += 1e-6;
+      points.push_back(x);
+      points.push_back(x2);
+    }
+    auto r = std::vector<double>(points.size());
+    k.evaluate(r, points);
+    for (std::size_t i = 0; i != points.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - k(points[i])) < 1e-12);
+    }
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(LocalKrigingTest, "LocalKriging");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("LocalKriging.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
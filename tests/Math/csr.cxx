@@ -0,0 +1,183 @@
+/*!
+ * \file   tests/Math/csr.cxx
+ * \brief  This file tests the `CSRMatrix` class, the
+ * `ILU0Preconditioner` class and the `GMRESSolve` solver.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <limits>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/CSRMatrix.hxx"
+#include "TFEL/Math/GMRESSolve.hxx"
+
+struct CSRMatrixTest final : public tfel::tests::TestCase {
+  CSRMatrixTest() : tfel::tests::TestCase("TFEL/Math", "CSRMatrixTest") {
+  }  // end of CSRMatrixTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  using size_type = tfel::math::CSRMatrix<double>::size_type;
+  //! \brief a non symmetric banded matrix bordered by a full row and column
+  static double value(const size_type i, const size_type j, const size_type n) {
+    if (i == j) {
+      return 4 + 0.1 * i;
+    }
+    if ((i == n) || (j == n)) {
+      return 0.01 * (1 + i) - 0.02 * j;
+    }
+    return (i > j) ? -1 + 0.01 * j : -0.5 - 0.03 * i;
+  }
+  void test1() {
+    // pattern and access
+    auto m = tfel::math::CSRMatrix<double>(
+        tfel::math::CSRMatrix<double>::getBandedPattern(5, 1, 1));
+    TFEL_TESTS_ASSERT(m.getNbRows() == 6);
+    TFEL_TESTS_ASSERT(m.getNbCols() == 6);
+    TFEL_TESTS_ASSERT(m.getNumberOfStoredValues() == 24);
+    TFEL_TESTS_ASSERT(m.isInPattern(2, 1));
+    TFEL_TESTS_ASSERT(m.isInPattern(1, 2));
+    TFEL_TESTS_ASSERT(!m.isInPattern(3, 1));
+    TFEL_TESTS_ASSERT(!m.isInPattern(1, 3));
+    TFEL_TESTS_ASSERT(m.isInPattern(5, 0));
+    TFEL_TESTS_ASSERT(m.isInPattern(0, 5));
+    m(1, 2) = 3;
+    m(2, 1) = -2;
+    m(0, 5) = 7;
+    const auto& cm = m;
+    TFEL_TESTS_ASSERT(std::abs(cm(1, 2) - 3) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(cm(2, 1) + 2) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(cm(0, 5) - 7) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(cm(5, 0)) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(cm(3, 1)) < 1e-14);
+    TFEL_TESTS_CHECK_THROW(m(3, 1) = 1, std::out_of_range);
+    m.zero();
+    TFEL_TESTS_ASSERT(std::abs(cm(1, 2)) < 1e-14);
+    // unsorted and repeated indices, missing diagonal term
+    m.resize({{2, 0, 2}, {0}, {}});
+    TFEL_TESTS_ASSERT(m.getNumberOfStoredValues() == 5);
+    TFEL_TESTS_ASSERT(m.isInPattern(1, 1));
+    TFEL_TESTS_ASSERT(m.isInPattern(2, 2));
+    TFEL_TESTS_ASSERT(!m.isInPattern(0, 1));
+    TFEL_TESTS_CHECK_THROW(m.resize({{3}, {}, {}}), std::invalid_argument);
+  }
+  void test2() {
+    // comparison with the dense LU solver
+    constexpr auto eps = 1e-10;
+    for (const size_type b : {1, 2, 3}) {
+      const size_type n = 30;
+      auto m = tfel::math::CSRMatrix<double>(
+          tfel::math::CSRMatrix<double>::getBandedPattern(n, b, 1));
+      auto k = tfel::math::matrix<double>(n + 1, n + 1, 0.);
+      auto x = tfel::math::vector<double>(n + 1);
+      for (size_type i = 0; i != n + 1; ++i) {
+        x(i) = 1 + 0.2 * i - 0.003 * i * i;
+        for (size_type j = 0; j != n + 1; ++j) {
+          if (m.isInPattern(i, j)) {
+            m(i, j) = k(i, j) = value(i, j, n);
+          }
+        }
+      }
+      auto r1 = tfel::math::vector<double>(n + 1);
+      m.multiply(r1, x);
+      auto r2 = r1;
+      tfel::math::LUSolve::exe(k, r1);
+      // the ILU(0) factorisation of a bordered banded matrix is exact
+      auto pc = tfel::math::ILU0Preconditioner<double>{};
+      pc.decomp(m);
+      const auto r = tfel::math::GMRESSolve::exe(m, pc, r2);
+      TFEL_TESTS_ASSERT(r.converged);
+      TFEL_TESTS_ASSERT(r.iterations <= 2);
+      for (size_type i = 0; i != n + 1; ++i) {
+        TFEL_TESTS_ASSERT(std::abs(r1(i) - x(i)) < eps);
+        TFEL_TESTS_ASSERT(std::abs(r2(i) - x(i)) < eps);
+      }
+    }
+  }
+  void test3() {
+    // a matrix whose incomplete factorisation is not exact: five points
+    // finite difference stencil with a convection term
+    constexpr auto eps = 1e-9;
+    const size_type nx = 20;
+    const size_type n = nx * nx;
+    auto p = std::vector<std::vector<size_type>>(n);
+    for (size_type i = 0; i != nx; ++i) {
+      for (size_type j = 0; j != nx; ++j) {
+        const auto r = i * nx + j;
+        if (i != 0) {
+          p[r].push_back(r - nx);
+        }
+        if (j != 0) {
+          p[r].push_back(r - 1);
+        }
+        if (j + 1 != nx) {
+          p[r].push_back(r + 1);
+        }
+        if (i + 1 != nx) {
+          p[r].push_back(r + nx);
+        }
+      }
+    }
+    auto m = tfel::math::CSRMatrix<double>(p);
+    for (size_type r = 0; r != n; ++r) {
+      for (const auto c : p[r]) {
+        m(r, c) = (c > r) ? -1.2 : -0.8;
+      }
+      m(r, r) = 4;
+    }
+    auto x = tfel::math::vector<double>(n);
+    for (size_type i = 0; i != n; ++i) {
+      x(i) = std::sin(0.1 * i);
+    }
+    auto b = tfel::math::vector<double>(n);
+    m.multiply(b, x);
+    auto pc = tfel::math::ILU0Preconditioner<double>{};
+    pc.decomp(m);
+    const auto r = tfel::math::GMRESSolve::exe(m, pc, b, 1e-13, 10);
+    TFEL_TESTS_ASSERT(r.converged);
+    TFEL_TESTS_ASSERT(r.iterations > 2);
+    for (size_type i = 0; i != n; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(b(i) - x(i)) < eps);
+    }
+    // null pivot detection
+    auto m2 = tfel::math::CSRMatrix<double>({{1}, {0}});
+    m2(0, 1) = 1;
+    m2(1, 0) = 1;
+    TFEL_TESTS_CHECK_THROW(pc.decomp(m2), tfel::math::LUNullPivot);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(CSRMatrixTest, "CSRMatrixTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("csr.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,172 @@
+/*!
+ * \file   tests/Math/parser13.cxx
+ * \brief  This file tests the compilation of expressions to bytecode.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/Evaluator.hxx"
+
+struct ParserTest13 final : public tfel::tests::TestCase {
+  ParserTest13()
+      : tfel::tests::TestCase("TFEL/Math", "ParserTest13") {
+  }  // end of ParserTest13
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief compare the compiled expression to the tree-walking one
+  void check(const std::string& f) {
+    constexpr auto eps = double{1e-14};
+    auto e = tfel::math::Evaluator(f);
+    auto ce = tfel::math::Evaluator(f);
+    ce.compile();
+    TFEL_TESTS_ASSERT(ce.isCompiled());
+    TFEL_TESTS_ASSERT(!e.isCompiled());
+    for (const auto x : {-1.5, -0.2, 0., 0.3, 1.2, 2.7}) {
+      for (const auto y : {-0.7, 0.4, 1.9}) {
+        for (const auto& n : e.getVariablesNames()) {
+          e.setVariableValue(n, n == "x" ? x : y);
+          ce.setVariableValue(n, n == "x" ? x : y);
+        }
+        const auto v = e.getValue();
+        const auto cv = ce.getValue();
+        const auto ok = std::abs(v - cv) < eps * std::max(1., std::abs(v));
+        if (!ok) {
+          std::cerr << "ParserTest13::check: " << f << " (" << x << ", " << y
+                    << "): " << v << " vs " << cv << '\n';
+        }
+        TFEL_TESTS_ASSERT(ok);
+      }
+    }
+  }  // end of check
+  void test1() {
+    for (const auto& f :
+         {"x", "2", "x+y", "x-y", "x*y", "x/(y+2)", "-x", "-(x+y)*y",
+          "x**2", "x**3+y**-2", "abs(x)**(0.5)", "exp(x)+cos(y)*sin(x)",
+          "sqrt(abs(x))+atan(y)", "max(x,y)", "min(x,y)", "power<4>(x)",
+          "power<0>(x)", "H(x)+H(y)", "2*3+x", "(x+y)*(y+x)",
+          "sin(x)+sin(x)", "x>0 ? x : y", "x>=y ? x : 2*y",
+          "x<0 ? (y<0 ? x*y : -y) : 1", "(x>0)&&(y>0) ? 1 : 0",
+          "(x>0)||(y>0) ? 1 : 0", "!(x>0) ? 1 : -1", "x==0 ? 1 : x",
+          "x<=y ? x+y : x-y", "1>0 ? x : log(-1)", "1<0 ? log(-1) : y"}) {
+      this->check(f);
+    }
+  }  // end of test1
+  void test2() {
+    // constant folding and common subexpression elimination
+    auto e = tfel::math::Evaluator("2*3+x");
+    e.compile();
+    TFEL_TESTS_ASSERT(e.getBytecode()->getNumberOfInstructions() == 2);
+    auto e2 = tfel::math::Evaluator("sin(x)+sin(x)");
+    e2.compile();
+    TFEL_TESTS_ASSERT(e2.getBytecode()->getNumberOfInstructions() == 3);
+    auto e3 = tfel::math::Evaluator("exp(2)*cos(0)");
+    e3.compile();
+    TFEL_TESTS_ASSERT(e3.getBytecode()->getNumberOfInstructions() == 0);
+    TFEL_TESTS_ASSERT(std::abs(e3.getValue() - std::exp(2.)) < 1e-14);
+  }  // end of test2
+  void test3() {
+    // branches are only evaluated if selected
+    auto e = tfel::math::Evaluator("x>0 ? log(x) : 0");
+    e.compile();
+    e.setVariableValue("x", -1);
+    TFEL_TESTS_ASSERT(std::abs(e.getValue()) < 1e-14);
+    // errors are still reported
+    auto e2 = tfel::math::Evaluator("log(x)");
+    e2.compile();
+    e2.setVariableValue("x", -1);
+    TFEL_TESTS_CHECK_THROW(e2.getValue(), std::runtime_error);
+    auto e3 = tfel::math::Evaluator("1/x");
+    e3.compile();
+    e3.setVariableValue("x", 0);
+    TFEL_TESTS_CHECK_THROW(e3.getValue(), std::runtime_error);
+    // errors detected during constant folding are reported at runtime
+    auto e4 = tfel::math::Evaluator("x+log(-1)");
+    e4.compile();
+    e4.setVariableValue("x", 1);
+    TFEL_TESTS_CHECK_THROW(e4.getValue(), std::runtime_error);
+  }  // end of test3
+  void test4() {
+    // copies and dependencies
+    auto e = tfel::math::Evaluator("2*x+y");
+    e.compile();
+    e.setVariableValue("x", 2);
+    e.setVariableValue("y", 1);
+    auto e2 = e;
+    TFEL_TESTS_ASSERT(e2.isCompiled());
+    e2.setVariableValue("x", 3);
+    TFEL_TESTS_ASSERT(std::abs(e.getValue() - 5) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(e2.getValue() - 7) < 1e-14);
+    auto e3 = tfel::math::Evaluator("x");
+    e3 = e2;
+    TFEL_TESTS_ASSERT(e3.isCompiled());
+    TFEL_TESTS_ASSERT(std::abs(e3.getValue() - 7) < 1e-14);
+    e3.removeDependencies();
+    TFEL_TESTS_ASSERT(e3.isCompiled());
+    TFEL_TESTS_ASSERT(std::abs(e3.getValue() - 7) < 1e-14);
+  }  // end of test4
+  void test5() {
+    // comparison of the evaluation times
+    using namespace std::chrono;
+    constexpr auto n = std::size_t{200000};
+    const auto f = "x>0 ? exp(-x*y)*sin(x)+x**2*y : (x+y)*(x-y)/(1+y**2)";
+    auto e = tfel::math::Evaluator(f);
+    auto ce = tfel::math::Evaluator(f);
+    ce.compile();
+    auto measure = [](tfel::math::Evaluator& ev) {
+      auto s = double{};
+      const auto start = high_resolution_clock::now();
+      for (std::size_t i = 0; i != n; ++i) {
+        ev.setVariableValue("x", static_cast<double>(i % 100) / 50 - 1);
+        ev.setVariableValue("y", 0.5);
+        s += ev.getValue();
+      }
+      const auto stop = high_resolution_clock::now();
+      return std::make_pair(s, duration_cast<nanoseconds>(stop - start));
+    };
+    const auto r = measure(e);
+    const auto cr = measure(ce);
+    TFEL_TESTS_ASSERT(std::abs(r.first - cr.first) <
+                      1e-10 * std::max(1., std::abs(r.first)));
+    std::cout << "tree evaluation: " << r.second.count() / n
+              << " ns/evaluation\n"
+              << "bytecode evaluation: " << cr.second.count() / n
+              << " ns/evaluation\n";
+  }  // end of test5
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParserTest13, "ParserTest13");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("Parser13.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,196 @@
+/*!
+ * \file   tests/Math/parser14.cxx
+ * \brief  This file tests the evaluation of a formula for a set of
+ * values of the variables.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <span>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/Evaluator.hxx"
+
+struct ParserTest14 final : public tfel::tests::TestCase {
+  ParserTest14()
+      : tfel::tests::TestCase("TFEL/Math", "ParserTest14") {
+  }  // end of ParserTest14
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief number of values (not a multiple of the block size)
+  static constexpr std::size_t n = 1000;
+  //! \return values of the variable `x`
+  static std::vector<double> getXValues() {
+    auto x = std::vector<double>(n);
+    for (std::size_t i = 0; i != n; ++i) {
+      x[i] = static_cast<double>(i) / 250 - 2;
+    }
+    return x;
+  }  // end of getXValues
+  //! \return values of the variable `y`
+  static std::vector<double> getYValues() {
+    auto y = std::vector<double>(n);
+    for (std::size_t i = 0; i != n; ++i) {
+      y[i] = std::cos(static_cast<double>(i));
+    }
+    return y;
+  }  // end of getYValues
+  /*!
+   * \brief compare the evaluation for a set of values to the
+   * evaluation point by point.
+   */
+  void check(tfel::math::Evaluator& e) {
+    constexpr auto eps = double{1e-14};
+    const auto x = getXValues();
+    const auto y = getYValues();
+    auto columns = std::vector<std::span<const double>>{};
+    for (const auto& v : e.getVariablesNames()) {
+      columns.push_back(v == "x" ? std::span<const double>(x)
+                                 : std::span<const double>(y));
+    }
+    auto r = std::vector<double>(n);
+    e.evaluate(columns, r);
+    auto ok = true;
+    for (std::size_t i = 0; i != n; ++i) {
+      for (const auto& v : e.getVariablesNames()) {
+        e.setVariableValue(v, v == "x" ? x[i] : y[i]);
+      }
+      const auto v = e.getValue();
+      ok = ok && (std::abs(r[i] - v) < eps * std::max(1., std::abs(v)));
+    }
+    TFEL_TESTS_ASSERT(ok);
+  }  // end of check
+  void test1() {
+    for (const auto& f :
+         {"x", "2", "y-x", "x*y+2*x", "x/(y+2)", "-x", "x**2+y**-2",
+          "exp(x)+cos(y)*sin(x)", "sqrt(abs(x))", "max(x,y)", "H(x)",
+          "power<3>(x)", "x>0 ? x : y", "x>y ? sqrt(x-y) : 0",
+          "x<-1 ? (y<0 ? x*y : -y) : 1", "(x>0)&&(y>0) ? 1 : 0",
+          "(x>0)||(y>0) ? 1 : 0", "!(x>0) ? 1 : -1"}) {
+      auto e = tfel::math::Evaluator(f);
+      this->check(e);
+      e.compile();
+      this->check(e);
+    }
+  }  // end of test1
+  void test2() {
+    // the columns are sorted as the variables names, which may differ
+    // from the order of appearance of the variables in the formula
+    auto e = tfel::math::Evaluator("y-x");
+    const auto x = std::vector<double>{1, 2, 3};
+    const auto y = std::vector<double>{4, 6, 8};
+    auto r = std::vector<double>(3);
+    e.evaluate(std::vector<std::span<const double>>{x, y}, r);
+    TFEL_TESTS_ASSERT(std::abs(r[0] - 3) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(r[1] - 4) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(r[2] - 5) < 1e-14);
+  }  // end of test2
+  void test3() {
+    // errors
+    const auto x = getXValues();
+    auto r = std::vector<double>(n);
+    auto e = tfel::math::Evaluator("log(x)");
+    e.compile();
+    TFEL_TESTS_CHECK_THROW(
+        e.evaluate(std::vector<std::span<const double>>{x}, r),
+        std::runtime_error);
+    auto e2 = tfel::math::Evaluator("1/x");
+    TFEL_TESTS_CHECK_THROW(
+        e2.evaluate(std::vector<std::span<const double>>{x}, r),
+        std::runtime_error);
+    auto e3 = tfel::math::Evaluator("x>0 ? log(x) : 0");
+    e3.evaluate(std::vector<std::span<const double>>{x}, r);
+    TFEL_TESTS_ASSERT(std::abs(r[0]) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(r[n - 1] - std::log(x[n - 1])) < 1e-14);
+    // invalid number of columns
+    TFEL_TESTS_CHECK_THROW(e3.evaluate({}, r), std::runtime_error);
+    // invalid size
+    auto r2 = std::vector<double>(n - 1);
+    TFEL_TESTS_CHECK_THROW(
+        e3.evaluate(std::vector<std::span<const double>>{x}, r2),
+        std::runtime_error);
+  }  // end of test3
+  void test4() {
+    // expressions calling external functions are not vectorizable
+    using namespace tfel::math::parser;
+    auto manager = std::make_shared<ExternalFunctionManager>();
+    manager->operator[]("f") = std::make_shared<tfel::math::Evaluator>(
+        std::vector<std::string>{"x"}, "2*exp(x)", manager);
+    auto e = tfel::math::Evaluator(std::vector<std::string>{"x", "y"},
+                                   "y*f(x)", manager);
+    e.compile();
+    TFEL_TESTS_ASSERT(!e.getBytecode()->isVectorizable());
+    this->check(e);
+  }  // end of test4
+  void test5() {
+    // comparison of the evaluation times
+    using namespace std::chrono;
+    constexpr auto m = std::size_t{200};
+    const auto x = getXValues();
+    const auto y = getYValues();
+    const auto f = "exp(-x*y)*sin(x)+x**2*y-(x+y)*(x-y)/(1+y**2)";
+    auto e = tfel::math::Evaluator(f);
+    e.compile();
+    auto r = std::vector<double>(n);
+    auto r2 = std::vector<double>(n);
+    const auto start = high_resolution_clock::now();
+    for (std::size_t k = 0; k != m; ++k) {
+      for (std::size_t i = 0; i != n; ++i) {
+        e.setVariableValue("x", x[i]);
+        e.setVariableValue("y", y[i]);
+        r[i] = e.getValue();
+      }
+    }
+    const auto middle = high_resolution_clock::now();
+    for (std::size_t k = 0; k != m; ++k) {
+      e.evaluate(std::vector<std::span<const double>>{x, y}, r2);
+    }
+    const auto stop = high_resolution_clock::now();
+    auto ok = true;
+    for (std::size_t i = 0; i != n; ++i) {
+      ok = ok && (std::abs(r[i] - r2[i]) <
+                  1e-14 * std::max(1., std::abs(r[i])));
+    }
+    TFEL_TESTS_ASSERT(ok);
+    const auto d1 = duration_cast<nanoseconds>(middle - start).count();
+    const auto d2 = duration_cast<nanoseconds>(stop - middle).count();
+    std::cout << "point by point evaluation: " << d1 / (n * m)
+              << " ns/value\n"
+              << "evaluation by blocks: " << d2 / (n * m) << " ns/value\n";
+  }  // end of test5
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParserTest14, "ParserTest14");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("Parser14.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
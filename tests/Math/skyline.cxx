@@ -0,0 +1,154 @@
+/*!
+ * \file   tests/Math/skyline.cxx
+ * \brief  This file tests the `SkylineMatrix` class and the
+ * `SkylineLUSolve` solver.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <limits>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/SkylineMatrix.hxx"
+#include "TFEL/Math/SkylineLUSolve.hxx"
+
+struct SkylineMatrixTest final : public tfel::tests::TestCase {
+  SkylineMatrixTest()
+      : tfel::tests::TestCase("TFEL/Math", "SkylineMatrixTest") {
+  }  // end of SkylineMatrixTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  using size_type = tfel::math::SkylineMatrix<double>::size_type;
+  //! \brief a non symmetric banded matrix bordered by a full row and column
+  static double value(const size_type i, const size_type j, const size_type n) {
+    if (i == j) {
+      return 4 + 0.1 * i;
+    }
+    if ((i == n) || (j == n)) {
+      return 0.01 * (1 + i) - 0.02 * j;
+    }
+    return (i > j) ? -1 + 0.01 * j : -0.5 - 0.03 * i;
+  }
+  void test1() {
+    // profile and access
+    auto m = tfel::math::SkylineMatrix<double>(
+        tfel::math::SkylineMatrix<double>::getBandedProfile(5, 1, 1));
+    TFEL_TESTS_ASSERT(m.getNbRows() == 6);
+    TFEL_TESTS_ASSERT(m.getNbCols() == 6);
+    TFEL_TESTS_ASSERT(m.isInProfile(2, 1));
+    TFEL_TESTS_ASSERT(m.isInProfile(1, 2));
+    TFEL_TESTS_ASSERT(!m.isInProfile(3, 1));
+    TFEL_TESTS_ASSERT(!m.isInProfile(1, 3));
+    TFEL_TESTS_ASSERT(m.isInProfile(5, 0));
+    TFEL_TESTS_ASSERT(m.isInProfile(0, 5));
+    m(1, 2) = 3;
+    m(2, 1) = -2;
+    m(0, 5) = 7;
+    const auto& cm = m;
+    TFEL_TESTS_ASSERT(std::abs(cm(1, 2) - 3) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(cm(2, 1) + 2) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(cm(0, 5) - 7) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(cm(5, 0)) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(cm(3, 1)) < 1e-14);
+    TFEL_TESTS_CHECK_THROW(m(3, 1) = 1, std::out_of_range);
+    m.zero();
+    TFEL_TESTS_ASSERT(std::abs(cm(1, 2)) < 1e-14);
+  }
+  void test2() {
+    // comparison with the dense LU solver
+    constexpr auto eps = 1e-12;
+    for (const size_type b : {1, 2, 3}) {
+      const size_type n = 30;
+      auto m = tfel::math::SkylineMatrix<double>(
+          tfel::math::SkylineMatrix<double>::getBandedProfile(n, b, 1));
+      auto k = tfel::math::matrix<double>(n + 1, n + 1, 0.);
+      auto x = tfel::math::vector<double>(n + 1);
+      for (size_type i = 0; i != n + 1; ++i) {
+        x(i) = 1 + 0.2 * i - 0.003 * i * i;
+        for (size_type j = 0; j != n + 1; ++j) {
+          if (m.isInProfile(i, j)) {
+            m(i, j) = k(i, j) = value(i, j, n);
+          }
+        }
+      }
+      auto r1 = tfel::math::vector<double>(n + 1);
+      for (size_type i = 0; i != n + 1; ++i) {
+        r1(i) = 0;
+        for (size_type j = 0; j != n + 1; ++j) {
+          r1(i) += k(i, j) * x(j);
+        }
+      }
+      auto r2 = r1;
+      tfel::math::LUSolve::exe(k, r1);
+      tfel::math::SkylineLUSolve::exe(m, r2);
+      for (size_type i = 0; i != n + 1; ++i) {
+        TFEL_TESTS_ASSERT(std::abs(r1(i) - x(i)) < eps);
+        TFEL_TESTS_ASSERT(std::abs(r2(i) - x(i)) < eps);
+      }
+      // reuse of the decomposition
+      auto r3 = tfel::math::vector<double>(n + 1, 0.);
+      r3(n) = 1;
+      auto r4 = r3;
+      tfel::math::SkylineLUSolve::back_substitute(m, r3);
+      auto p = tfel::math::Permutation<size_type>(n + 1);
+      auto tmp = tfel::math::vector<double>(n + 1);
+      for (size_type i = 0; i != n + 1; ++i) {
+        for (size_type j = 0; j != n + 1; ++j) {
+          k(i, j) = m.isInProfile(i, j) ? value(i, j, n) : 0;
+        }
+      }
+      tfel::math::LUSolve::exe(k, r4, tmp, p);
+      for (size_type i = 0; i != n + 1; ++i) {
+        TFEL_TESTS_ASSERT(std::abs(r3(i) - r4(i)) < eps);
+      }
+    }
+  }
+  void test3() {
+    // null pivot detection
+    auto m = tfel::math::SkylineMatrix<double>(
+        tfel::math::SkylineMatrix<double>::getBandedProfile(3, 1));
+    m(0, 0) = 1;
+    m(0, 1) = 1;
+    m(1, 0) = 1;
+    m(1, 1) = 1;
+    m(2, 2) = 1;
+    auto r = tfel::math::vector<double>(3, 1.);
+    TFEL_TESTS_CHECK_THROW(tfel::math::SkylineLUSolve::exe(m, r),
+                           tfel::math::LUNullPivot);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(SkylineMatrixTest, "SkylineMatrixTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("skyline.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,203 @@
+/*!
+ * \file   tests/Math/stensor/StensorBatchedEigenSolverTest.cxx
+ * \brief  This file compares the `StensorBatchedEigenSolver` class to the
+ * eigen solvers of the `stensor` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorBatchedEigenSolver.hxx"
+
+//! \brief a reproducible pseudo-random number generator
+struct RandomNumberGenerator {
+  double operator()(const double a, const double b) {
+    this->state = (this->state * 1103515245u + 12345u) % 2147483648u;
+    return a + (b - a) * static_cast<double>(this->state) / 2147483648.;
+  }
+  unsigned long long state = 12345u;
+};
+
+template <unsigned short N, typename real>
+static std::vector<tfel::math::stensor<N, real>> getTensors() {
+  using namespace tfel::math;
+  using stensor = tfel::math::stensor<N, real>;
+  auto g = RandomNumberGenerator{};
+  auto tensors = std::vector<stensor>{};
+  // random tensors. The number of tensors is not a multiple of the size
+  // of the blocks
+  for (std::size_t i = 0; i != 101; ++i) {
+    auto s = stensor{};
+    for (auto& v : s) {
+      v = static_cast<real>(g(-1, 1));
+    }
+    tensors.push_back(s);
+  }
+  // special cases
+  tensors.push_back(stensor(real(0)));
+  tensors.push_back(real(2) * stensor::Id());
+  const auto s0 = tensors[0];
+  const auto s1 = tensors[1];
+  tensors.push_back(real(1e10) * s0);
+  tensors.push_back(real(1e-10) * s1);
+  if constexpr (N > 1) {
+    // two equal eigen values
+    auto s = stensor(real(0));
+    s[0] = s[1] = real(1);
+    s[2] = real(2);
+    tensors.push_back(s);
+    s[3] = real(0.5);
+    tensors.push_back(s);
+    const auto s2 = tensors[2];
+    const auto s3 = tensors[3];
+    tensors.push_back(s2 + real(1e-12) * s3);
+  }
+  return tensors;
+}  // end of getTensors
+
+//! \return the norm of a symmetric tensor
+template <unsigned short N, typename real>
+static real norm(const tfel::math::stensor<N, real>& s) {
+  return std::sqrt(s | s);
+}  // end of norm
+
+struct StensorBatchedEigenSolverTest final : public tfel::tests::TestCase {
+  StensorBatchedEigenSolverTest()
+      : tfel::tests::TestCase("TFEL/Math", "StensorBatchedEigenSolverTest") {
+  }  // end of StensorBatchedEigenSolverTest
+  tfel::tests::TestResult execute() override {
+    this->test<1u, double>();
+    this->test<2u, double>();
+    this->test<3u, double>();
+    this->test<3u, float>();
+    this->test2();
+    return this->result;
+  }  // end of execute
+
+ private:
+  /*!
+   * \brief compare the eigen values and eigen vectors to the ones
+   * computed by the iterative scalar solvers. The analytical solvers are
+   * not used as references since they are less accurate when two eigen
+   * values are close.
+   */
+  template <unsigned short N, typename real>
+  void test() {
+    using namespace tfel::math;
+    using Solver = StensorBatchedEigenSolver<N, real>;
+    constexpr auto ssize = StensorDimeToSize<N>::value;
+    const auto eps = 100 * std::numeric_limits<real>::epsilon();
+    const auto tensors = getTensors<N, real>();
+    const auto n = tensors.size();
+    auto s = std::vector<real>(ssize * n);
+    for (std::size_t i = 0; i != n; ++i) {
+      for (unsigned short c = 0; c != ssize; ++c) {
+        s[c * n + i] = tensors[i][c];
+      }
+    }
+    auto vp = std::vector<real>(3 * n);
+    auto m = std::vector<real>(9 * n);
+    Solver::computeEigenValues(vp, s, stensor_common::ASCENDING);
+    for (std::size_t i = 0; i != n; ++i) {
+      const auto& t = tensors[i];
+      const auto nrm = std::max(norm(t), real(1));
+      for (const auto vp_ref :
+           {t.template computeEigenValues<
+                stensor_common::FSESJACOBIEIGENSOLVER>(
+                stensor_common::ASCENDING),
+            t.template computeEigenValues<
+                stensor_common::GTESYMMETRICQREIGENSOLVER>(
+                stensor_common::ASCENDING)}) {
+        for (unsigned short k = 0; k != 3; ++k) {
+          TFEL_TESTS_ASSERT(std::abs(vp[k * n + i] - vp_ref[k]) < eps * nrm);
+        }
+      }
+    }
+    Solver::computeEigenVectors(vp, m, s, stensor_common::DESCENDING);
+    for (std::size_t i = 0; i != n; ++i) {
+      const auto& t = tensors[i];
+      const auto nrm = std::max(norm(t), real(1));
+      const auto vp_ref = t.template computeEigenValues<
+          stensor_common::GTESYMMETRICQREIGENSOLVER>(
+          stensor_common::DESCENDING);
+      auto r = rotation_matrix<real>{};
+      for (unsigned short k = 0; k != 9; ++k) {
+        r(k / 3, k % 3) = m[k * n + i];
+      }
+      for (unsigned short k = 0; k != 3; ++k) {
+        TFEL_TESTS_ASSERT(std::abs(vp[k * n + i] - vp_ref[k]) < eps * nrm);
+        // the rotation matrix is orthogonal
+        for (unsigned short l = 0; l != 3; ++l) {
+          auto v = real(0);
+          for (unsigned short j = 0; j != 3; ++j) {
+            v += r(j, k) * r(j, l);
+          }
+          TFEL_TESTS_ASSERT(std::abs(v - (k == l ? 1 : 0)) < eps);
+        }
+      }
+      if constexpr (N == 1) {
+        TFEL_TESTS_ASSERT(std::abs(std::abs(r(0, 0)) - 1) < eps);
+        TFEL_TESTS_ASSERT(std::abs(std::abs(r(1, 1)) - 1) < eps);
+        TFEL_TESTS_ASSERT(std::abs(std::abs(r(2, 2)) - 1) < eps);
+      }
+      if constexpr (N == 2) {
+        // the out of plane direction is an eigen vector
+        for (unsigned short k = 0; k != 2; ++k) {
+          TFEL_TESTS_ASSERT(std::abs(r(2, k)) + std::abs(r(k, 2)) < eps);
+        }
+      }
+      // the tensor is recovered from its eigen values and eigen vectors
+      const auto t2 = stensor<N, real>::buildFromEigenValuesAndVectors(
+          vp[i], vp[n + i], vp[2 * n + i], r);
+      TFEL_TESTS_ASSERT(norm(stensor<N, real>(t - t2)) < eps * nrm);
+    }
+  }  // end of test
+  //! \brief invalid sizes
+  void test2() {
+    using Solver = tfel::math::StensorBatchedEigenSolver<3u, double>;
+    auto s = std::vector<double>(6 * 4, 0.);
+    auto vp = std::vector<double>(3 * 4);
+    auto m = std::vector<double>(9 * 4);
+    TFEL_TESTS_CHECK_THROW(
+        Solver::computeEigenValues(vp, std::span<const double>(s).first(5)),
+        std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(
+        Solver::computeEigenValues(std::span<double>(vp).first(3), s),
+        std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(
+        Solver::computeEigenVectors(vp, std::span<double>(m).first(9), s),
+        std::runtime_error);
+    // no tensors
+    Solver::computeEigenVectors(std::span<double>{}, std::span<double>{},
+                                std::span<const double>{});
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(StensorBatchedEigenSolverTest,
+                          "StensorBatchedEigenSolverTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("StensorBatchedEigenSolverTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
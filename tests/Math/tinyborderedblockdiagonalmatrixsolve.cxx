@@ -0,0 +1,116 @@
+/*!
+ * \file   tests/Math/tinyborderedblockdiagonalmatrixsolve.cxx
+ * \brief  This file tests the `TinyBorderedBlockDiagonalMatrixSolve`
+ * class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/TinyMatrixSolve.hxx"
+#include "TFEL/Math/TinyBorderedBlockDiagonalMatrixSolve.hxx"
+
+struct TinyBorderedBlockDiagonalMatrixSolveTest final
+    : public tfel::tests::TestCase {
+  TinyBorderedBlockDiagonalMatrixSolveTest()
+      : tfel::tests::TestCase("TFEL/Math",
+                              "TinyBorderedBlockDiagonalMatrixSolveTest") {
+  }  // end of TinyBorderedBlockDiagonalMatrixSolveTest
+  tfel::tests::TestResult execute() override {
+    this->test<3, 2>();
+    this->test<4, 3>();
+    this->test<5, 1>();
+    this->test<3, 0>();
+    this->test2();
+    return this->result;
+  }  // end of execute
+ private:
+  /*!
+   * \brief build a system made of `Nb` blocks of size `Bs` and of a
+   * border of size `Nc`, whose unknowns are interleaved as for an array
+   * of per-block variables followed by a global variable, and compare
+   * the solution to the one given by `TinyMatrixSolve`.
+   */
+  template <unsigned short Nb, unsigned short Nc>
+  void test() {
+    using namespace tfel::math;
+    constexpr unsigned short Bs = 2;
+    constexpr unsigned short N = Nb * Bs + Nc;
+    using Solver = TinyBorderedBlockDiagonalMatrixSolve<N, Nb, Bs, double>;
+    // the first unknown of each block comes first, then the second
+    // ones, then the border
+    auto p = typename Solver::Permutation{};
+    for (unsigned short i = 0; i != Nb; ++i) {
+      p[i * Bs] = i;
+      p[i * Bs + 1] = Nb + i;
+    }
+    for (unsigned short i = 0; i != Nc; ++i) {
+      p[Nb * Bs + i] = Nb * Bs + i;
+    }
+    // block index of an unknown of the original system, Nb for the border
+    auto block = [](const unsigned short i) -> unsigned short {
+      if (i >= Nb * Bs) {
+        return Nb;
+      }
+      return i % Nb;
+    };
+    auto m = tmatrix<N, N, double>(0);
+    auto b = tvector<N, double>{};
+    for (unsigned short i = 0; i != N; ++i) {
+      b(i) = 1 + 0.3 * i - 0.05 * i * i;
+      for (unsigned short j = 0; j != N; ++j) {
+        if (i == j) {
+          m(i, j) = 5 + 0.1 * i;
+        } else if ((block(i) == block(j)) || (block(i) == Nb) ||
+                   (block(j) == Nb)) {
+          m(i, j) = std::sin(1. + i + 2 * j);
+        }
+      }
+    }
+    auto m2 = m;
+    auto b2 = b;
+    TFEL_TESTS_ASSERT(Solver::exe(m, b, p));
+    TFEL_TESTS_ASSERT((TinyMatrixSolve<N, double>::exe(m2, b2)));
+    for (unsigned short i = 0; i != N; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(b(i) - b2(i)) < 1e-13);
+    }
+  }
+  void test2() {
+    // a null pivot in a block is reported
+    using namespace tfel::math;
+    using Solver = TinyBorderedBlockDiagonalMatrixSolve<3, 1, 2, double, false>;
+    auto m = tmatrix<3, 3, double>(0);
+    auto b = tvector<3, double>(1);
+    m(2, 2) = 1;
+    TFEL_TESTS_ASSERT(!Solver::exe(m, b, {0, 1, 2}));
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TinyBorderedBlockDiagonalMatrixSolveTest,
+                          "TinyBorderedBlockDiagonalMatrixSolveTest");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tinyborderedblockdiagonalmatrixsolve.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
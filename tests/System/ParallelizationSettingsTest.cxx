@@ -0,0 +1,65 @@
+/*!
+ * \file   ParallelizationSettingsTest.cxx
+ * \brief  This file tests the `getParallelizationSettings` function.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdlib.h>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ParallelizationSettings.hxx"
+
+//! \brief expected number of threads
+static tfel::system::ThreadPool::size_type expected_number_of_threads = 0;
+
+struct ParallelizationSettingsTest final : public tfel::tests::TestCase {
+  ParallelizationSettingsTest()
+      : tfel::tests::TestCase("TFEL/System", "ParallelizationSettingsTest") {
+  }  // end of ParallelizationSettingsTest
+  tfel::tests::TestResult execute() override {
+    const auto& s = tfel::system::getParallelizationSettings();
+    TFEL_TESTS_ASSERT(s.number_of_threads == expected_number_of_threads);
+    TFEL_TESTS_ASSERT(tfel::system::getSharedThreadPool().getNumberOfThreads() ==
+                      expected_number_of_threads - 1);
+    return this->result;
+  }  // end of execute
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParallelizationSettingsTest,
+                          "ParallelizationSettingsTest");
+
+/*!
+ * usage: ParallelizationSettingsTest expected [TFEL_NUMBER_OF_THREADS
+ * [ABAQUSEXPLICIT_NTHREADS]]. An empty value leaves the variable undefined.
+ */
+int main(const int argc, const char* const* const argv) {
+  if ((argc < 2) || (argc > 4)) {
+    std::cerr << "ParallelizationSettingsTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  expected_number_of_threads = std::stoul(argv[1]);
+  auto set = [argc, argv](const char* const n, const int i) {
+    if ((i < argc) && (argv[i][0] != '\0')) {
+      ::setenv(n, argv[i], 1);
+    } else {
+      ::unsetenv(n);
+    }
+  };
+  set("TFEL_NUMBER_OF_THREADS", 2);
+  set("ABAQUSEXPLICIT_NTHREADS", 3);
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ParallelizationSettingsTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
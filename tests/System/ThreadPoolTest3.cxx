@@ -0,0 +1,129 @@
+/*!
+ * \file   ThreadPoolTest3.cxx
+ * \brief  This file tests the `parallel_for` methods of the `ThreadPool`
+ * class.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <atomic>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+
+struct ThreadPoolTest3 final : public tfel::tests::TestCase {
+  ThreadPoolTest3()
+      : tfel::tests::TestCase("TFEL/System", "ThreadPoolTest3") {
+  }  // end of ThreadPoolTest3
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    return this->result;
+  }  // end of execute
+ private:
+  using size_type = tfel::system::ThreadPool::size_type;
+  void test1() {
+    // each index is treated once, for various grain sizes
+    tfel::system::ThreadPool p(3);
+    for (const size_type g : {0, 1, 7, 1000, 5000}) {
+      auto v = std::vector<int>(1000, 0);
+      p.parallel_for(0, v.size(), g, [&v](const size_type i) { ++(v[i]); });
+      auto ok = true;
+      for (const auto& c : v) {
+        ok = ok && (c == 1);
+      }
+      TFEL_TESTS_ASSERT(ok);
+    }
+    // sub-range and empty range
+    std::atomic<size_type> s(0);
+    p.parallel_for(10, 20, 3, [&s](const size_type i) { s += i; });
+    TFEL_TESTS_ASSERT(s == 145);
+    p.parallel_for(20, 20, 3, [&s](const size_type i) { s += i; });
+    TFEL_TESTS_ASSERT(s == 145);
+  }
+  void test2() {
+    // exceptions are forwarded to the caller
+    tfel::system::ThreadPool p(2);
+    std::atomic<int> n(0);
+    TFEL_TESTS_CHECK_THROW(
+        p.parallel_for(0, 100, 1,
+                       [&n](const size_type i) {
+                         ++n;
+                         if (i == 50) {
+                           throw(std::runtime_error("test"));
+                         }
+                       }),
+        std::runtime_error);
+    TFEL_TESTS_ASSERT(n <= 100);
+    // the pool is still usable
+    std::atomic<int> s(0);
+    p.parallel_for(0, 10, 1, [&s](const size_type) { ++s; });
+    TFEL_TESTS_ASSERT(s == 10);
+  }
+  void test3() {
+    // nested calls from the workers
+    tfel::system::ThreadPool p(2);
+    std::atomic<size_type> s(0);
+    p.parallel_for(0, 8, 1, [&p, &s](const size_type) {
+      p.parallel_for(0, 100, 10, [&s](const size_type j) { s += j; });
+    });
+    TFEL_TESTS_ASSERT(s == 8 * 4950);
+  }
+  void test4() {
+    // tasks added from the workers and global wait
+    tfel::system::ThreadPool p(2);
+    std::atomic<int> s(0);
+    for (int i = 0; i != 10; ++i) {
+      p.addTask([&p, &s] {
+        for (int j = 0; j != 10; ++j) {
+          p.addTask([&s] { ++s; });
+        }
+      });
+    }
+    p.wait();
+    TFEL_TESTS_ASSERT(s == 100);
+  }
+  void test5() {
+    // each index is treated once, for every partitioning
+    using Partitioning = tfel::system::ThreadPool::Partitioning;
+    tfel::system::ThreadPool p(3);
+    for (const auto pt :
+         {Partitioning::STATIC, Partitioning::DYNAMIC, Partitioning::GUIDED}) {
+      for (const size_type n : {1, 3, 4, 1000, 1001}) {
+        for (const size_type g : {0, 1, 7, 2000}) {
+          auto v = std::vector<int>(n + 5, 0);
+          p.parallel_for(pt, 5, n + 5, g,
+                         [&v](const size_type i) { ++(v[i]); });
+          auto ok = true;
+          for (size_type i = 0; i != v.size(); ++i) {
+            ok = ok && (v[i] == ((i < 5) ? 0 : 1));
+          }
+          TFEL_TESTS_ASSERT(ok);
+        }
+      }
+    }
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(ThreadPoolTest3, "ThreadPoolTest3");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ThreadPoolTest3.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,193 @@
+/*!
+ * \file   tests/Utilities/BinaryDataTest.cxx
+ * \brief  This file tests the `BinaryDataWriter` and `BinaryData` classes.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
+
+struct BinaryDataTest final : public tfel::tests::TestCase {
+  BinaryDataTest()
+      : tfel::tests::TestCase("TFEL/Utilities", "BinaryDataTest") {}
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \return the content of a file
+  static std::string read(const std::string& f) {
+    std::ifstream in(f, std::ios::in | std::ios::binary);
+    return {std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>()};
+  }
+  //! \brief write and read a file
+  void test1() {
+    using namespace tfel::utilities;
+    const auto f = std::string{"BinaryDataTest-1.npy"};
+    {
+      auto w = BinaryDataWriter(f, {"t", "SXX", "it's"});
+      TFEL_TESTS_ASSERT(w.getNumberOfColumns() == 3);
+      w.write(std::vector<double>{0, 1, -1});
+      w.write(std::vector<double>{1, 0.1, 1e-300});
+      TFEL_TESTS_CHECK_THROW(w.write(std::vector<double>{1, 2}),
+                             std::runtime_error);
+      TFEL_TESTS_ASSERT(w.getNumberOfLines() == 2);
+      // the header is updated when the file is flushed
+      w.flush();
+      const auto d = BinaryData(f);
+      TFEL_TESTS_ASSERT(d.getNumberOfLines() == 2);
+      w.write(std::vector<double>{2, 1.0 / 3, -4});
+    }
+    // the size of the header is a multiple of 64 bytes
+    const auto c = read(f);
+    TFEL_TESTS_ASSERT(c.substr(0, 6) == "\x93NUMPY");
+    TFEL_TESTS_ASSERT((c.size() - 3 * 3 * sizeof(double)) % 64 == 0);
+    TFEL_TESTS_ASSERT(c.find("'shape': (3,)") != std::string::npos);
+    TFEL_TESTS_ASSERT(BinaryData::isBinaryDataFile(f));
+    for (const auto b : {true, false}) {
+      auto d = BinaryData(f, b);
+      TFEL_TESTS_ASSERT(d.getNumberOfColumns() == 3);
+      TFEL_TESTS_ASSERT(d.getNumberOfLines() == 3);
+      TFEL_TESTS_ASSERT(d.getLegends().size() == 3);
+      TFEL_TESTS_ASSERT(d.getLegend(2) == "SXX");
+      TFEL_TESTS_ASSERT(d.getLegend(3) == "it's");
+      TFEL_TESTS_ASSERT(d.getLegend(4).empty());
+      TFEL_TESTS_ASSERT(d.findColumn("SXX") == 2);
+      TFEL_TESTS_CHECK_THROW(d.findColumn("EXX"), std::runtime_error);
+      TFEL_TESTS_CHECK_THROW(d.getColumn(0), std::runtime_error);
+      TFEL_TESTS_CHECK_THROW(d.getColumn(4), std::runtime_error);
+      // values are stored exactly
+      TFEL_TESTS_ASSERT(d.getColumn(1) == (std::vector<double>{0, 1, 2}));
+      TFEL_TESTS_ASSERT(d.getColumn(2) ==
+                        (std::vector<double>{1, 0.1, 1.0 / 3}));
+      TFEL_TESTS_ASSERT(d.getColumn(3) ==
+                        (std::vector<double>{-1, 1e-300, -4}));
+      d.skipLines(2);
+      TFEL_TESTS_ASSERT(d.getNumberOfLines() == 1);
+      TFEL_TESTS_ASSERT(d.getColumn(2) == (std::vector<double>{1.0 / 3}));
+    }
+  }  // end of test1
+  //! \brief reading a binary file with the `TextData` class
+  void test2() {
+    using namespace tfel::utilities;
+    const auto f = std::string{"BinaryDataTest-2.npy"};
+    {
+      auto w = BinaryDataWriter(f, {"t", "EXX"});
+      for (int i = 0; i != 4; ++i) {
+        w.write(std::vector<double>{double(i), 0.1 * i});
+      }
+    }
+    auto d = TextData(f);
+    TFEL_TESTS_ASSERT(d.getBinaryData() != nullptr);
+    TFEL_TESTS_ASSERT(d.getNumericTextData() == nullptr);
+    TFEL_TESTS_ASSERT(d.findColumn("EXX") == 2);
+    TFEL_TESTS_ASSERT(d.getLegend(1) == "t");
+    TFEL_TESTS_ASSERT(d.getColumn(2) ==
+                      (std::vector<double>{0, 0.1, 0.2, 0.1 * 3}));
+    TFEL_TESTS_CHECK_THROW(d.getColumn(3), std::runtime_error);
+    // tokens allow to recover the values exactly
+    TFEL_TESTS_ASSERT(std::distance(d.begin(), d.end()) == 4);
+    const auto& l = *(d.begin() + 3);
+    TFEL_TESTS_ASSERT(l.tokens.size() == 2);
+    TFEL_TESTS_ASSERT(std::abs(std::stod(l.tokens[1].value) - 0.1 * 3) <
+                      1e-17);
+    d.skipLines(1);
+    TFEL_TESTS_ASSERT(std::distance(d.begin(), d.end()) == 3);
+    TFEL_TESTS_ASSERT(d.getColumn(1) == (std::vector<double>{1, 2, 3}));
+  }  // end of test2
+  //! \brief reading a two dimensional array stored by columns
+  void test3() {
+    using namespace tfel::utilities;
+    const auto f = std::string{"BinaryDataTest-3.npy"};
+    {
+      const auto* const t =
+          std::endian::native == std::endian::little ? "'<f8'" : "'>f8'";
+      auto h = std::string{"{'descr': "} + t +
+               ", 'fortran_order': True, 'shape': (3, 2), }";
+      h.resize(128 - 10 - 1, ' ');
+      h += '\n';
+      std::ofstream out(f, std::ios::out | std::ios::binary);
+      out.write("\x93NUMPY\x01\x00", 8);
+      out.put(static_cast<char>(h.size()));
+      out.put('\0');
+      out << h;
+      const double v[] = {1, 2, 3, 4, 5, 6};
+      out.write(reinterpret_cast<const char*>(v), sizeof(v));
+    }
+    const auto d = BinaryData(f);
+    TFEL_TESTS_ASSERT(d.getNumberOfColumns() == 2);
+    TFEL_TESTS_ASSERT(d.getNumberOfLines() == 3);
+    TFEL_TESTS_ASSERT(d.getLegends().empty());
+    TFEL_TESTS_ASSERT(d.getColumn(1) == (std::vector<double>{1, 2, 3}));
+    TFEL_TESTS_ASSERT(d.getColumn(2) == (std::vector<double>{4, 5, 6}));
+  }  // end of test3
+  //! \brief invalid files and column names
+  void test4() {
+    using namespace tfel::utilities;
+    TFEL_TESTS_CHECK_THROW(BinaryDataWriter("BinaryDataTest-4.npy", {}),
+                           std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(BinaryDataWriter("BinaryDataTest-4.npy", {"a", ""}),
+                           std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(
+        BinaryDataWriter("BinaryDataTest-4.npy", {"a", "b", "a"}),
+        std::runtime_error);
+    {
+      std::ofstream out("BinaryDataTest-4.txt");
+      out << "# t EXX\n0 1\n";
+    }
+    TFEL_TESTS_ASSERT(!BinaryData::isBinaryDataFile("BinaryDataTest-4.txt"));
+    TFEL_TESTS_CHECK_THROW(BinaryData("BinaryDataTest-4.txt"),
+                           std::runtime_error);
+    // truncated file
+    {
+      auto w = BinaryDataWriter("BinaryDataTest-4.npy", {"a", "b"});
+      w.write(std::vector<double>{1, 2});
+    }
+    const auto c = read("BinaryDataTest-4.npy");
+    {
+      std::ofstream out("BinaryDataTest-4.npy",
+                        std::ios::out | std::ios::binary);
+      out.write(c.data(), static_cast<std::streamsize>(c.size() - 1));
+    }
+    TFEL_TESTS_CHECK_THROW(BinaryData("BinaryDataTest-4.npy"),
+                           std::runtime_error);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(BinaryDataTest, "BinaryDataTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BinaryDataTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,194 @@
+/*!
+ * \file   tests/Utilities/TextDataTest.cxx
+ * \brief  This file tests the `TextData` and `NumericTextData` classes.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/NumericTextData.hxx"
+
+struct TextDataTest final : public tfel::tests::TestCase {
+  TextDataTest() : tfel::tests::TestCase("TFEL/Utilities", "TextDataTest") {}
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    return this->result;
+  }  // end of execute
+
+ private:
+  static void write(const std::string& f, const std::string& c) {
+    std::ofstream out(f);
+    out << c;
+  }
+  bool check(const std::vector<double>& v, const std::vector<double>& r) {
+    if (v.size() != r.size()) {
+      return false;
+    }
+    for (std::vector<double>::size_type i = 0; i != v.size(); ++i) {
+      if (std::abs(v[i] - r[i]) > 1e-14 * std::max(1., std::abs(r[i]))) {
+        return false;
+      }
+    }
+    return true;
+  }
+  void test1() {
+    using namespace tfel::utilities;
+    write("TextDataTest-1.txt",
+          "# time 'stress xx' EXX\n"
+          "# a comment\n"
+          "0 1 -1\n"
+          "\n"
+          "1. +2.5e-3 -.5\n"
+          "2\t1E+2\t3e-2\r\n"
+          "# an ignored comment\n"
+          "3 4 5");
+    for (const auto b : {true, false}) {
+      const auto d = NumericTextData("TextDataTest-1.txt",
+                                     NumericTextData::Options{"", b});
+      TFEL_TESTS_ASSERT(d.getNumberOfColumns() == 3);
+      TFEL_TESTS_ASSERT(d.getNumberOfLines() == 4);
+      TFEL_TESTS_ASSERT(d.getLegends().size() == 3);
+      TFEL_TESTS_ASSERT(d.getLegend(2) == "stress xx");
+      TFEL_TESTS_ASSERT(d.getLegend(4).empty());
+      TFEL_TESTS_ASSERT(d.findColumn("EXX") == 3);
+      TFEL_TESTS_ASSERT(d.getPreamble().size() == 2);
+      TFEL_TESTS_ASSERT(check(d.getColumn(1), {0, 1, 2, 3}));
+      TFEL_TESTS_ASSERT(check(d.getColumn(2), {1, 2.5e-3, 100, 4}));
+      TFEL_TESTS_ASSERT(check(d.getColumn(3), {-1, -0.5, 0.03, 5}));
+      TFEL_TESTS_ASSERT((d.getLineNumbers() ==
+                         std::vector<NumericTextData::size_type>{3, 4, 5, 6}));
+      TFEL_TESTS_CHECK_THROW(d.getColumn(0), std::runtime_error);
+      TFEL_TESTS_CHECK_THROW(d.getColumn(4), std::runtime_error);
+    }
+    // comparison with the tokenized lines
+    const auto d = TextData("TextDataTest-1.txt");
+    TFEL_TESTS_ASSERT(d.getNumericTextData() != nullptr);
+    TFEL_TESTS_ASSERT(d.getLegends().size() == 3);
+    TFEL_TESTS_ASSERT(d.getPreamble().size() == 2);
+    TFEL_TESTS_ASSERT(std::distance(d.begin(), d.end()) == 4);
+    for (TextData::size_type c = 1; c != 4; ++c) {
+      auto v = std::vector<double>{};
+      for (const auto& l : d) {
+        TFEL_TESTS_ASSERT(l.tokens.size() == 3);
+        v.push_back(convert<double>(l.tokens[c - 1].value));
+      }
+      TFEL_TESTS_ASSERT(check(d.getColumn(c), v));
+    }
+  }
+  void test2() {
+    using namespace tfel::utilities;
+    // gnuplot format
+    write("TextDataTest-2.txt",
+          "time \"stress\" EXX\n"
+          "0 1 -1\n"
+          "1 2 3\n");
+    auto d = TextData("TextDataTest-2.txt", "gnuplot");
+    TFEL_TESTS_ASSERT(d.getNumericTextData() != nullptr);
+    TFEL_TESTS_ASSERT(d.findColumn("stress") == 2);
+    TFEL_TESTS_ASSERT(check(d.getColumn(3), {-1, 3}));
+    TFEL_TESTS_CHECK_THROW(d.getColumn(4), std::runtime_error);
+    d.skipLines(1);
+    TFEL_TESTS_ASSERT(check(d.getColumn(1), {1}));
+    TFEL_TESTS_ASSERT(std::distance(d.begin(), d.end()) == 1);
+    TFEL_TESTS_ASSERT(d.begin()->tokens.at(0).value == "1");
+    // first line containing numbers
+    write("TextDataTest-3.txt",
+          "0 1\n"
+          "1 2\n");
+    const auto d2 = TextData("TextDataTest-3.txt", "alcyone");
+    TFEL_TESTS_ASSERT(d2.getLegends().empty());
+    TFEL_TESTS_ASSERT(check(d2.getColumn(2), {1, 2}));
+  }
+  void test3() {
+    using namespace tfel::utilities;
+    // non numeric values or lines of different sizes
+    write("TextDataTest-4.txt",
+          "0 1 -1\n"
+          "1 a 3\n");
+    write("TextDataTest-5.txt",
+          "0 1 -1\n"
+          "1 2\n");
+    for (const auto& f : {"TextDataTest-4.txt", "TextDataTest-5.txt"}) {
+      TFEL_TESTS_CHECK_THROW(NumericTextData{f}, std::runtime_error);
+      const auto d = TextData(f);
+      TFEL_TESTS_ASSERT(d.getNumericTextData() == nullptr);
+      TFEL_TESTS_ASSERT(check(d.getColumn(1), {0, 1}));
+    }
+    TFEL_TESTS_CHECK_THROW(TextData("TextDataTest-4.txt").getColumn(2),
+                           std::invalid_argument);
+    TFEL_TESTS_CHECK_THROW(TextData("TextDataTest-5.txt").getColumn(3),
+                           std::runtime_error);
+  }
+  void test4() {
+    using namespace tfel::utilities;
+    TFEL_TESTS_CHECK_THROW(NumericTextData{"TextDataTest-unexisting.txt"},
+                           std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(TextData{"TextDataTest-unexisting.txt"},
+                           std::runtime_error);
+    write("TextDataTest-6.txt", "");
+    const auto d = TextData("TextDataTest-6.txt");
+    TFEL_TESTS_ASSERT(d.getColumn(1).empty());
+    TFEL_TESTS_ASSERT(d.begin() == d.end());
+  }
+  void test5() {
+    // the lines of a numeric file are tokenized by the first call to the
+    // `begin` method, which may be made concurrently by several threads
+    using namespace tfel::utilities;
+    auto c = std::string{"# time value\n"};
+    for (int i = 0; i != 1000; ++i) {
+      c += std::to_string(i) + " " + std::to_string(2 * i) + "\n";
+    }
+    write("TextDataTest-7.txt", c);
+    const auto d = TextData("TextDataTest-7.txt");
+    auto sizes = std::vector<std::ptrdiff_t>(8, 0);
+    auto threads = std::vector<std::thread>{};
+    for (std::size_t i = 0; i != sizes.size(); ++i) {
+      threads.emplace_back(
+          [&d, &sizes, i] { sizes[i] = std::distance(d.begin(), d.end()); });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    for (const auto s : sizes) {
+      TFEL_TESTS_ASSERT(s == 1000);
+    }
+    TFEL_TESTS_ASSERT(d.begin()->tokens.size() == 2u);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TextDataTest, "TextDataTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("TextDataTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <algorithm>
@@ -22,10 +23,6 @@ namespace tfel::check {
 
   static std::vector<double> eval(const tfel::utilities::TextData& d,
                                   const std::string& f) {
-    struct Variable {
-      unsigned short p;
-      std::vector<double> values;
-    };
     auto matches = [](const std::string& vn) {
       if (vn.size() < 2) {
         return false;
@@ -57,27 +54,24 @@ namespace tfel::check {
       return value;
     };
     tfel::math::Evaluator e{f};
-    std::vector<Variable> variables;
-    unsigned short p = 0u;
-    for (const auto& v : e.getVariablesNames()) {
+    const auto vnames = e.getVariablesNames();
+    if (vnames.empty()) {
+      return d.getColumn(convert(f));
+    }
+    std::vector<std::vector<double>> values;
+    std::vector<std::span<const double>> columns;
+    for (const auto& v : vnames) {
       raise_if(!matches(v),
                "tfel::check::eval: undeclared "
                "variable '" +
                    v + "'");
-      variables.push_back(Variable{p, d.getColumn(convert(v))});
-      ++p;
+      values.push_back(d.getColumn(convert(v)));
     }
-    if (variables.empty()) {
-      return d.getColumn(convert(f));
-    }
-    std::vector<double> r;
-    r.resize(variables[0].values.size());
-    for (std::vector<double>::size_type i = 0; i != r.size(); ++i) {
-      for (const auto& v : variables) {
-        e.setVariableValue(v.p, v.values[i]);
-      }
-      r[i] = e.getValue();
+    for (const auto& v : values) {
+      columns.push_back(v);
     }
+    std::vector<double> r(values[0].size());
+    e.evaluate(columns, r);
     return r;
   }  // end of eval
 